@@ -0,0 +1,138 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+/*
+ * Reports how much memory and how many threads one SDK instance adds to a server process, to track how densely
+ * processes can be packed onto an instance.
+ *
+ * The SDK connects the way it does on a GameLift Anywhere fleet, so the endpoint, auth token and ids come from the
+ * GAMELIFT_SDK_WEBSOCKET_URL, GAMELIFT_SDK_AUTH_TOKEN, GAMELIFT_SDK_FLEET_ID, GAMELIFT_SDK_HOST_ID and
+ * GAMELIFT_SDK_PROCESS_ID environment variables.
+ *
+ * Usage: aws-cpp-sdk-gamelift-server-footprint-benchmark [--low-footprint] [--poll-driven] [--seconds=N]
+ */
+
+#include <aws/gamelift/server/GameLiftServerAPI.h>
+#include <aws/gamelift/server/ProcessParameters.h>
+#include <aws/gamelift/server/model/ServerParameters.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+struct Footprint {
+    long residentKb;
+    long threads;
+};
+
+// Reads the process' resident set size and thread count. Both are -1 where /proc isn't available.
+Footprint ReadFootprint() {
+    Footprint footprint = {-1, -1};
+    FILE *status = fopen("/proc/self/status", "r");
+    if (status == nullptr) {
+        return footprint;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), status) != nullptr) {
+        if (strncmp(line, "VmRSS:", 6) == 0) {
+            footprint.residentKb = strtol(line + 6, nullptr, 10);
+        } else if (strncmp(line, "Threads:", 8) == 0) {
+            footprint.threads = strtol(line + 8, nullptr, 10);
+        }
+    }
+    fclose(status);
+    return footprint;
+}
+
+bool HasFlag(int argc, char **argv, const char *flag) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], flag) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int GetSeconds(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--seconds=", 10) == 0) {
+            return atoi(argv[i] + 10);
+        }
+    }
+    return 10;
+}
+
+const char *GetErrorMessage(const Aws::GameLift::GameLiftError &error) {
+#ifdef GAMELIFT_USE_STD
+    return error.GetErrorMessage().c_str();
+#else
+    return error.GetErrorMessage();
+#endif
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const bool lowFootprint = HasFlag(argc, argv, "--low-footprint");
+    const bool pollDriven = HasFlag(argc, argv, "--poll-driven");
+    const int seconds = GetSeconds(argc, argv);
+
+    const Footprint before = ReadFootprint();
+
+    Aws::GameLift::Server::Model::ServerParameters serverParameters;
+    serverParameters.SetLowFootprint(lowFootprint);
+    serverParameters.SetPollDriven(pollDriven);
+    auto initOutcome = Aws::GameLift::Server::InitSDK(serverParameters);
+    if (!initOutcome.IsSuccess()) {
+        printf("InitSDK failed: %s\n", GetErrorMessage(initOutcome.GetError()));
+        return 1;
+    }
+
+#ifdef GAMELIFT_USE_STD
+    Aws::GameLift::Server::ProcessParameters processParameters(nullptr, nullptr, nullptr, nullptr, 1001, Aws::GameLift::Server::LogParameters());
+#else
+    Aws::GameLift::Server::ProcessParameters processParameters(nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 1001,
+                                                               Aws::GameLift::Server::LogParameters());
+#endif
+    Aws::GameLift::GenericOutcome readyOutcome = Aws::GameLift::Server::ProcessReady(processParameters);
+    if (!readyOutcome.IsSuccess()) {
+        printf("ProcessReady failed: %s\n", GetErrorMessage(readyOutcome.GetError()));
+        Aws::GameLift::Server::Destroy();
+        return 1;
+    }
+
+    // Let heartbeats go out so the steady state is measured, not just the startup
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+    while (std::chrono::steady_clock::now() < end) {
+        if (pollDriven) {
+            Aws::GameLift::Server::Poll(1000);
+        }
+        // Roughly one game frame
+        std::this_thread::sleep_for(std::chrono::milliseconds(16));
+    }
+
+    const Footprint after = ReadFootprint();
+    Aws::GameLift::Server::ProcessEnding();
+    Aws::GameLift::Server::Destroy();
+
+    printf("mode: %s%s\n", lowFootprint ? "low footprint" : "default", pollDriven ? ", poll driven" : "");
+    if (before.residentKb < 0 || after.residentKb < 0) {
+        printf("Resident memory and thread counts are not available on this platform.\n");
+        return 0;
+    }
+    printf("resident memory: %ld kB -> %ld kB (SDK: %ld kB)\n", before.residentKb, after.residentKb, after.residentKb - before.residentKb);
+    printf("threads: %ld -> %ld (SDK: %ld)\n", before.threads, after.threads, after.threads - before.threads);
+    return 0;
+}
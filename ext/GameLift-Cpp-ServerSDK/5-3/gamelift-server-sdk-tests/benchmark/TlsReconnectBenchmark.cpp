@@ -0,0 +1,247 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+/*
+ * Reports how long it takes to reconnect to the GameLift endpoint, from opening the TCP connection until the
+ * server's first bytes arrive over TLS, with and without TLS session resumption.
+ *
+ * A TLS server on localhost with a throwaway certificate stands in for the endpoint, so no fleet is needed. "cold"
+ * connections each get a TLS context of their own, the way every connection did before contexts were shared.
+ * "reconnect" connections share one context and resume the session the previous connection was handed, the way
+ * the SDK's reconnects and connection refreshes do. Localhost has no network round trips, so the difference shown
+ * is the CPU cost of the key exchange and certificate; against the real endpoint a resumed TLS 1.2 handshake also
+ * saves a round trip.
+ *
+ * Usage: aws-cpp-sdk-gamelift-server-tls-reconnect-benchmark [--tls12] [--connections=N]
+ */
+
+#include <aws/gamelift/internal/network/TlsSessionCache.h>
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+const char *const HOST = "localhost";
+
+struct ReconnectResult {
+    double averageMillis;
+    std::size_t failedConnections;
+};
+
+bool HasFlag(int argc, char **argv, const char *flag) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], flag) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int GetConnections(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--connections=", 14) == 0) {
+            return atoi(argv[i] + 14);
+        }
+    }
+    return 200;
+}
+
+SSL_CTX *CreateServerContext() {
+    EVP_PKEY *key = nullptr;
+    EVP_PKEY_CTX *keyContext = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+    EVP_PKEY_keygen_init(keyContext);
+    EVP_PKEY_CTX_set_ec_paramgen_curve_nid(keyContext, NID_X9_62_prime256v1);
+    EVP_PKEY_keygen(keyContext, &key);
+    EVP_PKEY_CTX_free(keyContext);
+
+    X509 *certificate = X509_new();
+    ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+    X509_gmtime_adj(X509_getm_notBefore(certificate), 0);
+    X509_gmtime_adj(X509_getm_notAfter(certificate), 60 * 60);
+    X509_set_pubkey(certificate, key);
+    X509_NAME_add_entry_by_txt(X509_get_subject_name(certificate), "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char *>(HOST), -1, -1, 0);
+    X509_set_issuer_name(certificate, X509_get_subject_name(certificate));
+    X509_sign(certificate, key, EVP_sha256());
+
+    SSL_CTX *serverContext = SSL_CTX_new(TLS_server_method());
+    SSL_CTX_use_certificate(serverContext, certificate);
+    SSL_CTX_use_PrivateKey(serverContext, key);
+    X509_free(certificate);
+    EVP_PKEY_free(key);
+    return serverContext;
+}
+
+// The same protocol versions the SDK's shared context allows
+SSL_CTX *CreateClientContext(bool tls12) {
+    SSL_CTX *clientContext = SSL_CTX_new(TLS_client_method());
+    SSL_CTX_set_min_proto_version(clientContext, TLS1_2_VERSION);
+    if (tls12) {
+        SSL_CTX_set_max_proto_version(clientContext, TLS1_2_VERSION);
+    }
+    return clientContext;
+}
+
+// Otherwise Nagle's algorithm and delayed ACKs, not the handshake, make up most of each timing
+void SetNoDelay(int socket) {
+    int noDelay = 1;
+    setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+}
+
+// Accepts the given number of connections one after the other. Each gets a byte once its handshake is done, standing
+// in for the WebSocket upgrade response, and is held open until the client closes it.
+void Serve(int listener, SSL_CTX *serverContext, int connections) {
+    for (int i = 0; i < connections; i++) {
+        int socket = accept(listener, nullptr, nullptr);
+        if (socket < 0) {
+            return;
+        }
+        SetNoDelay(socket);
+        SSL *connection = SSL_new(serverContext);
+        SSL_set_fd(connection, socket);
+        if (SSL_accept(connection) == 1) {
+            char buffer = 0;
+            SSL_write(connection, &buffer, 1);
+            SSL_read(connection, &buffer, 1);
+        }
+        SSL_free(connection);
+        close(socket);
+    }
+}
+
+// Returns whether the connection got as far as the server's first byte
+bool Connect(int port, SSL_CTX *clientContext, Aws::GameLift::Internal::TlsSessionCache *cache) {
+    int socket = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    if (connect(socket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+        close(socket);
+        return false;
+    }
+    SetNoDelay(socket);
+
+    SSL *connection = SSL_new(clientContext);
+    SSL_set_fd(connection, socket);
+    SSL_set_tlsext_host_name(connection, HOST);
+    if (cache != nullptr) {
+        cache->Resume(connection);
+    }
+    char buffer = 0;
+    // TLS 1.3 tickets arrive after the handshake, ahead of the server's first byte
+    const bool connected = SSL_connect(connection) == 1 && SSL_read(connection, &buffer, 1) == 1;
+    if (connected && cache != nullptr) {
+        cache->RecordHandshake(connection);
+    }
+    // Dropped without a TLS shutdown, the way a connection refresh closes the old connection's socket at the end
+    SSL_free(connection);
+    close(socket);
+    return connected;
+}
+
+ReconnectResult RunCold(int port, bool tls12, int connections) {
+    ReconnectResult result = {0, 0};
+    std::chrono::steady_clock::duration total(0);
+    for (int i = 0; i < connections; i++) {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        SSL_CTX *clientContext = CreateClientContext(tls12);
+        if (!Connect(port, clientContext, nullptr)) {
+            result.failedConnections++;
+        }
+        SSL_CTX_free(clientContext);
+        total += std::chrono::steady_clock::now() - start;
+    }
+    result.averageMillis = std::chrono::duration<double, std::milli>(total).count() / connections;
+    return result;
+}
+
+ReconnectResult RunReconnect(int port, bool tls12, int connections, Aws::GameLift::Internal::TlsSessionCache::TlsSessionStats &stats) {
+    ReconnectResult result = {0, 0};
+    SSL_CTX *clientContext = CreateClientContext(tls12);
+    std::shared_ptr<Aws::GameLift::Internal::TlsSessionCache> cache = std::make_shared<Aws::GameLift::Internal::TlsSessionCache>();
+    cache->Attach(clientContext);
+    // The initial connection, which has nothing to resume yet, isn't a reconnect
+    if (!Connect(port, clientContext, cache.get())) {
+        result.failedConnections++;
+    }
+
+    std::chrono::steady_clock::duration total(0);
+    for (int i = 0; i < connections; i++) {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        if (!Connect(port, clientContext, cache.get())) {
+            result.failedConnections++;
+        }
+        total += std::chrono::steady_clock::now() - start;
+    }
+    result.averageMillis = std::chrono::duration<double, std::milli>(total).count() / connections;
+    stats = cache->GetStats();
+    SSL_CTX_free(clientContext);
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const bool tls12 = HasFlag(argc, argv, "--tls12");
+    const int connections = GetConnections(argc, argv);
+    if (connections <= 0) {
+        printf("--connections must be positive\n");
+        return 1;
+    }
+
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t addressLength = sizeof(address);
+    if (bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || listen(listener, 16) != 0 ||
+        getsockname(listener, reinterpret_cast<sockaddr *>(&address), &addressLength) != 0) {
+        printf("Could not listen on localhost\n");
+        close(listener);
+        return 1;
+    }
+    const int port = ntohs(address.sin_port);
+
+    SSL_CTX *serverContext = CreateServerContext();
+    // Cold connections, the initial reconnect connection, and the reconnects
+    std::thread server(Serve, listener, serverContext, 2 * connections + 1);
+
+    const ReconnectResult cold = RunCold(port, tls12, connections);
+    Aws::GameLift::Internal::TlsSessionCache::TlsSessionStats stats = {0, 0};
+    const ReconnectResult reconnect = RunReconnect(port, tls12, connections, stats);
+
+    server.join();
+    SSL_CTX_free(serverContext);
+    close(listener);
+
+    printf("protocol: %s, connections: %d\n", tls12 ? "TLS 1.2" : "TLS 1.3 where available", connections);
+    printf("cold: %.3f ms per connection (%zu failed)\n", cold.averageMillis, cold.failedConnections);
+    printf("reconnect: %.3f ms per connection (%zu failed, %zu resumed, %zu full handshakes)\n", reconnect.averageMillis, reconnect.failedConnections,
+           stats.resumedHandshakes, stats.fullHandshakes);
+    return 0;
+}
@@ -23,12 +23,19 @@ namespace Internal {
     class MockWebSocketClientWrapper : public IWebSocketClientWrapper {
     public:
         MOCK_METHOD(GenericOutcome, Connect, (const Uri& uri), (override));
+        MOCK_METHOD(void, ConnectAsync, (const Uri& uri, const std::function<void(const GenericOutcome&)>& callback), (override));
         MOCK_METHOD(GenericOutcome, SendSocketMessage, (const std::string& requestId, const std::string& message), (override));
+        MOCK_METHOD(void, CancelSend, (const std::string& requestId), (override));
         MOCK_METHOD(void, Disconnect, (), (override));
         MOCK_METHOD(void, RegisterGameLiftCallback,
-                (const std::string& gameLiftEvent, const std::function<GenericOutcome(std::string)>& callback),
+                (const std::string& gameLiftEvent, const GameLiftEventHandler& callback),
                 (override));
         MOCK_METHOD(bool, IsConnected, (), (override));
+        MOCK_METHOD(void, SetPollDriven, (), (override));
+        MOCK_METHOD(void, SetLowFootprint, (), (override));
+        MOCK_METHOD(void, SetWarmStandby, (), (override));
+        MOCK_METHOD(void, SetConnectedHandler, (const std::function<void()>& handler), (override));
+        MOCK_METHOD(std::size_t, Poll, (std::chrono::microseconds budget), (override));
     };
 
 } //namespace Internal
@@ -21,6 +21,7 @@ namespace Test {
     class MockRetryStrategy : public RetryStrategy {
     public:
         MOCK_METHOD(void, apply, (const std::function<bool(void)>& callable), (override));
+        MOCK_METHOD(int, getRetryDelayMillis, (int retry), (override));
     };
 
 } //namespace Test
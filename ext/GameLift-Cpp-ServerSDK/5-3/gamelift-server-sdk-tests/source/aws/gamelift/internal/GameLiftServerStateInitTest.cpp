@@ -270,6 +270,90 @@ TEST_F(GameLiftServerStateInitTest, GIVEN_defaultServerParameters_WHEN_initializ
     EXPECT_TRUE(outcome.IsSuccess());
 }
 
+TEST_F(GameLiftServerStateInitTest, GIVEN_pollDrivenServerParameters_WHEN_poll_THEN_socketWorkRunsOnCallingThread) {
+    // GIVEN
+    Aws::GameLift::Server::Model::ServerParameters serverParameters =
+        Aws::GameLift::Server::Model::ServerParameters("wss://test.com", "authToken", "fleetId", "hostId", "processId").WithPollDriven(true);
+    EXPECT_CALL(*mockWebSocketClientWrapper, SetPollDriven()).Times(1);
+    EXPECT_CALL(*mockWebSocketClientWrapper, Connect(testing::_)).Times(1).WillOnce(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, Poll(std::chrono::microseconds(500))).Times(1).WillOnce(testing::Return(2));
+    ASSERT_TRUE(serverState->InitializeNetworking(serverParameters).IsSuccess());
+
+    // WHEN
+    AwsLongOutcome outcome = serverState->Poll(std::chrono::microseconds(500));
+
+    // THEN
+    ASSERT_TRUE(outcome.IsSuccess());
+    EXPECT_EQ(outcome.GetResult(), 2);
+}
+
+TEST_F(GameLiftServerStateInitTest, GIVEN_threadedServerParameters_WHEN_poll_THEN_nothingRuns) {
+    // GIVEN
+    EXPECT_CALL(*mockWebSocketClientWrapper, SetPollDriven()).Times(0);
+    EXPECT_CALL(*mockWebSocketClientWrapper, Connect(testing::_)).Times(1).WillOnce(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, Poll(testing::_)).Times(0);
+    ASSERT_TRUE(serverState->InitializeNetworking(Aws::GameLift::Server::Model::ServerParameters()).IsSuccess());
+
+    // WHEN
+    AwsLongOutcome outcome = serverState->Poll(std::chrono::microseconds(500));
+
+    // THEN
+    ASSERT_TRUE(outcome.IsSuccess());
+    EXPECT_EQ(outcome.GetResult(), 0);
+}
+
+TEST_F(GameLiftServerStateInitTest, GIVEN_lowFootprintServerParameters_WHEN_initializeNetworking_THEN_wrapperIsLowFootprint) {
+    // GIVEN
+    Aws::GameLift::Server::Model::ServerParameters serverParameters =
+        Aws::GameLift::Server::Model::ServerParameters("wss://test.com", "authToken", "fleetId", "hostId", "processId").WithLowFootprint(true);
+    EXPECT_CALL(*mockWebSocketClientWrapper, SetLowFootprint()).Times(1);
+    EXPECT_CALL(*mockWebSocketClientWrapper, SetPollDriven()).Times(0);
+    EXPECT_CALL(*mockWebSocketClientWrapper, Connect(testing::_)).Times(1).WillOnce(testing::Return(GenericOutcome(nullptr)));
+
+    // WHEN
+    GenericOutcome outcome = serverState->InitializeNetworking(serverParameters);
+
+    // THEN
+    EXPECT_TRUE(outcome.IsSuccess());
+}
+
+TEST_F(GameLiftServerStateInitTest, GIVEN_warmStandbyServerParameters_WHEN_initializeNetworking_THEN_wrapperKeepsStandby) {
+    // GIVEN
+    Aws::GameLift::Server::Model::ServerParameters serverParameters =
+        Aws::GameLift::Server::Model::ServerParameters("wss://test.com", "authToken", "fleetId", "hostId", "processId").WithWarmStandby(true);
+    EXPECT_CALL(*mockWebSocketClientWrapper, SetWarmStandby()).Times(1);
+    EXPECT_CALL(*mockWebSocketClientWrapper, Connect(testing::_)).Times(1).WillOnce(testing::Return(GenericOutcome(nullptr)));
+
+    // WHEN
+    GenericOutcome outcome = serverState->InitializeNetworking(serverParameters);
+
+    // THEN
+    EXPECT_TRUE(outcome.IsSuccess());
+}
+
+TEST_F(GameLiftServerStateInitTest, GIVEN_asyncStartupServerParameters_WHEN_initializeNetworking_THEN_returnsBeforeConnectionOpens) {
+    // GIVEN
+    Aws::GameLift::Server::Model::ServerParameters serverParameters =
+        Aws::GameLift::Server::Model::ServerParameters("wss://test.com", "authToken", "fleetId", "hostId", "processId").WithAsyncStartup(true);
+    std::function<void(const GenericOutcome &)> connectCallback;
+    EXPECT_CALL(*mockWebSocketClientWrapper, Connect(testing::_)).Times(0);
+    EXPECT_CALL(*mockWebSocketClientWrapper, ConnectAsync(testing::_, testing::_)).Times(1).WillOnce(testing::SaveArg<1>(&connectCallback));
+
+    // WHEN
+    GenericOutcome outcome = serverState->InitializeNetworking(serverParameters);
+    StartupTimingsOutcome connectingTimings = serverState->GetStartupTimings();
+    connectCallback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE_FORBIDDEN)));
+
+    // THEN
+    EXPECT_TRUE(outcome.IsSuccess());
+    ASSERT_TRUE(connectingTimings.IsSuccess());
+    EXPECT_EQ(connectingTimings.GetResult().GetConnectMillis(), -1);
+    EXPECT_EQ(connectingTimings.GetResult().GetTotalMillis(), -1);
+    StartupTimingsOutcome failedTimings = serverState->GetStartupTimings();
+    ASSERT_FALSE(failedTimings.IsSuccess());
+    EXPECT_EQ(failedTimings.GetError(), GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE_FORBIDDEN));
+}
+
 } // namespace Test
 } // namespace Internal
 } // namespace GameLift
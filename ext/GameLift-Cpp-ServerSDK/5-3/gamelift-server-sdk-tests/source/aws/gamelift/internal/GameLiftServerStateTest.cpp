@@ -26,8 +26,12 @@
 #include <aws/gamelift/internal/network/MockWebSocketClientWrapper.h>
 #include <aws/gamelift/server/model/Player.h>
 #include <aws/gamelift/server/model/ServerParameters.h>
+#include <atomic>
 #include <chrono>
 #include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include <rapidjson/document.h>
 #include <rapidjson/rapidjson.h>
 
@@ -94,7 +98,7 @@ protected:
         }
     }
 
-    GenericOutcome CallProcessReady() {
+    GenericOutcome CallProcessReady(bool pollEvents = false) {
 
 #ifdef GAMELIFT_USE_STD
         Aws::GameLift::Server::ProcessParameters processParams =
@@ -103,6 +107,7 @@ protected:
         Aws::GameLift::Server::ProcessParameters processParams = Aws::GameLift::Server::ProcessParameters(
             nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 1001, Aws::GameLift::Server::LogParameters());
 #endif
+        processParams.setPollEvents(pollEvents);
 
         return serverState->ProcessReady(processParams);
     }
@@ -332,6 +337,45 @@ TEST_F(GameLiftServerStateTest, GIVEN_validState_WHEN_processReady_THEN_register
     EXPECT_EQ("HeartbeatServerProcess", (std::string)processHealthJson["Action"].GetString());
 }
 
+TEST_F(GameLiftServerStateTest, GIVEN_startGameSessionCallbackStillRunning_WHEN_healthCheckDue_THEN_reportsHealthy) {
+    // GIVEN
+    std::promise<void> releaseStartGameSession;
+    std::shared_future<void> startGameSessionReleased = releaseStartGameSession.get_future().share();
+    MessageCaptorAsync processHealth;
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
+    // The session starts while the process is activated, so its callback is queued ahead of the first health check
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("ActivateServerProcess"))).WillOnce(testing::InvokeWithoutArgs([this] {
+        serverState->OnStartGameSession(gameSession);
+        return GenericOutcome(nullptr);
+    }));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("HeartbeatServerProcess")))
+        .WillOnce(testing::Invoke(&processHealth, &MessageCaptorAsync::SendSocketMessage))
+        .WillRepeatedly(testing::Return(GenericOutcome(nullptr)));
+#ifdef GAMELIFT_USE_STD
+    Aws::GameLift::Server::ProcessParameters processParams = Aws::GameLift::Server::ProcessParameters(
+        [startGameSessionReleased](Aws::GameLift::Server::Model::GameSession) { startGameSessionReleased.wait(); }, nullptr, nullptr, [] { return true; }, 1001,
+        Aws::GameLift::Server::LogParameters());
+#else
+    Aws::GameLift::Server::ProcessParameters processParams = Aws::GameLift::Server::ProcessParameters(
+        [](Aws::GameLift::Server::Model::GameSession, void *state) { static_cast<std::shared_future<void> *>(state)->wait(); }, &startGameSessionReleased,
+        nullptr, nullptr, [](void *) { return true; }, nullptr, 1001, Aws::GameLift::Server::LogParameters());
+#endif
+    std::future<std::string> processHealthFuture = processHealth.received_message.get_future();
+
+    // WHEN
+    GenericOutcome outcome = serverState->ProcessReady(processParams);
+    const std::future_status processHealthStatus = processHealthFuture.wait_for(std::chrono::seconds(5));
+    releaseStartGameSession.set_value();
+
+    // THEN
+    EXPECT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(std::future_status::ready, processHealthStatus);
+    HeartbeatServerProcessRequest heartbeat;
+    Message &message = heartbeat;
+    message.Deserialize(processHealthFuture.get());
+    EXPECT_TRUE(heartbeat.GetHealthy());
+}
+
 TEST_F(GameLiftServerStateTest, GIVEN_wait71Seconds_WHEN_processReady_THEN_reportsHealthTwice) {
     // GIVEN
     MessageCaptorAsync processHealth1;
@@ -810,6 +854,207 @@ TEST_F(GameLiftServerStateTest, GIVEN_connectedProcessAndReadyButRefreshFails_WH
 
     // THEN - No errors
 }
+
+TEST_F(GameLiftServerStateTest, GIVEN_connectedProcessAndReady_WHEN_RemovePlayerSessionAsync_THEN_callbackInvokedOnce) {
+    // GIVEN
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("ActivateServerProcess")))
+        .WillOnce(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("HeartbeatServerProcess")))
+        .WillRepeatedly(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("RemovePlayerSession")))
+        .WillOnce(testing::Invoke(this, &GameLiftServerStateTest::captureSocketMessage));
+    std::atomic<int> callbackCount(0);
+    std::promise<GenericOutcome> callbackOutcome;
+    std::future<GenericOutcome> callbackOutcomeFuture = callbackOutcome.get_future();
+
+    // WHEN
+    CallProcessReady();
+    serverState->OnStartGameSession(gameSession);
+    serverState->RemovePlayerSessionAsync("testPlayerId", [&](const GenericOutcome &outcome) {
+        if (++callbackCount == 1) {
+            callbackOutcome.set_value(outcome);
+        }
+    });
+
+    // THEN
+    ASSERT_EQ(std::future_status::ready, callbackOutcomeFuture.wait_for(std::chrono::seconds(5)));
+    EXPECT_TRUE(callbackOutcomeFuture.get().IsSuccess());
+    EXPECT_EQ(callbackCount, 1);
+
+    RemovePlayerSessionRequest removePlayerSessionRequest;
+    Message &message = removePlayerSessionRequest;
+    message.Deserialize(capturedSocketMessage);
+
+    EXPECT_EQ(removePlayerSessionRequest.GetGameSessionId(), "gameSessionId");
+}
+
+TEST_F(GameLiftServerStateTest, GIVEN_retriedAsyncCall_WHEN_handlerMakesBlockingCall_THEN_handlerRunsOffSocketAndSchedulerThreads) {
+    // GIVEN
+    std::mutex sendThreadsLock;
+    std::vector<std::thread::id> sendThreads;
+    const auto recordSendThread = [&] {
+        std::lock_guard<std::mutex> lock(sendThreadsLock);
+        sendThreads.push_back(std::this_thread::get_id());
+    };
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("ActivateServerProcess")))
+        .WillOnce(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("HeartbeatServerProcess")))
+        .WillRepeatedly(testing::Return(GenericOutcome(nullptr)));
+    // The retry is sent, and so completed, from the scheduler thread
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("RemovePlayerSession")))
+        .WillOnce(testing::DoAll(testing::InvokeWithoutArgs(recordSendThread),
+                                 testing::Return(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE))))
+        .WillRepeatedly(testing::DoAll(testing::InvokeWithoutArgs(recordSendThread), testing::Return(GenericOutcome(nullptr))));
+    std::promise<std::thread::id> handlerThread;
+    std::future<std::thread::id> handlerThreadFuture = handlerThread.get_future();
+    std::promise<GenericOutcome> blockingOutcome;
+    std::future<GenericOutcome> blockingOutcomeFuture = blockingOutcome.get_future();
+    CallProcessReady();
+    serverState->OnStartGameSession(gameSession);
+
+    // WHEN
+    serverState->RemovePlayerSessionAsync("testPlayerId", [&](const GenericOutcome &) {
+        handlerThread.set_value(std::this_thread::get_id());
+        blockingOutcome.set_value(serverState->RemovePlayerSession("otherPlayerId"));
+    });
+
+    // THEN
+    ASSERT_EQ(std::future_status::ready, blockingOutcomeFuture.wait_for(std::chrono::seconds(5)));
+    EXPECT_TRUE(blockingOutcomeFuture.get().IsSuccess());
+    const std::thread::id handlerThreadId = handlerThreadFuture.get();
+    EXPECT_NE(handlerThreadId, std::this_thread::get_id());
+    // The first attempt was sent from this thread and the retry from the scheduler's; the blocking call from the handler's
+    std::lock_guard<std::mutex> lock(sendThreadsLock);
+    ASSERT_EQ(sendThreads.size(), 3u);
+    EXPECT_NE(sendThreads[1], std::this_thread::get_id());
+    EXPECT_NE(sendThreads[1], handlerThreadId);
+    EXPECT_EQ(sendThreads[2], handlerThreadId);
+}
+
+TEST_F(GameLiftServerStateTest, GIVEN_noProcessReady_WHEN_ActivateGameSessionAsync_THEN_callbackFailsWithoutSending) {
+    // GIVEN
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("ActivateGameSession"))).Times(0);
+    GenericOutcome callbackOutcome(nullptr);
+
+    // WHEN
+    serverState->ActivateGameSessionAsync([&](const GenericOutcome &outcome) { callbackOutcome = outcome; });
+
+    // THEN
+    EXPECT_FALSE(callbackOutcome.IsSuccess());
+    EXPECT_EQ(callbackOutcome.GetError().GetErrorType(), GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY);
+}
+
+TEST_F(GameLiftServerStateTest, GIVEN_connectedProcessAndReady_WHEN_GetComputeCertificateAsync_THEN_resultConverted) {
+    // GIVEN
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
+    WebSocketGetComputeCertificateResponse *response = new WebSocketGetComputeCertificateResponse();
+    response->SetComputeName("computeName");
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("ActivateServerProcess")))
+        .WillOnce(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("HeartbeatServerProcess")))
+        .WillRepeatedly(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("GetComputeCertificate")))
+        .WillOnce(testing::Return(GenericOutcome(response)));
+    std::promise<GetComputeCertificateOutcome> callbackPromise;
+    std::future<GetComputeCertificateOutcome> callbackFuture = callbackPromise.get_future();
+
+    // WHEN
+    CallProcessReady();
+    serverState->GetComputeCertificateAsync([&](const GetComputeCertificateOutcome &outcome) { callbackPromise.set_value(outcome); });
+
+    // THEN
+    ASSERT_EQ(std::future_status::ready, callbackFuture.wait_for(std::chrono::seconds(5)));
+    GetComputeCertificateOutcome callbackOutcome = callbackFuture.get();
+    ASSERT_TRUE(callbackOutcome.IsSuccess());
+#ifdef GAMELIFT_USE_STD
+    EXPECT_EQ(callbackOutcome.GetResult().GetComputeName(), "computeName");
+#else
+    EXPECT_STREQ(callbackOutcome.GetResult().GetComputeName(), "computeName");
+#endif
+}
+
+TEST_F(GameLiftServerStateTest, GIVEN_credentialsFetchedAsync_WHEN_GetFleetRoleCredentials_THEN_returnsCachedResult) {
+    const int64_t expirationInMillis = (time(nullptr) + GameLiftServerState::INSTANCE_ROLE_CREDENTIAL_TTL_MIN + 60) * 1000;
+
+    // GIVEN
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
+    auto response = new WebSocketGetFleetRoleCredentialsResponse();
+    response->SetAccessKeyId("AccessKeyId");
+    response->SetExpiration(expirationInMillis);
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("ActivateServerProcess")))
+        .WillOnce(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("HeartbeatServerProcess")))
+        .WillRepeatedly(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, HasAction("GetFleetRoleCredentials")))
+        .WillOnce(testing::Return(GenericOutcome(response)));
+
+    Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest request;
+    request.SetRoleArn("roleArn");
+    std::promise<GetFleetRoleCredentialsOutcome> asyncPromise;
+    std::future<GetFleetRoleCredentialsOutcome> asyncFuture = asyncPromise.get_future();
+
+    // WHEN
+    CallProcessReady();
+    serverState->GetFleetRoleCredentialsAsync(request, [&](const GetFleetRoleCredentialsOutcome &outcome) { asyncPromise.set_value(outcome); });
+    ASSERT_EQ(std::future_status::ready, asyncFuture.wait_for(std::chrono::seconds(5)));
+    GetFleetRoleCredentialsOutcome cachedOutcome = serverState->GetFleetRoleCredentials(request);
+
+    // THEN
+    EXPECT_TRUE(asyncFuture.get().IsSuccess());
+    EXPECT_TRUE(cachedOutcome.IsSuccess());
+}
+
+TEST_F(GameLiftServerStateTest, GIVEN_processReadyWithPolledEvents_WHEN_eventsArrive_THEN_pollEventsReturnsThemInOrder) {
+    // GIVEN
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, testing::_)).WillRepeatedly(testing::Return(GenericOutcome(nullptr)));
+    CallProcessReady(true);
+    Aws::GameLift::Server::Model::GameSession startedGameSession = Aws::GameLift::Server::Model::GameSession().WithGameSessionId("gameSessionId");
+    std::vector<Aws::GameLift::Server::Model::ServerEventType> polledTypes;
+    std::string polledGameSessionId;
+    long polledTerminationTime = -1;
+
+    // WHEN
+    serverState->OnStartGameSession(startedGameSession);
+    serverState->OnTerminateProcess(1234);
+    AwsLongOutcome firstPoll = serverState->PollEvents(
+        [&](Aws::GameLift::Server::Model::ServerEvent &event) {
+            polledTypes.push_back(event.GetType());
+            if (event.GetType() == Aws::GameLift::Server::Model::ServerEventType::START_GAME_SESSION) {
+                polledGameSessionId = event.GetGameSession().GetGameSessionId();
+            } else {
+                polledTerminationTime = event.GetTerminationTime();
+            }
+        },
+        -1);
+    AwsLongOutcome secondPoll = serverState->PollEvents([](Aws::GameLift::Server::Model::ServerEvent &) {}, -1);
+
+    // THEN
+    ASSERT_TRUE(firstPoll.IsSuccess());
+    EXPECT_EQ(firstPoll.GetResult(), 2);
+    EXPECT_EQ(polledTypes, std::vector<Aws::GameLift::Server::Model::ServerEventType>(
+                               {Aws::GameLift::Server::Model::ServerEventType::START_GAME_SESSION, Aws::GameLift::Server::Model::ServerEventType::PROCESS_TERMINATE}));
+    EXPECT_EQ(polledGameSessionId, "gameSessionId");
+    EXPECT_EQ(polledTerminationTime, 1234);
+    ASSERT_TRUE(secondPoll.IsSuccess());
+    EXPECT_EQ(secondPoll.GetResult(), 0);
+}
+
+TEST_F(GameLiftServerStateTest, GIVEN_processReadyWithCallbacks_WHEN_pollEvents_THEN_processNotReady) {
+    // GIVEN
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, testing::_)).WillRepeatedly(testing::Return(GenericOutcome(nullptr)));
+    CallProcessReady();
+
+    // WHEN
+    AwsLongOutcome outcome = serverState->PollEvents([](Aws::GameLift::Server::Model::ServerEvent &) {}, -1);
+
+    // THEN
+    ASSERT_FALSE(outcome.IsSuccess());
+    EXPECT_EQ(outcome.GetError().GetErrorType(), GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY);
+}
 } // namespace Test
 } // namespace Internal
 } // namespace GameLift
@@ -13,6 +13,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonHelper.h>
 #include <chrono>
 #include <future>
 #include <regex>
@@ -55,6 +56,14 @@ TEST_F(MessageTest, GIVEN_noArgs_WHEN_defaultConstruct_THEN_success) {
     ASSERT_EQ(message.GetAction(), "");
 }
 
+TEST_F(MessageTest, GIVEN_inboundTag_WHEN_construct_THEN_noRequestIdGenerated) {
+    // GIVEN / WHEN
+    Message message(INBOUND_MESSAGE);
+    // THEN
+    ASSERT_EQ(message.GetAction(), "");
+    ASSERT_EQ(message.GetRequestId(), "");
+}
+
 TEST_F(MessageTest, GIVEN_message_WHEN_copyConstruct_THEN_success) {
     // GIVEN / WHEN
     Message message(testMessage);
@@ -115,6 +124,31 @@ TEST_F(MessageTest, GIVEN_validInput_WHEN_deserialize_THEN_success) {
     AssertMessageEqualsTestMessage(message);
 }
 
+TEST_F(MessageTest, GIVEN_parsedDocument_WHEN_deserialize_THEN_success) {
+    // GIVEN
+    Message message;
+    rapidjson::Document document;
+    document.Parse(serializedTestMessage.c_str());
+    // WHEN
+    message.Deserialize(document);
+    // THEN
+    AssertMessageEqualsTestMessage(message);
+    ASSERT_EQ(message.GetRequestId(), testRequestId);
+}
+
+TEST_F(MessageTest, GIVEN_reusedBuffer_WHEN_serializeTo_THEN_bufferHoldsOnlyLatestMessage) {
+    // GIVEN
+    rapidjson::StringBuffer &buffer = JsonHelper::GetThreadLocalBuffer();
+    Message other;
+    other.SetAction("otherActionWithALongerName");
+    ASSERT_TRUE(other.SerializeTo(buffer));
+    // WHEN
+    bool serialized = testMessage.SerializeTo(buffer);
+    // THEN
+    ASSERT_TRUE(serialized);
+    ASSERT_EQ(std::string(buffer.GetString(), buffer.GetSize()), serializedTestMessage);
+}
+
 TEST_F(MessageTest, GIVEN_emptyMessage_WHEN_serialize_THEN_success) {
     // GIVEN
     Message message;
@@ -181,6 +215,26 @@ TEST_F(MessageTest, GIVEN_multipleMessagesInThreads_WHEN_constructor_THEN_haveDi
     // well-distributed.
     ASSERT_EQ(futureRequestIds.size(), requestIds.size());
 }
+
+TEST_F(MessageTest, GIVEN_generatedRequestIds_WHEN_toRequestHandle_THEN_handlesAreDistinct) {
+    // GIVEN
+    Message first;
+    Message second;
+    // WHEN
+    uint64_t firstHandle = Message::ToRequestHandle(first.GetRequestId());
+    uint64_t secondHandle = Message::ToRequestHandle(second.GetRequestId());
+    // THEN
+    ASSERT_NE(firstHandle, secondHandle);
+    ASSERT_EQ(firstHandle, Message::ToRequestHandle(first.GetRequestId()));
+}
+
+TEST_F(MessageTest, GIVEN_foreignRequestId_WHEN_toRequestHandle_THEN_handleIsStable) {
+    // GIVEN / WHEN
+    uint64_t handle = Message::ToRequestHandle(testRequestId);
+    // THEN
+    ASSERT_EQ(handle, Message::ToRequestHandle(testRequestId));
+    ASSERT_NE(handle, Message::ToRequestHandle("otherRequestId"));
+}
 } // namespace Test
 } // namespace Internal
 } // namespace GameLift
@@ -0,0 +1,179 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/model/adapter/DescribePlayerSessionsAdapter.h>
+#include <aws/gamelift/internal/model/adapter/DescribePlayerSessionsDecoder.h>
+#include <aws/gamelift/internal/model/response/WebSocketDescribePlayerSessionsResponse.h>
+#include <chrono>
+#include <cstdio>
+#include <rapidjson/document.h>
+#include <rapidjson/reader.h>
+#include <sstream>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+class DescribePlayerSessionsDecoderTest : public ::testing::Test {
+protected:
+    static Server::Model::DescribePlayerSessionsResult Decode(const std::string &json) {
+        Server::Model::DescribePlayerSessionsResult result;
+        DescribePlayerSessionsDecoder decoder(result);
+        rapidjson::Reader reader;
+        rapidjson::StringStream stream(json.c_str());
+        EXPECT_FALSE(reader.Parse(stream, decoder).IsError());
+        return result;
+    }
+};
+
+TEST_F(DescribePlayerSessionsDecoderTest, GIVEN_playerSessions_WHEN_decode_THEN_fieldsMapped) {
+    // GIVEN
+    std::string json = "{\"Action\":\"DescribePlayerSessions\",\"NextToken\":\"nextToken\",\"PlayerSessions\":[{"
+                       "\"PlayerSessionId\":\"playerSessionId\",\"PlayerId\":\"playerId\",\"GameSessionId\":\"gameSessionId\","
+                       "\"FleetId\":\"fleetId\",\"CreationTime\":1700000000000,\"TerminationTime\":12,\"Status\":\"ACTIVE\","
+                       "\"IpAddress\":\"127.0.0.1\",\"Port\":7777,\"PlayerData\":\"playerData\",\"DnsName\":\"dnsName\"}]}";
+    // WHEN
+    Server::Model::DescribePlayerSessionsResult result = Decode(json);
+    // THEN
+    EXPECT_EQ(result.GetNextToken(), "nextToken");
+    ASSERT_EQ(result.GetPlayerSessions().size(), 1u);
+    const Server::Model::PlayerSession &playerSession = result.GetPlayerSessions()[0];
+    EXPECT_EQ(playerSession.GetPlayerSessionId(), "playerSessionId");
+    EXPECT_EQ(playerSession.GetPlayerId(), "playerId");
+    EXPECT_EQ(playerSession.GetGameSessionId(), "gameSessionId");
+    EXPECT_EQ(playerSession.GetFleetId(), "fleetId");
+    EXPECT_EQ(playerSession.GetCreationTime(), 1700000000000L);
+    EXPECT_EQ(playerSession.GetTerminationTime(), 12);
+    EXPECT_EQ(playerSession.GetStatus(), Server::Model::PlayerSessionStatus::ACTIVE);
+    EXPECT_EQ(playerSession.GetIpAddress(), "127.0.0.1");
+    EXPECT_EQ(playerSession.GetPort(), 7777);
+    EXPECT_EQ(playerSession.GetPlayerData(), "playerData");
+    EXPECT_EQ(playerSession.GetDnsName(), "dnsName");
+}
+
+TEST_F(DescribePlayerSessionsDecoderTest, GIVEN_missingFields_WHEN_decode_THEN_defaultsMatchWebSocketPlayerSession) {
+    // GIVEN
+    std::string json = "{\"PlayerSessions\":[{\"Port\":\"notAPort\",\"Status\":\"UNKNOWN\"}]}";
+    // WHEN
+    Server::Model::DescribePlayerSessionsResult result = Decode(json);
+    // THEN
+    EXPECT_EQ(result.GetNextToken(), "");
+    ASSERT_EQ(result.GetPlayerSessions().size(), 1u);
+    const Server::Model::PlayerSession &playerSession = result.GetPlayerSessions()[0];
+    EXPECT_EQ(playerSession.GetPlayerSessionId(), "");
+    EXPECT_EQ(playerSession.GetCreationTime(), -1);
+    EXPECT_EQ(playerSession.GetTerminationTime(), -1);
+    EXPECT_EQ(playerSession.GetPort(), -1);
+    EXPECT_EQ(playerSession.GetStatus(), Server::Model::PlayerSessionStatus::NOT_SET);
+}
+
+TEST_F(DescribePlayerSessionsDecoderTest, GIVEN_nullAndNestedValues_WHEN_decode_THEN_ignored) {
+    // GIVEN
+    std::string json = "{\"PlayerSessions\":[null,{\"PlayerId\":\"first\",\"Extra\":{\"PlayerId\":\"nested\",\"Port\":1}},"
+                       "{\"PlayerId\":\"second\",\"Tags\":[\"PlayerId\",2]}],\"Other\":{\"NextToken\":\"nested\"}}";
+    // WHEN
+    Server::Model::DescribePlayerSessionsResult result = Decode(json);
+    // THEN
+    EXPECT_EQ(result.GetNextToken(), "");
+    ASSERT_EQ(result.GetPlayerSessions().size(), 2u);
+    EXPECT_EQ(result.GetPlayerSessions()[0].GetPlayerId(), "first");
+    EXPECT_EQ(result.GetPlayerSessions()[0].GetPort(), -1);
+    EXPECT_EQ(result.GetPlayerSessions()[1].GetPlayerId(), "second");
+}
+
+TEST_F(DescribePlayerSessionsDecoderTest, GIVEN_parsedDocument_WHEN_accept_THEN_sameResultAsReader) {
+    // GIVEN
+    std::string json = "{\"NextToken\":\"nextToken\",\"PlayerSessions\":[{\"PlayerId\":\"playerId\",\"Status\":\"RESERVED\",\"Port\":1}]}";
+    rapidjson::Document document;
+    document.Parse(json.c_str());
+    Server::Model::DescribePlayerSessionsResult result;
+    DescribePlayerSessionsDecoder decoder(result);
+    // WHEN
+    document.Accept(decoder);
+    // THEN
+    EXPECT_EQ(result.GetNextToken(), "nextToken");
+    ASSERT_EQ(result.GetPlayerSessions().size(), 1u);
+    EXPECT_EQ(result.GetPlayerSessions()[0].GetPlayerId(), "playerId");
+    EXPECT_EQ(result.GetPlayerSessions()[0].GetStatus(), Server::Model::PlayerSessionStatus::RESERVED);
+    EXPECT_EQ(result.GetPlayerSessions()[0].GetPort(), 1);
+}
+
+// Microbenchmark comparing the decoder against the path it replaced: a full DOM parse, deserializing
+// into WebSocketPlayerSession objects and converting those with DescribePlayerSessionsAdapter.
+// Throughput is printed rather than asserted since it depends on the host.
+class DescribePlayerSessionsDecoderBenchmark : public ::testing::TestWithParam<int> {
+protected:
+    static constexpr const int ITERATIONS = 200;
+
+    static std::string MakeResponse(int sessionCount) {
+        std::stringstream ss;
+        ss << "{\"Action\":\"DescribePlayerSessions\",\"RequestId\":\"requestId\",\"StatusCode\":200,\"NextToken\":\"nextToken\",\"PlayerSessions\":[";
+        for (int i = 0; i < sessionCount; i++) {
+            ss << (i > 0 ? "," : "") << "{\"PlayerSessionId\":\"psess-" << i << "\",\"PlayerId\":\"player-" << i
+               << "\",\"GameSessionId\":\"arn:aws:gamelift:us-west-2::gamesession/fleet-1/gsess-1\",\"FleetId\":\"fleet-1\","
+               << "\"CreationTime\":1700000000000,\"TerminationTime\":1700000360000,\"Status\":\"ACTIVE\",\"IpAddress\":\"10.0.0.1\","
+               << "\"Port\":7777,\"PlayerData\":\"{\\\"team\\\":\\\"red\\\"}\",\"DnsName\":\"ec2-10-0-0-1.compute.amazonaws.com\"}";
+        }
+        ss << "]}";
+        return ss.str();
+    }
+
+    template <typename Decode> static double MeasureOpsPerSecond(Decode decode) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; i++) {
+            decode();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return ITERATIONS / elapsed.count();
+    }
+};
+
+TEST_P(DescribePlayerSessionsDecoderBenchmark, GIVEN_responsePage_WHEN_decode_THEN_reportThroughput) {
+    // GIVEN
+    const int sessionCount = GetParam();
+    const std::string json = MakeResponse(sessionCount);
+    size_t adapterSessions = 0;
+    size_t decoderSessions = 0;
+
+    // WHEN
+    double adapterOpsPerSecond = MeasureOpsPerSecond([&] {
+        rapidjson::Document document;
+        document.Parse(json.c_str());
+        WebSocketDescribePlayerSessionsResponse response(INBOUND_MESSAGE);
+        Message &message = response;
+        message.Deserialize(document);
+        Server::Model::DescribePlayerSessionsResult result = DescribePlayerSessionsAdapter::convert(&response);
+        adapterSessions = result.GetPlayerSessions().size();
+    });
+    double decoderOpsPerSecond = MeasureOpsPerSecond([&] {
+        Server::Model::DescribePlayerSessionsResult result;
+        DescribePlayerSessionsDecoder decoder(result);
+        rapidjson::Reader reader;
+        rapidjson::StringStream stream(json.c_str());
+        reader.Parse(stream, decoder);
+        decoderSessions = result.GetPlayerSessions().size();
+    });
+
+    // THEN
+    printf("[ BENCH    ] %4d sessions: decoder %.0f pages/s, document+adapter %.0f pages/s\n", sessionCount, decoderOpsPerSecond,
+           adapterOpsPerSecond);
+    ASSERT_EQ(adapterSessions, static_cast<size_t>(sessionCount));
+    ASSERT_EQ(decoderSessions, static_cast<size_t>(sessionCount));
+}
+
+INSTANTIATE_TEST_CASE_P(SessionsPerPage, DescribePlayerSessionsDecoderBenchmark, ::testing::Values(10, 100, 1000));
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
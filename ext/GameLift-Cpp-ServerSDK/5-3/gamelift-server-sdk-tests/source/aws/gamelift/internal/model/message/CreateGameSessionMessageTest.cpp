@@ -91,6 +91,26 @@ TEST_F(CreateGameSessionMessageTest, GIVEN_noArgs_WHEN_defaultConstruct_THEN_suc
     ASSERT_EQ(message.GetGameProperties().size(), 0);
 }
 
+TEST_F(CreateGameSessionMessageTest, GIVEN_inboundTag_WHEN_construct_THEN_noRequestIdGenerated) {
+    // GIVEN / WHEN
+    CreateGameSessionMessage message(INBOUND_MESSAGE);
+    // THEN
+    ASSERT_EQ(message.GetAction(), "CreateGameSession");
+    ASSERT_EQ(message.GetRequestId(), "");
+    ASSERT_EQ(message.GetMaximumPlayerSessionCount(), -1);
+    ASSERT_EQ(message.GetPort(), -1);
+}
+
+TEST_F(CreateGameSessionMessageTest, GIVEN_inboundMessage_WHEN_deserialize_THEN_success) {
+    // GIVEN
+    CreateGameSessionMessage createGameSessionMessage(INBOUND_MESSAGE);
+    Message &message = createGameSessionMessage;
+    // WHEN
+    message.Deserialize(serializedTestMessage);
+    // THEN
+    AssertMessageEqualsTestMessage(createGameSessionMessage);
+}
+
 TEST_F(CreateGameSessionMessageTest, GIVEN_message_WHEN_copyConstruct_THEN_success) {
     // GIVEN / WHEN
     CreateGameSessionMessage message(testMessage);
@@ -10,7 +10,14 @@
  *
  */
 #include "gtest/gtest.h"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
 #include <aws/gamelift/internal/network/GameLiftWebSocketClientManager.h>
+#include <aws/gamelift/internal/model/request/HeartbeatServerProcessRequest.h>
+#include <aws/gamelift/internal/model/request/RemovePlayerSessionRequest.h>
+#include <aws/gamelift/internal/model/request/UpdatePlayerSessionCreationPolicyRequest.h>
 #include <aws/gamelift/internal/network/MockWebSocketClientWrapper.h>
 
 namespace Aws {
@@ -160,6 +167,213 @@ TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_retriable_failure_WHEN_max_retr
     ASSERT_TRUE(!outcome.IsSuccess());
 }
 
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_serviceErrors_WHEN_sendMessages_THEN_breakerOpensAndLaterCallsFailFast) {
+    // GIVEN
+    const int failureThreshold = CircuitBreaker::DEFAULT_FAILURE_THRESHOLD;
+    // EXPECT
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, testing::_))
+        .Times(failureThreshold)
+        .WillRepeatedly(testing::Return(GenericOutcome(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION)));
+    // WHEN
+    for (int i = 0; i < failureThreshold; i++) {
+        Message message;
+        clientManager->SendSocketMessage(message);
+    }
+    Message message;
+    GenericOutcome outcome = clientManager->SendSocketMessage(message);
+    // THEN
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(outcome.GetError().GetErrorType(), GAMELIFT_ERROR_TYPE::SERVICE_CALL_FAILED);
+}
+
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_attemptsNeverSent_WHEN_sendMessages_THEN_breakerStaysClosed) {
+    // GIVEN
+    const int failureThreshold = CircuitBreaker::DEFAULT_FAILURE_THRESHOLD;
+    // EXPECT
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, testing::_))
+        .Times(failureThreshold + 1)
+        .WillRepeatedly(testing::Return(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE)));
+    // WHEN
+    for (int i = 0; i < failureThreshold; i++) {
+        Message message;
+        clientManager->SendSocketMessage(message);
+    }
+    Message message;
+    GenericOutcome outcome = clientManager->SendSocketMessage(message);
+    // THEN
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(outcome.GetError().GetErrorType(), GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE);
+}
+
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_pollDriven_WHEN_sendMessageNeedsRetry_THEN_callingThreadRunsRetryAndCompletes) {
+    // GIVEN
+    // Never started, so only the blocking call itself runs its timers
+    std::shared_ptr<TimerScheduler> timerScheduler = std::make_shared<TimerScheduler>();
+    GameLiftWebSocketClientManager pollDrivenClientManager(mockWebSocketClientWrapper, timerScheduler);
+    pollDrivenClientManager.SetPollDriven();
+    Message message;
+    std::stringstream ss;
+    ss << "{\"RequestId\":\"" << message.GetRequestId() << "\"}";
+    std::string expectedJsonMessage = ss.str();
+    // EXPECT
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(message.GetRequestId(), expectedJsonMessage))
+        .WillOnce(testing::Return(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)))
+        .WillOnce(testing::Return(GenericOutcome(nullptr)));
+    EXPECT_CALL(*mockWebSocketClientWrapper, Poll(testing::_)).Times(testing::AtLeast(1)).WillRepeatedly(testing::Return(0));
+    // WHEN
+    GenericOutcome outcome = pollDrivenClientManager.SendSocketMessage(message);
+    // THEN
+    ASSERT_TRUE(outcome.IsSuccess());
+}
+
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_success_WHEN_sendMessageAsync_THEN_callbackSucceeds) {
+    // GIVEN
+    Message message;
+    std::stringstream ss;
+    ss << "{\"RequestId\":\"" << message.GetRequestId() << "\"}";
+    std::string expectedJsonMessage = ss.str();
+    int callbackCount = 0;
+    GenericOutcome callbackOutcome;
+    // EXPECT
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(message.GetRequestId(), expectedJsonMessage)).WillOnce(testing::Return(GenericOutcome(nullptr)));
+    // WHEN
+    clientManager->SendSocketMessageAsync(message, [&](const GenericOutcome &outcome) {
+        callbackCount++;
+        callbackOutcome = outcome;
+    });
+    // THEN
+    ASSERT_EQ(callbackCount, 1);
+    ASSERT_TRUE(callbackOutcome.IsSuccess());
+}
+
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_retriable_failure_WHEN_sendMessageAsync_THEN_retryOnScheduler) {
+    // GIVEN
+    Message message;
+    std::stringstream ss;
+    ss << "{\"RequestId\":\"" << message.GetRequestId() << "\"}";
+    std::string expectedJsonMessage = ss.str();
+    std::promise<GenericOutcome> callbackOutcome;
+    // EXPECT
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(message.GetRequestId(), expectedJsonMessage))
+        .WillOnce(testing::Return(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)))
+        .WillOnce(testing::Return(GenericOutcome(nullptr)));
+    // WHEN
+    clientManager->SendSocketMessageAsync(message, [&](const GenericOutcome &outcome) { callbackOutcome.set_value(outcome); });
+    // THEN
+    std::future<GenericOutcome> callbackFuture = callbackOutcome.get_future();
+    ASSERT_EQ(callbackFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_TRUE(callbackFuture.get().IsSuccess());
+}
+
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_retriable_failure_WHEN_max_retries_send_message_async_THEN_failOnce) {
+    // GIVEN
+    Message message;
+    std::stringstream ss;
+    ss << "{\"RequestId\":\"" << message.GetRequestId() << "\"}";
+    std::string expectedJsonMessage = ss.str();
+    std::promise<GenericOutcome> callbackOutcome;
+    // EXPECT
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(message.GetRequestId(), expectedJsonMessage))
+        .WillRepeatedly(testing::Return(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)));
+    // WHEN
+    clientManager->SendSocketMessageAsync(message, [&](const GenericOutcome &outcome) { callbackOutcome.set_value(outcome); });
+    // THEN
+    std::future<GenericOutcome> callbackFuture = callbackOutcome.get_future();
+    ASSERT_EQ(callbackFuture.wait_for(std::chrono::seconds(30)), std::future_status::ready);
+    GenericOutcome outcome = callbackFuture.get();
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(outcome.GetError().GetErrorType(), GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE);
+}
+
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_retriable_failure_WHEN_send_message_async_with_timeout_THEN_timesOutBeforeRetriesRunOut) {
+    // GIVEN
+    Message message;
+    std::stringstream ss;
+    ss << "{\"RequestId\":\"" << message.GetRequestId() << "\"}";
+    std::string expectedJsonMessage = ss.str();
+    std::promise<GenericOutcome> callbackOutcome;
+    std::atomic<int> callbackCount(0);
+    // EXPECT
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(message.GetRequestId(), expectedJsonMessage))
+        .WillRepeatedly(testing::Return(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)));
+    // WHEN
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    clientManager->SendSocketMessageAsync(
+        message,
+        [&](const GenericOutcome &outcome) {
+            if (callbackCount++ == 0) {
+                callbackOutcome.set_value(outcome);
+            }
+        },
+        std::chrono::milliseconds(200));
+    // THEN
+    std::future<GenericOutcome> callbackFuture = callbackOutcome.get_future();
+    ASSERT_EQ(callbackFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+    GenericOutcome outcome = callbackFuture.get();
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(outcome.GetError().GetErrorType(), GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_TIMEOUT);
+    // The retries left behind stop at the deadline rather than complete the caller again
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    ASSERT_EQ(callbackCount, 1);
+}
+
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_attemptStillWaitingToBeSent_WHEN_deadlinePasses_THEN_attemptWithdrawn) {
+    // GIVEN
+    Message message;
+    std::stringstream ss;
+    ss << "{\"RequestId\":\"" << message.GetRequestId() << "\"}";
+    std::string expectedJsonMessage = ss.str();
+    std::promise<GenericOutcome> callbackOutcome;
+    // EXPECT
+    // Stands in for a send the wrapper holds until a reconnect that comes after the deadline
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(message.GetRequestId(), expectedJsonMessage)).WillOnce(testing::InvokeWithoutArgs([] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        return GenericOutcome(nullptr);
+    }));
+    EXPECT_CALL(*mockWebSocketClientWrapper, CancelSend(message.GetRequestId())).Times(1);
+    // WHEN
+    clientManager->SendSocketMessageAsync(message, [&](const GenericOutcome &outcome) { callbackOutcome.set_value(outcome); }, std::chrono::milliseconds(100));
+    // THEN
+    std::future<GenericOutcome> callbackFuture = callbackOutcome.get_future();
+    ASSERT_EQ(callbackFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    GenericOutcome outcome = callbackFuture.get();
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(outcome.GetError().GetErrorType(), GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_TIMEOUT);
+}
+
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_clientManager_WHEN_connectAsync_THEN_callbackSucceeds) {
+    // GIVEN
+    std::string testUrl = "testUrl";
+    std::string testAuthToken = "testAuthToken";
+    std::string testProcessId = "testProcessId";
+    std::string testHostId = "testHostId";
+    std::string testFleetId = "testFleetId";
+
+    Uri uri = Uri::UriBuilder()
+                  .WithBaseUri(testUrl + "/")
+                  .AddQueryParam(PID_KEY, testProcessId)
+                  .AddQueryParam(SDK_VERSION_KEY, sdkVersion)
+                  .AddQueryParam(FLAVOR_KEY, "Cpp")
+                  .AddQueryParam(AUTH_TOKEN_KEY, testAuthToken)
+                  .AddQueryParam(COMPUTE_ID_KEY, testHostId)
+                  .AddQueryParam(FLEET_ID_KEY, testFleetId)
+                  .Build();
+    int callbackCount = 0;
+    GenericOutcome callbackOutcome;
+
+    // EXPECT
+    EXPECT_CALL(*mockWebSocketClientWrapper, Connect(uri)).WillOnce(testing::Return(GenericOutcome(nullptr)));
+    // WHEN
+    clientManager->ConnectAsync(testUrl, testAuthToken, testProcessId, testHostId, testFleetId, [&](const GenericOutcome &outcome) {
+        callbackCount++;
+        callbackOutcome = outcome;
+    });
+    // THEN
+    ASSERT_EQ(callbackCount, 1);
+    ASSERT_TRUE(callbackOutcome.IsSuccess());
+}
+
 TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_clientManager_WHEN_connectFails_THEN_fail) {
     // GIVEN
     std::string testUrl = "testUrl";
@@ -298,6 +512,129 @@ TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_clientManager_WHEN_connectUrlWi
     // THEN
     ASSERT_TRUE(outcome.IsSuccess());
 }
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_disconnected_WHEN_sendReplayableMessages_THEN_queuedAndSentInOrderOnceConnected) {
+    // GIVEN
+    std::function<void()> connectedHandler;
+    EXPECT_CALL(*mockWebSocketClientWrapper, SetConnectedHandler(testing::_)).WillOnce(testing::SaveArg<0>(&connectedHandler));
+    GameLiftWebSocketClientManager offlineClientManager(mockWebSocketClientWrapper);
+    RemovePlayerSessionRequest removePlayerSession = RemovePlayerSessionRequest().WithGameSessionId("gameSessionId").WithPlayerSessionId("playerSessionId");
+    HeartbeatServerProcessRequest firstHeartbeat = HeartbeatServerProcessRequest().WithHealthy(true);
+    UpdatePlayerSessionCreationPolicyRequest updatePolicy("gameSessionId", "DENY_ALL");
+    HeartbeatServerProcessRequest secondHeartbeat = HeartbeatServerProcessRequest().WithHealthy(false);
+    int succeededCallbacks = 0;
+    int failedCallbacks = 0;
+    const SocketMessageCallback callback = [&succeededCallbacks, &failedCallbacks](const GenericOutcome &outcome) {
+        (outcome.IsSuccess() ? succeededCallbacks : failedCallbacks)++;
+    };
+    bool connected = false;
+    // EXPECT
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::ReturnPointee(&connected));
+    {
+        // Only the latest heartbeat goes out, in the place of the first
+        testing::InSequence sequence;
+        EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(removePlayerSession.GetRequestId(), testing::_)).WillOnce(testing::Return(GenericOutcome(nullptr)));
+        EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(secondHeartbeat.GetRequestId(), testing::_)).WillOnce(testing::Return(GenericOutcome(nullptr)));
+        EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(updatePolicy.GetRequestId(), testing::_)).WillOnce(testing::Return(GenericOutcome(nullptr)));
+    }
+    // WHEN
+    offlineClientManager.SendSocketMessageAsync(removePlayerSession, callback);
+    offlineClientManager.SendSocketMessageAsync(firstHeartbeat, callback);
+    offlineClientManager.SendSocketMessageAsync(updatePolicy, callback);
+    offlineClientManager.SendSocketMessageAsync(secondHeartbeat, callback);
+    // Nothing has been sent yet, only the replaced heartbeat is done with
+    ASSERT_EQ(succeededCallbacks, 0);
+    ASSERT_EQ(failedCallbacks, 1);
+    ASSERT_TRUE(connectedHandler);
+    connected = true;
+    connectedHandler();
+    // THEN
+    ASSERT_EQ(succeededCallbacks, 3);
+    ASSERT_EQ(failedCallbacks, 1);
+    testing::Mock::VerifyAndClearExpectations(mockWebSocketClientWrapper.get());
+}
+
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_reconnectWhileQueueing_WHEN_sendReplayableMessage_THEN_flushSendsIt) {
+    // GIVEN
+    std::function<void()> connectedHandler;
+    EXPECT_CALL(*mockWebSocketClientWrapper, SetConnectedHandler(testing::_)).WillOnce(testing::SaveArg<0>(&connectedHandler));
+    GameLiftWebSocketClientManager offlineClientManager(mockWebSocketClientWrapper);
+    RemovePlayerSessionRequest removePlayerSession = RemovePlayerSessionRequest().WithGameSessionId("gameSessionId").WithPlayerSessionId("playerSessionId");
+    std::promise<GenericOutcome> callbackOutcome;
+    std::atomic<bool> connected(false);
+    std::thread reconnectThread;
+    // EXPECT
+    // The connection comes back just after the sender finds it down, and the connected handler's flush is given
+    // plenty of time to run before the sender gets to queue its message
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Invoke([&connected, &connectedHandler, &reconnectThread] {
+        if (connected) {
+            return true;
+        }
+        connected = true;
+        reconnectThread = std::thread(connectedHandler);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        return false;
+    }));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(removePlayerSession.GetRequestId(), testing::_)).WillOnce(testing::Return(GenericOutcome(nullptr)));
+    // WHEN
+    offlineClientManager.SendSocketMessageAsync(removePlayerSession, [&callbackOutcome](const GenericOutcome &outcome) { callbackOutcome.set_value(outcome); });
+    // THEN
+    std::future<GenericOutcome> callbackFuture = callbackOutcome.get_future();
+    const std::future_status callbackStatus = callbackFuture.wait_for(std::chrono::seconds(5));
+    reconnectThread.join();
+    ASSERT_EQ(callbackStatus, std::future_status::ready);
+    ASSERT_TRUE(callbackFuture.get().IsSuccess());
+}
+
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_flushedMessage_WHEN_callerDeadlinePassesBeforeItIsSent_THEN_attemptWithdrawn) {
+    // GIVEN
+    std::function<void()> connectedHandler;
+    EXPECT_CALL(*mockWebSocketClientWrapper, SetConnectedHandler(testing::_)).WillOnce(testing::SaveArg<0>(&connectedHandler));
+    GameLiftWebSocketClientManager offlineClientManager(mockWebSocketClientWrapper);
+    RemovePlayerSessionRequest removePlayerSession = RemovePlayerSessionRequest().WithGameSessionId("gameSessionId").WithPlayerSessionId("playerSessionId");
+    std::promise<GenericOutcome> callbackOutcome;
+    bool connected = false;
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::ReturnPointee(&connected));
+    offlineClientManager.SendSocketMessageAsync(removePlayerSession, [&callbackOutcome](const GenericOutcome &outcome) { callbackOutcome.set_value(outcome); },
+                                                std::chrono::milliseconds(100));
+    // EXPECT
+    // The flushed send is still waiting to go out when the caller's deadline passes, so that deadline withdraws it
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(removePlayerSession.GetRequestId(), testing::_)).WillOnce(testing::Invoke([] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        return GenericOutcome(nullptr);
+    }));
+    EXPECT_CALL(*mockWebSocketClientWrapper, CancelSend(removePlayerSession.GetRequestId())).Times(1);
+    // WHEN
+    connected = true;
+    connectedHandler();
+    // THEN
+    std::future<GenericOutcome> callbackFuture = callbackOutcome.get_future();
+    ASSERT_EQ(callbackFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    GenericOutcome outcome = callbackFuture.get();
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(outcome.GetError().GetErrorType(), GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_TIMEOUT);
+}
+
+TEST_F(GameLiftWebSocketClientManagerTest, GIVEN_queuedMessage_WHEN_managerDestroyedBeforeReconnect_THEN_callbackFails) {
+    // GIVEN
+    std::unique_ptr<GameLiftWebSocketClientManager> offlineClientManager(new GameLiftWebSocketClientManager(mockWebSocketClientWrapper));
+    RemovePlayerSessionRequest removePlayerSession = RemovePlayerSessionRequest().WithGameSessionId("gameSessionId").WithPlayerSessionId("playerSessionId");
+    int callbackCount = 0;
+    GenericOutcome callbackOutcome;
+    EXPECT_CALL(*mockWebSocketClientWrapper, IsConnected()).WillRepeatedly(testing::Return(false));
+    EXPECT_CALL(*mockWebSocketClientWrapper, SendSocketMessage(testing::_, testing::_)).Times(0);
+    offlineClientManager->SendSocketMessageAsync(removePlayerSession, [&](const GenericOutcome &outcome) {
+        callbackCount++;
+        callbackOutcome = outcome;
+    });
+    ASSERT_EQ(callbackCount, 0);
+    // WHEN
+    offlineClientManager.reset();
+    // THEN
+    ASSERT_EQ(callbackCount, 1);
+    ASSERT_FALSE(callbackOutcome.IsSuccess());
+    ASSERT_EQ(callbackOutcome.GetError().GetErrorType(), GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE);
+}
+
 } // namespace Test
 } // namespace Internal
 } // namespace GameLift
@@ -0,0 +1,83 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/network/InboundFrameParser.h>
+#include <sstream>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+TEST(InboundFrameParserTest, GIVEN_jsonObjectFrame_WHEN_parse_THEN_stringsBorrowedFromFrame) {
+    // GIVEN
+    InboundFrameParser parser;
+    std::string frame = "{\"Action\":\"CreateGameSession\",\"StatusCode\":200}";
+    const char *frameBegin = frame.data();
+    const char *frameEnd = frame.data() + frame.length();
+    // WHEN
+    const rapidjson::Value *document = parser.Parse(frame);
+    // THEN
+    ASSERT_NE(document, nullptr);
+    const char *action = (*document)["Action"].GetString();
+    ASSERT_STREQ(action, "CreateGameSession");
+    ASSERT_GE(action, frameBegin);
+    ASSERT_LT(action, frameEnd);
+    ASSERT_EQ((*document)["StatusCode"].GetInt(), 200);
+}
+
+TEST(InboundFrameParserTest, GIVEN_invalidJsonFrame_WHEN_parse_THEN_nullptr) {
+    // GIVEN
+    InboundFrameParser parser;
+    std::string frame = "{\"Action\":";
+    // WHEN / THEN
+    ASSERT_EQ(parser.Parse(frame), nullptr);
+}
+
+TEST(InboundFrameParserTest, GIVEN_nonObjectFrame_WHEN_parse_THEN_nullptr) {
+    // GIVEN
+    InboundFrameParser parser;
+    std::string frame = "[1,2,3]";
+    std::string emptyFrame;
+    // WHEN / THEN
+    ASSERT_EQ(parser.Parse(frame), nullptr);
+    ASSERT_EQ(parser.Parse(emptyFrame), nullptr);
+}
+
+TEST(InboundFrameParserTest, GIVEN_frameLargerThanArena_WHEN_parseThenParseSmallFrame_THEN_bothParsed) {
+    // GIVEN
+    InboundFrameParser parser;
+    std::stringstream ss;
+    ss << "{\"PlayerSessions\":[";
+    for (int i = 0; i < 2000; i++) {
+        ss << (i > 0 ? "," : "") << "{\"PlayerId\":\"player" << i << "\"}";
+    }
+    ss << "]}";
+    std::string largeFrame = ss.str();
+    std::string smallFrame = "{\"Action\":\"TerminateProcess\"}";
+    // WHEN
+    const rapidjson::Value *largeDocument = parser.Parse(largeFrame);
+    ASSERT_NE(largeDocument, nullptr);
+    const rapidjson::SizeType largeSize = (*largeDocument)["PlayerSessions"].Size();
+    const rapidjson::Value *smallDocument = parser.Parse(smallFrame);
+    // THEN
+    ASSERT_EQ(largeSize, 2000u);
+    ASSERT_NE(smallDocument, nullptr);
+    ASSERT_STREQ((*smallDocument)["Action"].GetString(), "TerminateProcess");
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
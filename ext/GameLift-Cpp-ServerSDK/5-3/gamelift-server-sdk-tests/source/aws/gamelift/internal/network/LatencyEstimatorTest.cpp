@@ -0,0 +1,91 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/network/LatencyEstimator.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+using std::chrono::milliseconds;
+
+TEST(LatencyEstimatorTest, GIVEN_fewResponses_WHEN_getTimeout_THEN_ceilingUsed) {
+    // GIVEN
+    LatencyEstimator latencyEstimator;
+    for (int i = 0; i < LatencyEstimator::MIN_SAMPLES - 1; i++) {
+        latencyEstimator.Record("DescribePlayerSessions", milliseconds(50));
+    }
+    // WHEN
+    LatencyEstimator::LatencyStats stats;
+    const bool hasStats = latencyEstimator.TryGetStats("DescribePlayerSessions", stats);
+    // THEN
+    ASSERT_FALSE(hasStats);
+    ASSERT_EQ(latencyEstimator.GetTimeout("DescribePlayerSessions", milliseconds(10000)), milliseconds(10000));
+}
+
+TEST(LatencyEstimatorTest, GIVEN_responsesWithSlowTail_WHEN_getStats_THEN_percentilesTrackTail) {
+    // GIVEN
+    LatencyEstimator latencyEstimator;
+    // WHEN
+    for (int i = 0; i < 100; i++) {
+        latencyEstimator.Record("GetComputeCertificate", milliseconds(i < 90 ? 100 : 500));
+    }
+    latencyEstimator.Record("GetFleetRoleCredentials", milliseconds(5));
+    // THEN
+    LatencyEstimator::LatencyStats stats;
+    ASSERT_TRUE(latencyEstimator.TryGetStats("GetComputeCertificate", stats));
+    ASSERT_EQ(stats.samples, 100u);
+    // Percentiles are reported to within a bucket, erring slow
+    ASSERT_GE(stats.p95, milliseconds(500));
+    ASSERT_LE(stats.p95, milliseconds(550));
+    ASSERT_GE(stats.p99, stats.p95);
+    ASSERT_GT(stats.smoothed, milliseconds(100));
+    ASSERT_LT(stats.smoothed, milliseconds(500));
+    ASSERT_EQ(latencyEstimator.GetTimeout("GetComputeCertificate", milliseconds(20000)), stats.p99 * LatencyEstimator::TIMEOUT_P99_MULTIPLIER);
+    ASSERT_EQ(latencyEstimator.GetTimeout("GetComputeCertificate", milliseconds(1000)), milliseconds(1000));
+}
+
+TEST(LatencyEstimatorTest, GIVEN_fastService_WHEN_getTimeout_THEN_notBelowMinimum) {
+    // GIVEN
+    LatencyEstimator latencyEstimator;
+    for (int i = 0; i < LatencyEstimator::MIN_SAMPLES; i++) {
+        latencyEstimator.Record("HeartbeatServerProcess", milliseconds(2));
+    }
+    // WHEN
+    const milliseconds timeout = latencyEstimator.GetTimeout("HeartbeatServerProcess", milliseconds(10000));
+    // THEN
+    ASSERT_EQ(timeout, milliseconds(LatencyEstimator::MIN_TIMEOUT_MILLIS));
+}
+
+TEST(LatencyEstimatorTest, GIVEN_serviceSlowsDown_WHEN_newResponsesRecorded_THEN_olderSamplesAgeOut) {
+    // GIVEN
+    LatencyEstimator latencyEstimator;
+    for (int i = 0; i < 5000; i++) {
+        latencyEstimator.Record("DescribePlayerSessions", milliseconds(20));
+    }
+    // WHEN
+    for (int i = 0; i < 1000; i++) {
+        latencyEstimator.Record("DescribePlayerSessions", milliseconds(400));
+    }
+    // THEN
+    LatencyEstimator::LatencyStats stats;
+    ASSERT_TRUE(latencyEstimator.TryGetStats("DescribePlayerSessions", stats));
+    ASSERT_GE(stats.p95, milliseconds(400));
+    ASSERT_GE(stats.smoothed, milliseconds(399));
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,174 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/network/OutboundScheduler.h>
+#include <string>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+namespace {
+// Stands in for the socket: records every write, buffers each one until drained, and refuses them while full
+struct FakeSocket {
+    FakeSocket() : full(false), buffered(0) {}
+
+    OutboundScheduler::Write WriteOf(const std::string &name) {
+        return [this, name](const OutboundScheduler::WriteCallback &callback) {
+            writes.push_back(name);
+            buffered += WRITE_BYTES;
+            if (full) {
+                callback(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE));
+            } else {
+                callback(GenericOutcome(nullptr));
+            }
+        };
+    }
+
+    static constexpr const std::size_t WRITE_BYTES = 10;
+
+    bool full;
+    std::size_t buffered;
+    std::vector<std::string> writes;
+};
+} // namespace
+
+TEST(OutboundSchedulerTest, GIVEN_socketKeepingUp_WHEN_submit_THEN_writtenAtOnce) {
+    // GIVEN
+    OutboundScheduler outboundScheduler(std::make_shared<TimerScheduler>());
+    FakeSocket socket;
+    int succeeded = 0;
+    // WHEN
+    outboundScheduler.Submit(OutboundScheduler::Priority::BULK, 10, socket.WriteOf("bulk"), [&succeeded](const GenericOutcome &outcome) {
+        succeeded += outcome.IsSuccess() ? 1 : 0;
+    });
+    // THEN
+    ASSERT_EQ(socket.writes, std::vector<std::string>({"bulk"}));
+    ASSERT_EQ(succeeded, 1);
+    ASSERT_EQ(outboundScheduler.GetStats().queuedMessages, 0u);
+}
+
+TEST(OutboundSchedulerTest, GIVEN_refusedWrite_WHEN_bufferDrains_THEN_queuedMessagesWrittenHighestPriorityFirst) {
+    // GIVEN
+    FakeSocket socket;
+    std::vector<std::string> completed;
+    const auto completedAs = [&completed](const std::string &name) {
+        return [&completed, name](const GenericOutcome &outcome) { completed.push_back(name + (outcome.IsSuccess() ? "" : " failed")); };
+    };
+    std::shared_ptr<TimerScheduler> timerScheduler = std::make_shared<TimerScheduler>();
+    OutboundScheduler outboundScheduler(timerScheduler);
+    socket.full = true;
+    outboundScheduler.Submit(OutboundScheduler::Priority::BULK, 10, socket.WriteOf("bulk 1"), completedAs("bulk 1"));
+    // WHEN
+    outboundScheduler.Submit(OutboundScheduler::Priority::BULK, 10, socket.WriteOf("bulk 2"), completedAs("bulk 2"));
+    outboundScheduler.Submit(OutboundScheduler::Priority::PLAYER_ADMISSION, 10, socket.WriteOf("admission"), completedAs("admission"));
+    outboundScheduler.Submit(OutboundScheduler::Priority::CONTROL, 10, socket.WriteOf("control"), completedAs("control"));
+    OutboundScheduler::OutboundStats blockedStats = outboundScheduler.GetStats();
+    socket.full = false;
+    timerScheduler->RunDueTimers(std::chrono::steady_clock::now() + std::chrono::seconds(1));
+    // THEN
+    ASSERT_EQ(blockedStats.queuedMessages, 4u);
+    ASSERT_EQ(blockedStats.queuedBytes, 40u);
+    ASSERT_EQ(socket.writes, std::vector<std::string>({"bulk 1", "control", "admission", "bulk 1", "bulk 2"}));
+    ASSERT_EQ(completed, std::vector<std::string>({"control", "admission", "bulk 1", "bulk 2"}));
+    ASSERT_EQ(outboundScheduler.GetStats().queuedMessages, 0u);
+}
+
+TEST(OutboundSchedulerTest, GIVEN_socketFallingBehind_WHEN_bufferDrains_THEN_controlOvertakesQueuedBulk) {
+    // GIVEN
+    FakeSocket socket;
+    std::shared_ptr<TimerScheduler> timerScheduler = std::make_shared<TimerScheduler>();
+    OutboundScheduler outboundScheduler(timerScheduler);
+    // Two writes' worth of unsent bytes is as far as the socket is let fall behind
+    outboundScheduler.SetBufferedAmount([&socket] { return socket.buffered; }, 2 * FakeSocket::WRITE_BYTES);
+    const OutboundScheduler::WriteCallback ignored = [](const GenericOutcome &) {};
+    outboundScheduler.Submit(OutboundScheduler::Priority::BULK, 10, socket.WriteOf("bulk 1"), ignored);
+    outboundScheduler.Submit(OutboundScheduler::Priority::BULK, 10, socket.WriteOf("bulk 2"), ignored);
+    // WHEN
+    outboundScheduler.Submit(OutboundScheduler::Priority::BULK, 10, socket.WriteOf("bulk 3"), ignored);
+    outboundScheduler.Submit(OutboundScheduler::Priority::BULK, 10, socket.WriteOf("bulk 4"), ignored);
+    outboundScheduler.Submit(OutboundScheduler::Priority::CONTROL, 10, socket.WriteOf("control"), ignored);
+    const OutboundScheduler::OutboundStats blockedStats = outboundScheduler.GetStats();
+    // Still behind, so nothing more goes out
+    timerScheduler->RunDueTimers(std::chrono::steady_clock::now() + std::chrono::seconds(1));
+    const std::size_t writesBeforeDrained = socket.writes.size();
+    // Each time it drains, writing resumes until the socket is behind again
+    socket.buffered = 0;
+    timerScheduler->RunDueTimers(std::chrono::steady_clock::now() + std::chrono::seconds(2));
+    const std::vector<std::string> writesOnceDrained = socket.writes;
+    socket.buffered = 0;
+    timerScheduler->RunDueTimers(std::chrono::steady_clock::now() + std::chrono::seconds(3));
+    // THEN
+    ASSERT_EQ(blockedStats.queuedMessages, 3u);
+    ASSERT_EQ(writesBeforeDrained, 2u);
+    ASSERT_EQ(writesOnceDrained, std::vector<std::string>({"bulk 1", "bulk 2", "control", "bulk 3"}));
+    ASSERT_EQ(socket.writes, std::vector<std::string>({"bulk 1", "bulk 2", "control", "bulk 3", "bulk 4"}));
+    ASSERT_EQ(outboundScheduler.GetStats().queuedMessages, 0u);
+}
+
+TEST(OutboundSchedulerTest, GIVEN_socketStaysFull_WHEN_writeRefusedRepeatedly_THEN_refusalReportedToSender) {
+    // GIVEN
+    FakeSocket socket;
+    std::vector<std::string> completed;
+    std::shared_ptr<TimerScheduler> timerScheduler = std::make_shared<TimerScheduler>();
+    OutboundScheduler outboundScheduler(timerScheduler);
+    socket.full = true;
+    // WHEN
+    outboundScheduler.Submit(OutboundScheduler::Priority::CONTROL, 10, socket.WriteOf("control"), [&completed](const GenericOutcome &outcome) {
+        completed.push_back(outcome.IsSuccess() ? "control" : "control failed");
+    });
+    for (int retry = 1; retry <= OutboundScheduler::MAX_WRITE_REFUSALS; retry++) {
+        timerScheduler->RunDueTimers(std::chrono::steady_clock::now() + std::chrono::seconds(retry));
+    }
+    // THEN
+    ASSERT_EQ(socket.writes.size(), static_cast<std::size_t>(OutboundScheduler::MAX_WRITE_REFUSALS + 1));
+    ASSERT_EQ(completed, std::vector<std::string>({"control failed"}));
+    ASSERT_EQ(outboundScheduler.GetStats().queuedMessages, 0u);
+}
+
+TEST(OutboundSchedulerTest, GIVEN_fullQueue_WHEN_submit_THEN_bulkRejectedOrShedBeforeControlIsRefused) {
+    // GIVEN
+    // Declared first, since the scheduler fails whatever is still queued when it is destroyed
+    FakeSocket socket;
+    std::vector<std::string> completed;
+    const auto completedAs = [&completed](const std::string &name) {
+        return [&completed, name](const GenericOutcome &outcome) { completed.push_back(name + (outcome.IsSuccess() ? "" : " failed")); };
+    };
+    OutboundScheduler outboundScheduler(std::make_shared<TimerScheduler>(), 100, 60);
+    socket.full = true;
+    outboundScheduler.Submit(OutboundScheduler::Priority::BULK, 30, socket.WriteOf("bulk 1"), completedAs("bulk 1"));
+    outboundScheduler.Submit(OutboundScheduler::Priority::BULK, 20, socket.WriteOf("bulk 2"), completedAs("bulk 2"));
+    // WHEN
+    // Past the bulk lane's share
+    outboundScheduler.Submit(OutboundScheduler::Priority::BULK, 20, socket.WriteOf("bulk 3"), completedAs("bulk 3"));
+    // Past the whole queue's bound, so the newest bulk messages make room
+    outboundScheduler.Submit(OutboundScheduler::Priority::CONTROL, 60, socket.WriteOf("control 1"), completedAs("control 1"));
+    outboundScheduler.Submit(OutboundScheduler::Priority::PLAYER_ADMISSION, 30, socket.WriteOf("admission 1"), completedAs("admission 1"));
+    // With no bulk messages left, control is queued past the bound but player admission is not
+    outboundScheduler.Submit(OutboundScheduler::Priority::CONTROL, 30, socket.WriteOf("control 2"), completedAs("control 2"));
+    outboundScheduler.Submit(OutboundScheduler::Priority::PLAYER_ADMISSION, 10, socket.WriteOf("admission 2"), completedAs("admission 2"));
+    // THEN
+    ASSERT_EQ(completed, std::vector<std::string>({"bulk 3 failed", "bulk 2 failed", "bulk 1 failed", "admission 2 failed"}));
+    OutboundScheduler::OutboundStats stats = outboundScheduler.GetStats();
+    ASSERT_EQ(stats.queuedMessages, 3u);
+    ASSERT_EQ(stats.queuedBytes, 120u);
+    ASSERT_EQ(stats.rejectedMessages, 2u);
+    ASSERT_EQ(stats.shedMessages, 2u);
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
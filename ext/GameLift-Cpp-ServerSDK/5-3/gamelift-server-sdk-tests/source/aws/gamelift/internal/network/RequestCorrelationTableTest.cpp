@@ -0,0 +1,207 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <aws/gamelift/internal/network/RequestCorrelationTable.h>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+typedef RequestCorrelationTable<std::function<void()>> CallbackTable;
+
+TEST(RequestCorrelationTableTest, GIVEN_insertedHandle_WHEN_take_THEN_valueReturnedOnce) {
+    // GIVEN
+    CallbackTable table;
+    int calls = 0;
+    ASSERT_EQ(table.TryInsert(42, [&calls] { calls++; }), CallbackTable::InsertResult::INSERTED);
+    // WHEN
+    std::function<void()> value;
+    bool firstTake = table.TryTake(42, value);
+    std::function<void()> secondValue;
+    bool secondTake = table.TryTake(42, secondValue);
+    // THEN
+    ASSERT_TRUE(firstTake);
+    ASSERT_FALSE(secondTake);
+    value();
+    ASSERT_EQ(calls, 1);
+}
+
+TEST(RequestCorrelationTableTest, GIVEN_handleInFlight_WHEN_insertSameHandle_THEN_duplicate) {
+    // GIVEN
+    CallbackTable table;
+    ASSERT_EQ(table.TryInsert(7, [] {}), CallbackTable::InsertResult::INSERTED);
+    // WHEN
+    CallbackTable::InsertResult result = table.TryInsert(7, [] {});
+    // THEN
+    ASSERT_EQ(result, CallbackTable::InsertResult::DUPLICATE);
+}
+
+TEST(RequestCorrelationTableTest, GIVEN_collidingHandles_WHEN_take_THEN_eachHandleGetsItsOwnValue) {
+    // GIVEN
+    RequestCorrelationTable<int, 16> table;
+    ASSERT_EQ(table.TryInsert(3, 1), (RequestCorrelationTable<int, 16>::InsertResult::INSERTED));
+    ASSERT_EQ(table.TryInsert(3 + 16, 2), (RequestCorrelationTable<int, 16>::InsertResult::INSERTED));
+    // WHEN
+    int second = 0;
+    int first = 0;
+    bool secondTake = table.TryTake(3 + 16, second);
+    bool firstTake = table.TryTake(3, first);
+    // THEN
+    ASSERT_TRUE(secondTake);
+    ASSERT_TRUE(firstTake);
+    ASSERT_EQ(second, 2);
+    ASSERT_EQ(first, 1);
+}
+
+TEST(RequestCorrelationTableTest, GIVEN_probeWindowInUse_WHEN_insert_THEN_full) {
+    // GIVEN
+    RequestCorrelationTable<int, 16> table;
+    for (uint64_t handle = 0; handle < 16 * 16; handle += 16) {
+        ASSERT_EQ(table.TryInsert(handle, 0), (RequestCorrelationTable<int, 16>::InsertResult::INSERTED));
+    }
+    // WHEN
+    RequestCorrelationTable<int, 16>::InsertResult result = table.TryInsert(16 * 16, 16);
+    // THEN
+    ASSERT_EQ(result, (RequestCorrelationTable<int, 16>::InsertResult::FULL));
+}
+
+TEST(RequestCorrelationTableTest, GIVEN_requestsInFlight_WHEN_takeAll_THEN_allValuesTakenAndTableEmpty) {
+    // GIVEN
+    CallbackTable table;
+    int calls = 0;
+    for (uint64_t handle = 1; handle <= 10; handle++) {
+        ASSERT_EQ(table.TryInsert(handle, [&calls] { calls++; }), CallbackTable::InsertResult::INSERTED);
+    }
+    // WHEN
+    table.TakeAll([](std::function<void()> &value) { value(); });
+    // THEN
+    ASSERT_EQ(calls, 10);
+    std::function<void()> value;
+    ASSERT_FALSE(table.TryTake(1, value));
+}
+
+TEST(RequestCorrelationTableTest, GIVEN_concurrentSenders_WHEN_insertAndTake_THEN_everyRequestCompletesOnce) {
+    // GIVEN
+    const int threadCount = 8;
+    const int requestsPerThread = 5000;
+    CallbackTable table;
+    std::atomic<uint64_t> nextHandle(1);
+    std::atomic<int> calls(0);
+    std::vector<std::thread> threads;
+    // WHEN
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < requestsPerThread; i++) {
+                uint64_t handle = nextHandle.fetch_add(1);
+                ASSERT_EQ(table.TryInsert(handle, [&calls] { calls++; }), CallbackTable::InsertResult::INSERTED);
+                std::function<void()> value;
+                ASSERT_TRUE(table.TryTake(handle, value));
+                value();
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    // THEN
+    ASSERT_EQ(calls.load(), threadCount * requestsPerThread);
+}
+
+// Microbenchmark comparing the table against the mutex-guarded map it replaced in
+// WebSocketppClientWrapper. Each sender registers a request and then completes it, the way a send and
+// its response do. Throughput is printed rather than asserted since it depends on the host.
+class RequestCorrelationTableBenchmark : public ::testing::TestWithParam<int> {
+protected:
+    static constexpr const int REQUESTS_PER_SENDER = 2000;
+
+    template <typename SenderLoop> static double MeasureOpsPerSecond(int senderCount, SenderLoop senderLoop) {
+        std::vector<std::thread> senders;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < senderCount; i++) {
+            senders.emplace_back(senderLoop);
+        }
+        for (std::thread &sender : senders) {
+            sender.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return senderCount * REQUESTS_PER_SENDER / elapsed.count();
+    }
+};
+
+TEST_P(RequestCorrelationTableBenchmark, GIVEN_concurrentSenders_WHEN_correlateRequests_THEN_reportThroughput) {
+    // GIVEN
+    const int senderCount = GetParam();
+    std::atomic<uint64_t> nextHandle(1);
+    std::atomic<int> tableCompletions(0);
+    std::atomic<int> mapCompletions(0);
+    CallbackTable table;
+    std::mutex mapLock;
+    std::map<std::string, std::function<void()>> map;
+
+    // WHEN
+    double tableOpsPerSecond = MeasureOpsPerSecond(senderCount, [&] {
+        for (int i = 0; i < REQUESTS_PER_SENDER; i++) {
+            uint64_t handle = nextHandle.fetch_add(1);
+            while (table.TryInsert(handle, [&tableCompletions] { tableCompletions++; }) != CallbackTable::InsertResult::INSERTED) {
+                std::this_thread::yield();
+            }
+            std::function<void()> callback;
+            if (table.TryTake(handle, callback)) {
+                callback();
+            }
+        }
+    });
+    double mapOpsPerSecond = MeasureOpsPerSecond(senderCount, [&] {
+        for (int i = 0; i < REQUESTS_PER_SENDER; i++) {
+            std::string requestId = std::to_string(nextHandle.fetch_add(1));
+            {
+                std::lock_guard<std::mutex> lock(mapLock);
+                map[requestId] = [&mapCompletions] { mapCompletions++; };
+            }
+            std::function<void()> callback;
+            {
+                std::lock_guard<std::mutex> lock(mapLock);
+                auto it = map.find(requestId);
+                if (it != map.end()) {
+                    callback = std::move(it->second);
+                    map.erase(it);
+                }
+            }
+            if (callback) {
+                callback();
+            }
+        }
+    });
+
+    // THEN
+    printf("[ BENCH    ] %2d senders: table %.0f ops/s, mutex+map %.0f ops/s\n", senderCount, tableOpsPerSecond, mapOpsPerSecond);
+    ASSERT_EQ(tableCompletions.load(), senderCount * REQUESTS_PER_SENDER);
+    ASSERT_EQ(mapCompletions.load(), senderCount * REQUESTS_PER_SENDER);
+}
+
+INSTANTIATE_TEST_CASE_P(Senders, RequestCorrelationTableBenchmark, ::testing::Values(1, 8, 64));
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,100 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/network/ResolvedEndpointCache.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+class ResolvedEndpointCacheTest : public ::testing::Test {
+protected:
+    const std::string HOST = "gamelift.example.com:443";
+    const std::chrono::steady_clock::time_point NOW = std::chrono::steady_clock::now();
+};
+
+TEST_F(ResolvedEndpointCacheTest, GIVEN_storedAddresses_WHEN_lookupBeforeTtl_THEN_returnsAddresses) {
+    // GIVEN
+    ResolvedEndpointCache cache(std::chrono::seconds(60));
+    cache.Store(HOST, {"10.0.0.1", "10.0.0.2"}, NOW);
+    // WHEN
+    std::vector<std::string> addresses;
+    bool found = cache.Lookup(HOST, addresses, NOW + std::chrono::seconds(59));
+    // THEN
+    ASSERT_TRUE(found);
+    ASSERT_EQ(addresses, std::vector<std::string>({"10.0.0.1", "10.0.0.2"}));
+}
+
+TEST_F(ResolvedEndpointCacheTest, GIVEN_storedAddresses_WHEN_lookupAfterTtl_THEN_notFound) {
+    // GIVEN
+    ResolvedEndpointCache cache(std::chrono::seconds(60));
+    cache.Store(HOST, {"10.0.0.1"}, NOW);
+    // WHEN
+    std::vector<std::string> addresses;
+    bool found = cache.Lookup(HOST, addresses, NOW + std::chrono::seconds(60));
+    // THEN
+    ASSERT_FALSE(found);
+    ASSERT_TRUE(addresses.empty());
+}
+
+TEST_F(ResolvedEndpointCacheTest, GIVEN_bothFamilies_WHEN_store_THEN_addressesAlternateFamilies) {
+    // GIVEN
+    ResolvedEndpointCache cache;
+    // WHEN
+    std::vector<std::string> ordered = cache.Store(HOST, {"2001:db8::1", "2001:db8::2", "10.0.0.1", "10.0.0.2"}, NOW);
+    // THEN
+    ASSERT_EQ(ordered, std::vector<std::string>({"2001:db8::1", "10.0.0.1", "2001:db8::2", "10.0.0.2"}));
+}
+
+TEST_F(ResolvedEndpointCacheTest, GIVEN_addressConnected_WHEN_prefer_THEN_triedFirstNextTime) {
+    // GIVEN
+    ResolvedEndpointCache cache;
+    cache.Store(HOST, {"10.0.0.1", "10.0.0.2", "10.0.0.3"}, NOW);
+    // WHEN
+    cache.Prefer(HOST, "10.0.0.3");
+    // THEN
+    std::vector<std::string> addresses;
+    ASSERT_TRUE(cache.Lookup(HOST, addresses, NOW));
+    ASSERT_EQ(addresses, std::vector<std::string>({"10.0.0.3", "10.0.0.1", "10.0.0.2"}));
+}
+
+TEST_F(ResolvedEndpointCacheTest, GIVEN_storedAddresses_WHEN_invalidate_THEN_notFound) {
+    // GIVEN
+    ResolvedEndpointCache cache;
+    cache.Store(HOST, {"10.0.0.1"}, NOW);
+    // WHEN
+    cache.Invalidate(HOST);
+    // THEN
+    std::vector<std::string> addresses;
+    ASSERT_FALSE(cache.Lookup(HOST, addresses, NOW));
+}
+
+TEST_F(ResolvedEndpointCacheTest, GIVEN_cacheFull_WHEN_storeNewHost_THEN_leastRecentlyStoredEvicted) {
+    // GIVEN
+    ResolvedEndpointCache cache(std::chrono::seconds(60), 2);
+    cache.Store("first:443", {"10.0.0.1"}, NOW);
+    cache.Store("second:443", {"10.0.0.2"}, NOW);
+    // WHEN
+    cache.Store("third:443", {"10.0.0.3"}, NOW);
+    // THEN
+    std::vector<std::string> addresses;
+    ASSERT_FALSE(cache.Lookup("first:443", addresses, NOW));
+    ASSERT_TRUE(cache.Lookup("second:443", addresses, NOW));
+    ASSERT_TRUE(cache.Lookup("third:443", addresses, NOW));
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,144 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/network/TlsSessionCache.h>
+#include <memory>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+namespace {
+// Stands in for the GameLift endpoint: a server context with a throwaway self-signed certificate
+SSL_CTX *CreateServerContext() {
+    EVP_PKEY *key = nullptr;
+    EVP_PKEY_CTX *keyContext = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+    EVP_PKEY_keygen_init(keyContext);
+    EVP_PKEY_CTX_set_ec_paramgen_curve_nid(keyContext, NID_X9_62_prime256v1);
+    EVP_PKEY_keygen(keyContext, &key);
+    EVP_PKEY_CTX_free(keyContext);
+
+    X509 *certificate = X509_new();
+    ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+    X509_gmtime_adj(X509_getm_notBefore(certificate), 0);
+    X509_gmtime_adj(X509_getm_notAfter(certificate), 60 * 60);
+    X509_set_pubkey(certificate, key);
+    X509_NAME_add_entry_by_txt(X509_get_subject_name(certificate), "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char *>("localhost"), -1, -1, 0);
+    X509_set_issuer_name(certificate, X509_get_subject_name(certificate));
+    X509_sign(certificate, key, EVP_sha256());
+
+    SSL_CTX *serverContext = SSL_CTX_new(TLS_server_method());
+    SSL_CTX_use_certificate(serverContext, certificate);
+    SSL_CTX_use_PrivateKey(serverContext, key);
+    X509_free(certificate);
+    EVP_PKEY_free(key);
+    return serverContext;
+}
+
+// Runs a handshake between a new client and server connection over an in-memory pipe, then lets the client read
+// the tickets the server sends after it. Returns the client connection, or nullptr if the handshake failed.
+std::unique_ptr<SSL, decltype(&SSL_free)> Handshake(SSL_CTX *clientContext, SSL_CTX *serverContext, const char *host, TlsSessionCache &cache) {
+    std::unique_ptr<SSL, decltype(&SSL_free)> client(SSL_new(clientContext), &SSL_free);
+    std::unique_ptr<SSL, decltype(&SSL_free)> server(SSL_new(serverContext), &SSL_free);
+    BIO *clientBio = nullptr;
+    BIO *serverBio = nullptr;
+    BIO_new_bio_pair(&clientBio, 0, &serverBio, 0);
+    SSL_set_bio(client.get(), clientBio, clientBio);
+    SSL_set_bio(server.get(), serverBio, serverBio);
+    SSL_set_connect_state(client.get());
+    SSL_set_accept_state(server.get());
+    SSL_set_tlsext_host_name(client.get(), host);
+    cache.Resume(client.get());
+
+    bool clientDone = false;
+    bool serverDone = false;
+    for (int round = 0; round < 10 && !(clientDone && serverDone); round++) {
+        clientDone = clientDone || SSL_do_handshake(client.get()) == 1;
+        serverDone = serverDone || SSL_do_handshake(server.get()) == 1;
+    }
+    if (!clientDone || !serverDone) {
+        return std::unique_ptr<SSL, decltype(&SSL_free)>(nullptr, &SSL_free);
+    }
+    cache.RecordHandshake(client.get());
+    char buffer[16];
+    SSL_read(client.get(), buffer, sizeof(buffer));
+    return client;
+}
+} // namespace
+
+class TlsSessionCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        serverContext = CreateServerContext();
+        clientContext = SSL_CTX_new(TLS_client_method());
+        cache = std::make_shared<TlsSessionCache>();
+        cache->Attach(clientContext);
+    }
+
+    void TearDown() override {
+        SSL_CTX_free(clientContext);
+        SSL_CTX_free(serverContext);
+    }
+
+    SSL_CTX *serverContext = nullptr;
+    SSL_CTX *clientContext = nullptr;
+    std::shared_ptr<TlsSessionCache> cache;
+};
+
+TEST_F(TlsSessionCacheTest, GIVEN_tls13Connection_WHEN_reconnectToSameHost_THEN_ticketResumedOnce) {
+    // GIVEN
+    ASSERT_TRUE(Handshake(clientContext, serverContext, "localhost", *cache) != nullptr);
+    // WHEN
+    auto resumed = Handshake(clientContext, serverContext, "localhost", *cache);
+    // THEN
+    ASSERT_TRUE(resumed != nullptr);
+    ASSERT_EQ(SSL_version(resumed.get()), TLS1_3_VERSION);
+    ASSERT_EQ(SSL_session_reused(resumed.get()), 1);
+    TlsSessionCache::TlsSessionStats stats = cache->GetStats();
+    ASSERT_EQ(stats.fullHandshakes, 1u);
+    ASSERT_EQ(stats.resumedHandshakes, 1u);
+}
+
+TEST_F(TlsSessionCacheTest, GIVEN_tls12Connection_WHEN_reconnectRepeatedly_THEN_sessionResumedEachTime) {
+    // GIVEN
+    SSL_CTX_set_max_proto_version(clientContext, TLS1_2_VERSION);
+    ASSERT_TRUE(Handshake(clientContext, serverContext, "localhost", *cache) != nullptr);
+    // WHEN
+    auto firstResumed = Handshake(clientContext, serverContext, "localhost", *cache);
+    auto secondResumed = Handshake(clientContext, serverContext, "localhost", *cache);
+    // THEN
+    ASSERT_TRUE(firstResumed != nullptr && secondResumed != nullptr);
+    ASSERT_EQ(SSL_session_reused(firstResumed.get()), 1);
+    ASSERT_EQ(SSL_session_reused(secondResumed.get()), 1);
+    ASSERT_EQ(cache->GetStats().resumedHandshakes, 2u);
+}
+
+TEST_F(TlsSessionCacheTest, GIVEN_sessionForOneHost_WHEN_connectToAnotherHost_THEN_fullHandshake) {
+    // GIVEN
+    ASSERT_TRUE(Handshake(clientContext, serverContext, "localhost", *cache) != nullptr);
+    // WHEN
+    auto other = Handshake(clientContext, serverContext, "other.localhost", *cache);
+    // THEN
+    ASSERT_TRUE(other != nullptr);
+    ASSERT_EQ(SSL_session_reused(other.get()), 0);
+    ASSERT_EQ(cache->GetStats().fullHandshakes, 2u);
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
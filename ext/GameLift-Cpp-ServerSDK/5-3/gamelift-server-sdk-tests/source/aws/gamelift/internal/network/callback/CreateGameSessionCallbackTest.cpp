@@ -53,7 +53,9 @@ TEST_F(CreateGameSessionCallbackTest, GIVEN_createEmptyMessage_WHEN_onStartGameS
         .WillOnce(testing::Invoke(this, &CreateGameSessionCallbackTest::captureGameSessionMessage));
 
     // WHEN
-    createGameSessionCallback->OnStartGameSession(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    createGameSessionCallback->OnStartGameSession(document);
 
     // THEN
 #ifdef GAMELIFT_USE_STD
@@ -72,7 +74,9 @@ TEST_F(CreateGameSessionCallbackTest, GIVEN_createMessage_WHEN_onStartGameSessio
         .WillOnce(testing::Invoke(this, &CreateGameSessionCallbackTest::captureGameSessionMessage));
 
     // WHEN
-    createGameSessionCallback->OnStartGameSession(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    createGameSessionCallback->OnStartGameSession(document);
 
     // THEN
 #ifdef GAMELIFT_USE_STD
@@ -10,9 +10,9 @@
  *
  */
 #include "gtest/gtest.h"
-#include <aws/gamelift/internal/model/response/WebSocketDescribePlayerSessionsResponse.h>
 #include <aws/gamelift/internal/network/MockGameLiftMessageHandler.h>
 #include <aws/gamelift/internal/network/callback/DescribePlayerSessionsCallback.h>
+#include <aws/gamelift/server/model/DescribePlayerSessionsResult.h>
 
 namespace Aws {
 namespace GameLift {
@@ -37,8 +37,10 @@ TEST_F(DescribePlayerSessionsCallbackTest, GIVEN_createEmptyMessage_WHEN_onDescr
     std::string jsonMessage = "{}";
 
     // WHEN
-    GenericOutcome genericOutcome = describePlayerSessionCallback->OnDescribePlayerSessions(jsonMessage);
-    WebSocketDescribePlayerSessionsResponse *response = static_cast<WebSocketDescribePlayerSessionsResponse *>(genericOutcome.GetResult());
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    GenericOutcome genericOutcome = describePlayerSessionCallback->OnDescribePlayerSessions(document);
+    Server::Model::DescribePlayerSessionsResult *response = static_cast<Server::Model::DescribePlayerSessionsResult *>(genericOutcome.GetResult());
 
     // THEN
     EXPECT_EQ(response->GetNextToken(), "");
@@ -52,8 +54,10 @@ TEST_F(DescribePlayerSessionsCallbackTest, GIVEN_createMessage_WHEN_onDescribePl
     std::string jsonMessage = "{\"NextToken\":\"nextToken\",\"PlayerSessions\":[{}]}";
 
     // WHEN
-    GenericOutcome genericOutcome = describePlayerSessionCallback->OnDescribePlayerSessions(jsonMessage);
-    WebSocketDescribePlayerSessionsResponse *response = static_cast<WebSocketDescribePlayerSessionsResponse *>(genericOutcome.GetResult());
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    GenericOutcome genericOutcome = describePlayerSessionCallback->OnDescribePlayerSessions(document);
+    Server::Model::DescribePlayerSessionsResult *response = static_cast<Server::Model::DescribePlayerSessionsResult *>(genericOutcome.GetResult());
 
     // THEN
     EXPECT_EQ(response->GetNextToken(), "nextToken");
@@ -27,7 +27,9 @@ TEST_F(GetComputeCertificateCallbackTest, GIVEN_createEmptyMessage_WHEN_onGetCom
     std::string jsonMessage = "{}";
 
     // WHEN
-    GenericOutcome genericOutcome = getComputeCertificateCallback.OnGetComputeCertificateCallback(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    GenericOutcome genericOutcome = getComputeCertificateCallback.OnGetComputeCertificateCallback(document);
     std::unique_ptr<WebSocketGetComputeCertificateResponse> response(static_cast<WebSocketGetComputeCertificateResponse *>(genericOutcome.GetResult()));
 
     // THEN
@@ -43,7 +45,9 @@ TEST_F(GetComputeCertificateCallbackTest, GIVEN_createMessage_WHEN_onGetComputeC
     std::string jsonMessage = ss.str();
 
     // WHEN
-    GenericOutcome genericOutcome = getComputeCertificateCallback.OnGetComputeCertificateCallback(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    GenericOutcome genericOutcome = getComputeCertificateCallback.OnGetComputeCertificateCallback(document);
     std::unique_ptr<WebSocketGetComputeCertificateResponse> response(static_cast<WebSocketGetComputeCertificateResponse *>(genericOutcome.GetResult()));
 
     // THEN
@@ -27,7 +27,9 @@ TEST_F(GetFleetRoleCredentialsCallbackTest, GIVEN_createEmptyMessage_WHEN_onGetF
     std::string jsonMessage = "{}";
 
     // WHEN
-    GenericOutcome genericOutcome = getFleetRoleCredentialsCallback.OnGetFleetRoleCredentials(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    GenericOutcome genericOutcome = getFleetRoleCredentialsCallback.OnGetFleetRoleCredentials(document);
     std::unique_ptr<WebSocketGetFleetRoleCredentialsResponse> response(static_cast<WebSocketGetFleetRoleCredentialsResponse *>(genericOutcome.GetResult()));
 
     // THEN
@@ -51,7 +53,9 @@ TEST_F(GetFleetRoleCredentialsCallbackTest, GIVEN_createMessage_WHEN_onGetFleetR
     std::string jsonMessage = ss.str();
 
     // WHEN
-    GenericOutcome genericOutcome = getFleetRoleCredentialsCallback.OnGetFleetRoleCredentials(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    GenericOutcome genericOutcome = getFleetRoleCredentialsCallback.OnGetFleetRoleCredentials(document);
     std::unique_ptr<WebSocketGetFleetRoleCredentialsResponse> response(static_cast<WebSocketGetFleetRoleCredentialsResponse *>(genericOutcome.GetResult()));
 
     // THEN
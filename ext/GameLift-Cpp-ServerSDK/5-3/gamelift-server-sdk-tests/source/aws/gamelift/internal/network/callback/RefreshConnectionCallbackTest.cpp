@@ -55,7 +55,9 @@ TEST_F(RefreshConnectionCallbackTest, GIVEN_createEmptyMessage_WHEN_onRefreshCon
         .WillOnce(testing::Invoke(this, &RefreshConnectionCallbackTest::captureRefreshConnectionEndpointAndAuthToken));
 
     // WHEN
-    refreshConnectionCallback->OnRefreshConnection(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    refreshConnectionCallback->OnRefreshConnection(document);
 
     // THEN
     EXPECT_THAT(capturedRefreshConnectionEndpoint, "");
@@ -70,7 +72,9 @@ TEST_F(RefreshConnectionCallbackTest, GIVEN_createMessage_WHEN_onRefreshConnecti
         .WillOnce(testing::Invoke(this, &RefreshConnectionCallbackTest::captureRefreshConnectionEndpointAndAuthToken));
 
     // WHEN
-    refreshConnectionCallback->OnRefreshConnection(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    refreshConnectionCallback->OnRefreshConnection(document);
 
     // THEN
     EXPECT_THAT(capturedRefreshConnectionEndpoint, "endpoint");
@@ -37,7 +37,9 @@ TEST_F(StartMatchBackfillCallbackTest, GIVEN_createEmptyMessage_WHEN_onStartMatc
     std::string jsonMessage = "{}";
 
     // WHEN
-    GenericOutcome genericOutcome = startMatchBackfillCallback->OnStartMatchBackfill(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    GenericOutcome genericOutcome = startMatchBackfillCallback->OnStartMatchBackfill(document);
     WebSocketStartMatchBackfillResponse *response = static_cast<WebSocketStartMatchBackfillResponse *>(genericOutcome.GetResult());
 
     // THEN
@@ -51,7 +53,9 @@ TEST_F(StartMatchBackfillCallbackTest, GIVEN_createMessage_WHEN_onStartMatchBack
     std::string jsonMessage = "{\"TicketId\":\"ticketId\"}";
 
     // WHEN
-    GenericOutcome genericOutcome = startMatchBackfillCallback->OnStartMatchBackfill(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    GenericOutcome genericOutcome = startMatchBackfillCallback->OnStartMatchBackfill(document);
     WebSocketStartMatchBackfillResponse *response = static_cast<WebSocketStartMatchBackfillResponse *>(genericOutcome.GetResult());
 
     // THEN
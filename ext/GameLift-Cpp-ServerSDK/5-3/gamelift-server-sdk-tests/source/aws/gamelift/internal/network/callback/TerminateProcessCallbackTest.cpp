@@ -48,7 +48,9 @@ TEST_F(TerminateProcessCallbackTest, GIVEN_createEmptyMessage_WHEN_onTerminatePr
         .WillOnce(testing::Invoke(this, &TerminateProcessCallbackTest::captureTerminationTime));
 
     // WHEN
-    terminateProcessCallback->OnTerminateProcess(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    terminateProcessCallback->OnTerminateProcess(document);
 
     // THEN
     EXPECT_THAT(capturedTerminationTime, -1);
@@ -61,7 +63,9 @@ TEST_F(TerminateProcessCallbackTest, GIVEN_createMessage_WHEN_onTerminateProcess
         .WillOnce(testing::Invoke(this, &TerminateProcessCallbackTest::captureTerminationTime));
 
     // WHEN
-    terminateProcessCallback->OnTerminateProcess(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    terminateProcessCallback->OnTerminateProcess(document);
 
     // THEN
     EXPECT_THAT(capturedTerminationTime, 10000);
@@ -53,7 +53,9 @@ TEST_F(UpdateGameSessionCallbackTest, GIVEN_updateEmptyMessage_WHEN_onUpdateGame
         .WillOnce(testing::Invoke(this, &UpdateGameSessionCallbackTest::captureUpdateGameSessionMessage));
 
     // WHEN
-    updateGameSessionCallback->OnUpdateGameSession(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    updateGameSessionCallback->OnUpdateGameSession(document);
 
     // THEN
 #ifdef GAMELIFT_USE_STD
@@ -72,7 +74,9 @@ TEST_F(UpdateGameSessionCallbackTest, GIVEN_updateMessage_WHEN_onUpdateGameSessi
         .WillOnce(testing::Invoke(this, &UpdateGameSessionCallbackTest::captureUpdateGameSessionMessage));
 
     // WHEN
-    updateGameSessionCallback->OnUpdateGameSession(jsonMessage);
+    rapidjson::Document document;
+    document.Parse(jsonMessage.c_str());
+    updateGameSessionCallback->OnUpdateGameSession(document);
 
     // THEN
 #ifdef GAMELIFT_USE_STD
@@ -0,0 +1,67 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/retry/CircuitBreaker.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+TEST(CircuitBreakerTest, GIVEN_closedBreaker_WHEN_failuresReachThreshold_THEN_opensAndRejectsAttempts) {
+    // GIVEN
+    CircuitBreaker circuitBreaker(3, milliseconds(1000), 1);
+    const steady_clock::time_point start = steady_clock::now();
+    // WHEN
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(circuitBreaker.TryAcquire(start));
+        circuitBreaker.RecordFailure(start);
+    }
+    // THEN
+    ASSERT_FALSE(circuitBreaker.TryAcquire(start + milliseconds(500)));
+    CircuitBreaker::CircuitBreakerStats stats = circuitBreaker.GetStats();
+    ASSERT_EQ(stats.state, CircuitBreaker::State::OPEN);
+    ASSERT_EQ(stats.timesOpened, 1u);
+    ASSERT_EQ(stats.rejectedAttempts, 1u);
+}
+
+TEST(CircuitBreakerTest, GIVEN_openBreaker_WHEN_openDurationPasses_THEN_oneProbeDecidesWhetherItCloses) {
+    // GIVEN
+    CircuitBreaker circuitBreaker(1, milliseconds(1000), 1);
+    const steady_clock::time_point start = steady_clock::now();
+    circuitBreaker.TryAcquire(start);
+    circuitBreaker.RecordFailure(start);
+    // WHEN
+    const bool firstProbe = circuitBreaker.TryAcquire(start + milliseconds(1000));
+    const bool secondProbe = circuitBreaker.TryAcquire(start + milliseconds(1000));
+    circuitBreaker.RecordFailure(start + milliseconds(1100));
+    const bool afterFailedProbe = circuitBreaker.TryAcquire(start + milliseconds(1500));
+    const bool nextProbe = circuitBreaker.TryAcquire(start + milliseconds(2100));
+    circuitBreaker.RecordSuccess();
+    // THEN
+    ASSERT_TRUE(firstProbe);
+    ASSERT_FALSE(secondProbe);
+    ASSERT_FALSE(afterFailedProbe);
+    ASSERT_TRUE(nextProbe);
+    ASSERT_TRUE(circuitBreaker.TryAcquire(start + milliseconds(2100)));
+    ASSERT_EQ(circuitBreaker.GetStats().state, CircuitBreaker::State::CLOSED);
+    ASSERT_EQ(circuitBreaker.GetStats().timesOpened, 2u);
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
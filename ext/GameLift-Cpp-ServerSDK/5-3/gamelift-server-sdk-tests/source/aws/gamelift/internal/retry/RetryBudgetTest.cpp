@@ -0,0 +1,53 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/retry/RetryBudget.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+TEST(RetryBudgetTest, GIVEN_spentBudget_WHEN_attemptsSucceed_THEN_retriesAllowedInProportion) {
+    // GIVEN
+    RetryBudget retryBudget(2, 4);
+    ASSERT_TRUE(retryBudget.TryAcquireRetry());
+    ASSERT_TRUE(retryBudget.TryAcquireRetry());
+    ASSERT_FALSE(retryBudget.TryAcquireRetry());
+    // WHEN
+    for (int i = 0; i < 4; i++) {
+        retryBudget.RecordSuccess();
+    }
+    // THEN
+    ASSERT_TRUE(retryBudget.TryAcquireRetry());
+    ASSERT_FALSE(retryBudget.TryAcquireRetry());
+    RetryBudget::RetryBudgetStats stats = retryBudget.GetStats();
+    ASSERT_EQ(stats.retriesAllowed, 3u);
+    ASSERT_EQ(stats.retriesDenied, 2u);
+}
+
+TEST(RetryBudgetTest, GIVEN_fullBudget_WHEN_attemptsSucceed_THEN_tokensStayAtMaximum) {
+    // GIVEN
+    RetryBudget retryBudget(2, 4);
+    // WHEN
+    for (int i = 0; i < 100; i++) {
+        retryBudget.RecordSuccess();
+    }
+    // THEN
+    ASSERT_DOUBLE_EQ(retryBudget.GetStats().tokens, 2.0);
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,183 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/retry/RetryStrategy.h>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+class FixedDelayRetryStrategy : public RetryStrategy {
+public:
+    explicit FixedDelayRetryStrategy(int maxAttempts) : m_maxAttempts(maxAttempts) {}
+
+protected:
+    int getRetryDelayMillis(int retry) override { return retry < m_maxAttempts ? 100 : -1; }
+
+private:
+    int m_maxAttempts;
+};
+
+TEST(RetryStrategyTest, GIVEN_eventuallySucceedingAttempt_WHEN_applyAsync_THEN_retriesOnTimersUntilSuccess) {
+    // GIVEN
+    TimerScheduler scheduler;
+    std::shared_ptr<RetryStrategy> retryStrategy = std::make_shared<FixedDelayRetryStrategy>(5);
+    int attempts = 0;
+    std::vector<RetryStrategy::AttemptResult> results;
+    steady_clock::time_point start = steady_clock::now();
+    // WHEN
+    RetryStrategy::applyAsync(
+        retryStrategy, scheduler,
+        [&attempts](const std::function<void(RetryStrategy::AttemptResult)> &attemptComplete) {
+            attemptComplete(++attempts == 3 ? RetryStrategy::AttemptResult::ANSWERED : RetryStrategy::AttemptResult::FAILED_RETRIABLE);
+        },
+        [&results](RetryStrategy::AttemptResult result) { results.push_back(result); });
+    int attemptsBeforeTimers = attempts;
+    scheduler.RunDueTimers(start + milliseconds(150));
+    int attemptsAfterFirstRetry = attempts;
+    scheduler.RunDueTimers(start + milliseconds(300));
+    // THEN
+    ASSERT_EQ(attemptsBeforeTimers, 1);
+    ASSERT_EQ(attemptsAfterFirstRetry, 2);
+    ASSERT_EQ(attempts, 3);
+    ASSERT_EQ(results, std::vector<RetryStrategy::AttemptResult>({RetryStrategy::AttemptResult::ANSWERED}));
+    ASSERT_EQ(scheduler.GetPendingTimerCount(), 0u);
+}
+
+TEST(RetryStrategyTest, GIVEN_alwaysFailingAttempt_WHEN_applyAsync_THEN_completesWithFailureAfterLastRetry) {
+    // GIVEN
+    TimerScheduler scheduler;
+    std::shared_ptr<RetryStrategy> retryStrategy = std::make_shared<FixedDelayRetryStrategy>(3);
+    int attempts = 0;
+    std::vector<RetryStrategy::AttemptResult> results;
+    steady_clock::time_point start = steady_clock::now();
+    // WHEN
+    RetryStrategy::applyAsync(
+        retryStrategy, scheduler,
+        [&attempts](const std::function<void(RetryStrategy::AttemptResult)> &attemptComplete) {
+            ++attempts;
+            attemptComplete(RetryStrategy::AttemptResult::FAILED_RETRIABLE);
+        },
+        [&results](RetryStrategy::AttemptResult result) { results.push_back(result); });
+    for (int elapsed = 0; elapsed <= 1000; elapsed += 50) {
+        scheduler.RunDueTimers(start + milliseconds(elapsed));
+    }
+    // THEN
+    ASSERT_EQ(attempts, 3);
+    ASSERT_EQ(results, std::vector<RetryStrategy::AttemptResult>({RetryStrategy::AttemptResult::FAILED_RETRIABLE}));
+}
+
+TEST(RetryStrategyTest, GIVEN_serviceFailuresNotWorthRetrying_WHEN_applyAsync_THEN_notRetriedButBreakerOpensAndBudgetNotRefilled) {
+    // GIVEN
+    TimerScheduler scheduler;
+    std::shared_ptr<RetryBudget> retryBudget = std::make_shared<RetryBudget>(1, 1);
+    std::shared_ptr<CircuitBreaker> circuitBreaker = std::make_shared<CircuitBreaker>(2, milliseconds(60000), 1);
+    ASSERT_TRUE(retryBudget->TryAcquireRetry());
+    int attempts = 0;
+    // WHEN
+    for (int i = 0; i < 2; i++) {
+        std::shared_ptr<RetryStrategy> retryStrategy = std::make_shared<FixedDelayRetryStrategy>(5);
+        retryStrategy->SetRetryBudget(retryBudget);
+        retryStrategy->SetCircuitBreaker(circuitBreaker);
+        RetryStrategy::applyAsync(
+            retryStrategy, scheduler,
+            [&attempts](const std::function<void(RetryStrategy::AttemptResult)> &attemptComplete) {
+                ++attempts;
+                attemptComplete(RetryStrategy::AttemptResult::FAILED);
+            },
+            [](RetryStrategy::AttemptResult) {});
+    }
+    // THEN
+    ASSERT_EQ(attempts, 2);
+    ASSERT_EQ(scheduler.GetPendingTimerCount(), 0u);
+    ASSERT_EQ(circuitBreaker->GetStats().state, CircuitBreaker::State::OPEN);
+    ASSERT_EQ(retryBudget->GetStats().tokens, 0.0);
+}
+
+TEST(RetryStrategyTest, GIVEN_halfOpenBreaker_WHEN_probeNeverSent_THEN_breakerStaysHalfOpenAndNextProbeGoesOut) {
+    // GIVEN
+    TimerScheduler scheduler;
+    std::shared_ptr<RetryBudget> retryBudget = std::make_shared<RetryBudget>(1, 1);
+    std::shared_ptr<CircuitBreaker> circuitBreaker = std::make_shared<CircuitBreaker>(1, milliseconds(0), 1);
+    ASSERT_TRUE(circuitBreaker->TryAcquire());
+    circuitBreaker->RecordFailure();
+    ASSERT_TRUE(retryBudget->TryAcquireRetry());
+    std::vector<RetryStrategy::AttemptResult> results;
+    const std::function<void(RetryStrategy::AttemptResult)> recordResult = [&results](RetryStrategy::AttemptResult result) { results.push_back(result); };
+    // WHEN
+    std::shared_ptr<RetryStrategy> retryStrategy = std::make_shared<FixedDelayRetryStrategy>(5);
+    retryStrategy->SetRetryBudget(retryBudget);
+    retryStrategy->SetCircuitBreaker(circuitBreaker);
+    RetryStrategy::applyAsync(
+        retryStrategy, scheduler,
+        [](const std::function<void(RetryStrategy::AttemptResult)> &attemptComplete) { attemptComplete(RetryStrategy::AttemptResult::NOT_SENT); },
+        recordResult);
+    RetryStrategy::applyAsync(
+        retryStrategy, scheduler,
+        [](const std::function<void(RetryStrategy::AttemptResult)> &attemptComplete) { attemptComplete(RetryStrategy::AttemptResult::NOT_SENT); },
+        recordResult);
+    // THEN
+    // Neither attempt reached the service, so neither closed the breaker or refilled the budget, and neither held on to the probe
+    ASSERT_EQ(results, std::vector<RetryStrategy::AttemptResult>({RetryStrategy::AttemptResult::NOT_SENT, RetryStrategy::AttemptResult::NOT_SENT}));
+    ASSERT_EQ(circuitBreaker->GetStats().state, CircuitBreaker::State::HALF_OPEN);
+    ASSERT_EQ(circuitBreaker->GetStats().rejectedAttempts, 0u);
+    ASSERT_EQ(retryBudget->GetStats().tokens, 0.0);
+    ASSERT_EQ(scheduler.GetPendingTimerCount(), 0u);
+}
+
+TEST(RetryStrategyTest, GIVEN_sharedBudgetAndBreaker_WHEN_callsKeepFailing_THEN_retriesCappedAndLaterCallsFailFast) {
+    // GIVEN
+    std::shared_ptr<RetryBudget> retryBudget = std::make_shared<RetryBudget>(1, 10);
+    std::shared_ptr<CircuitBreaker> circuitBreaker = std::make_shared<CircuitBreaker>(2, milliseconds(60000), 1);
+    int calls = 0;
+    const std::function<bool(void)> failingCall = [&calls] {
+        ++calls;
+        return false;
+    };
+    // WHEN
+    for (int i = 0; i < 3; i++) {
+        FixedDelayRetryStrategy retryStrategy(5);
+        retryStrategy.SetRetryBudget(retryBudget);
+        retryStrategy.SetCircuitBreaker(circuitBreaker);
+        retryStrategy.apply(failingCall);
+    }
+    // THEN
+    // One attempt and the one retry the budget pays for, then the breaker is open for the rest
+    ASSERT_EQ(calls, 2);
+    ASSERT_EQ(retryBudget->GetStats().retriesAllowed, 1u);
+    ASSERT_EQ(circuitBreaker->GetStats().state, CircuitBreaker::State::OPEN);
+    ASSERT_EQ(circuitBreaker->GetStats().rejectedAttempts, 2u);
+}
+
+TEST(RetryStrategyTest, GIVEN_alwaysFailingCallable_WHEN_apply_THEN_stopsWhenRetriesRunOut) {
+    // GIVEN
+    FixedDelayRetryStrategy retryStrategy(3);
+    int calls = 0;
+    // WHEN
+    retryStrategy.apply([&calls] {
+        ++calls;
+        return false;
+    });
+    // THEN
+    ASSERT_EQ(calls, 3);
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
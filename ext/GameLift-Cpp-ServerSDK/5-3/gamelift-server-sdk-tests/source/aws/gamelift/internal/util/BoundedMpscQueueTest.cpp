@@ -0,0 +1,126 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/util/BoundedMpscQueue.h>
+#include <thread>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+namespace {
+// Counts copies so tests can tell a moved value from a copied one
+struct CopyCountingValue {
+    CopyCountingValue() : copies(0) {}
+    CopyCountingValue(const CopyCountingValue &other) : copies(other.copies + 1) {}
+    CopyCountingValue(CopyCountingValue &&other) : copies(other.copies) {}
+    CopyCountingValue &operator=(const CopyCountingValue &other) {
+        copies = other.copies + 1;
+        return *this;
+    }
+    CopyCountingValue &operator=(CopyCountingValue &&other) {
+        copies = other.copies;
+        return *this;
+    }
+    int copies;
+};
+} // namespace
+
+TEST(BoundedMpscQueueTest, GIVEN_capacity_WHEN_construct_THEN_roundedUpToPowerOfTwo) {
+    ASSERT_EQ(BoundedMpscQueue<int>(1).GetCapacity(), 1u);
+    ASSERT_EQ(BoundedMpscQueue<int>(5).GetCapacity(), 8u);
+    ASSERT_EQ(BoundedMpscQueue<int>(64).GetCapacity(), 64u);
+}
+
+TEST(BoundedMpscQueueTest, GIVEN_pushedValues_WHEN_consume_THEN_consumedInPushOrder) {
+    // GIVEN
+    BoundedMpscQueue<int> queue(4);
+    std::vector<int> consumed;
+    // WHEN
+    // Push and consume past the capacity so the positions wrap around
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(queue.TryPush(int(i)));
+        ASSERT_TRUE(queue.TryConsume([&consumed](int &value) { consumed.push_back(value); }));
+    }
+    // THEN
+    ASSERT_EQ(consumed, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    ASSERT_FALSE(queue.TryConsume([](int &) { FAIL(); }));
+}
+
+TEST(BoundedMpscQueueTest, GIVEN_fullQueue_WHEN_push_THEN_rejectedUntilConsumed) {
+    // GIVEN
+    BoundedMpscQueue<int> queue(2);
+    ASSERT_TRUE(queue.TryPush(1));
+    ASSERT_TRUE(queue.TryPush(2));
+    // WHEN / THEN
+    ASSERT_FALSE(queue.TryPush(3));
+    ASSERT_TRUE(queue.TryConsume([](int &value) { ASSERT_EQ(value, 1); }));
+    ASSERT_TRUE(queue.TryPush(3));
+    ASSERT_TRUE(queue.TryConsume([](int &value) { ASSERT_EQ(value, 2); }));
+    ASSERT_TRUE(queue.TryConsume([](int &value) { ASSERT_EQ(value, 3); }));
+}
+
+TEST(BoundedMpscQueueTest, GIVEN_value_WHEN_pushAndConsume_THEN_neverCopied) {
+    // GIVEN
+    BoundedMpscQueue<CopyCountingValue> queue(2);
+    int copies = -1;
+    // WHEN
+    ASSERT_TRUE(queue.TryPush(CopyCountingValue()));
+    ASSERT_TRUE(queue.TryConsume([&copies](CopyCountingValue &value) { copies = value.copies; }));
+    // THEN
+    ASSERT_EQ(copies, 0);
+}
+
+TEST(BoundedMpscQueueTest, GIVEN_manyProducers_WHEN_pushConcurrently_THEN_everyValueConsumedOnceInPerProducerOrder) {
+    // GIVEN
+    const int producerCount = 4;
+    const int valuesPerProducer = 10000;
+    BoundedMpscQueue<int> queue(16);
+    std::vector<int> lastConsumed(producerCount, -1);
+    int consumedCount = 0;
+    // WHEN
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producerCount; producer++) {
+        producers.emplace_back([&queue, producer, valuesPerProducer] {
+            for (int i = 0; i < valuesPerProducer; i++) {
+                while (!queue.TryPush(producer * valuesPerProducer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    bool inOrder = true;
+    while (consumedCount < producerCount * valuesPerProducer) {
+        queue.TryConsume([&](int &value) {
+            const int producer = value / valuesPerProducer;
+            const int sequence = value % valuesPerProducer;
+            inOrder = inOrder && sequence == lastConsumed[producer] + 1;
+            lastConsumed[producer] = sequence;
+            consumedCount++;
+        });
+    }
+    for (std::thread &producer : producers) {
+        producer.join();
+    }
+    // THEN
+    ASSERT_TRUE(inOrder);
+    ASSERT_EQ(lastConsumed, std::vector<int>(producerCount, valuesPerProducer - 1));
+    ASSERT_FALSE(queue.TryConsume([](int &) {}));
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,162 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <aws/gamelift/internal/util/CallbackExecutor.h>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+using std::chrono::milliseconds;
+
+namespace {
+// Counts copies so tests can tell a moved payload from a copied one
+struct CopyCountingPayload {
+    CopyCountingPayload() : copies(0) {}
+    CopyCountingPayload(const CopyCountingPayload &other) : copies(other.copies + 1) {}
+    CopyCountingPayload(CopyCountingPayload &&other) : copies(other.copies) {}
+    int copies;
+};
+} // namespace
+
+TEST(CallbackExecutorTest, GIVEN_singleWorker_WHEN_submit_THEN_callbacksRunInArrivalOrderOffCallingThread) {
+    // GIVEN
+    CallbackExecutor executor;
+    executor.Start();
+    std::vector<int> ran;
+    std::promise<void> done;
+    std::atomic<bool> ranOnCaller(false);
+    const std::thread::id caller = std::this_thread::get_id();
+    // WHEN
+    for (int i = 0; i < 5; i++) {
+        executor.Submit("test", [&, i] {
+            // The first callback is slow so a later one would overtake it if order weren't kept
+            if (i == 0) {
+                std::this_thread::sleep_for(milliseconds(50));
+            }
+            ranOnCaller = ranOnCaller || std::this_thread::get_id() == caller;
+            ran.push_back(i);
+            if (i == 4) {
+                done.set_value();
+            }
+        });
+    }
+    // THEN
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(ran, std::vector<int>({0, 1, 2, 3, 4}));
+    ASSERT_FALSE(ranOnCaller);
+}
+
+TEST(CallbackExecutorTest, GIVEN_twoWorkers_WHEN_callbackBlocks_THEN_nextCallbackStillRuns) {
+    // GIVEN
+    CallbackExecutor executor;
+    executor.Start(2);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> secondRan;
+    // WHEN
+    executor.Submit("blocking", [released] { released.wait(); });
+    executor.Submit("second", [&secondRan] { secondRan.set_value(); });
+    // THEN
+    ASSERT_EQ(secondRan.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    release.set_value();
+}
+
+TEST(CallbackExecutorTest, GIVEN_payload_WHEN_movePayloadInto_THEN_payloadReachesCallbackWithoutCopy) {
+    // GIVEN
+    CallbackExecutor executor;
+    executor.Start();
+    std::promise<int> copies;
+    std::function<void(CopyCountingPayload)> callback = [&copies](CopyCountingPayload payload) { copies.set_value(payload.copies); };
+    CopyCountingPayload payload;
+    // WHEN
+    executor.Submit("payload", CallbackExecutor::MovePayloadInto(callback, std::move(payload)));
+    // THEN
+    std::future<int> future = copies.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(future.get(), 0);
+}
+
+TEST(CallbackExecutorTest, GIVEN_slowCallback_WHEN_itReturns_THEN_executionTimeReported) {
+    // GIVEN
+    std::shared_ptr<TimerScheduler> scheduler = std::make_shared<TimerScheduler>();
+    scheduler->Start();
+    CallbackExecutor executor(scheduler);
+    executor.Start(1, milliseconds(20));
+    std::promise<void> done;
+    // WHEN
+    executor.Submit("slow", [] { std::this_thread::sleep_for(milliseconds(60)); });
+    executor.Submit("fast", [&done] { done.set_value(); });
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    executor.Stop();
+    // THEN
+    CallbackExecutor::CallbackStats stats = executor.GetStats();
+    ASSERT_EQ(stats.completedCallbacks, 2u);
+    ASSERT_EQ(stats.slowCallbacks, 1u);
+    ASSERT_GE(stats.maxExecutionTime, milliseconds(60));
+    ASSERT_GE(stats.totalExecutionTime, stats.maxExecutionTime);
+    ASSERT_EQ(scheduler->GetPendingTimerCount(), 0u);
+}
+
+TEST(CallbackExecutorTest, GIVEN_unstartedExecutor_WHEN_runQueuedCallbacks_THEN_queuedCallbacksRunOnCallingThread) {
+    // GIVEN
+    CallbackExecutor executor;
+    std::vector<int> ran;
+    bool ranOnCaller = true;
+    const std::thread::id caller = std::this_thread::get_id();
+    executor.Submit("first", [&] {
+        ran.push_back(1);
+        ranOnCaller = ranOnCaller && std::this_thread::get_id() == caller;
+        // Queued while running, so it waits for the next call
+        executor.Submit("third", [&ran] { ran.push_back(3); });
+    });
+    executor.Submit("second", [&ran] { ran.push_back(2); });
+    // WHEN
+    const std::size_t firstRun = executor.RunQueuedCallbacks();
+    const std::size_t secondRun = executor.RunQueuedCallbacks();
+    // THEN
+    ASSERT_EQ(firstRun, 2u);
+    ASSERT_EQ(secondRun, 1u);
+    ASSERT_EQ(ran, std::vector<int>({1, 2, 3}));
+    ASSERT_TRUE(ranOnCaller);
+    ASSERT_EQ(executor.GetQueuedCallbackCount(), 0u);
+}
+
+TEST(CallbackExecutorTest, GIVEN_callbackThatStopsExecutor_WHEN_run_THEN_noDeadlockAndQueuedCallbacksDiscarded) {
+    // GIVEN
+    std::unique_ptr<CallbackExecutor> executor(new CallbackExecutor());
+    std::promise<void> stopped;
+    std::atomic<bool> laterRan(false);
+    // WHEN
+    executor->Submit("stop", [&] {
+        // Mirrors an OnProcessTerminate that calls Destroy()
+        executor.reset();
+        stopped.set_value();
+    });
+    executor->Submit("later", [&laterRan] { laterRan = true; });
+    executor->Start();
+    // THEN
+    ASSERT_EQ(stopped.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    std::this_thread::sleep_for(milliseconds(50));
+    ASSERT_FALSE(laterRan);
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,209 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
+#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+static_assert(JsonKeyHash("GameSessionId") != JsonKeyHash("GameSessionID"), "Keys differing in case should hash differently");
+
+struct TestBase {
+    std::string action;
+    int count = 0;
+
+    static const JsonFieldTable<TestBase> &GetJsonFields() {
+        typedef JsonField<TestBase> Field;
+        static const Field fields[] = {
+            Field::String<&TestBase::action>("Action"),
+            Field::Int<&TestBase::count>("Count"),
+        };
+        static const JsonFieldTable<TestBase> table(fields);
+        return table;
+    }
+};
+
+struct TestDerived : TestBase {
+    std::string name;
+    bool enabled = false;
+    std::map<std::string, std::string> properties;
+
+    static const JsonFieldTable<TestDerived> &GetJsonFields() {
+        typedef JsonField<TestDerived> Field;
+        static const Field fields[] = {
+            Field::String<&TestDerived::name>("Name"),
+            Field::Bool<&TestDerived::enabled>("Enabled"),
+            Field::StringMap<&TestDerived::properties>("Properties"),
+        };
+        static const JsonFieldTable<TestDerived> table(fields, TestBase::GetJsonFields());
+        return table;
+    }
+};
+
+static std::string Serialize(const TestDerived &object) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    TestDerived::GetJsonFields().Serialize(object, &writer);
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+TEST(JsonFieldTableTest, GIVEN_key_WHEN_hashAtRuntime_THEN_matchesCompileTimeHash) {
+    // GIVEN
+    constexpr std::uint32_t compileTimeHash = JsonKeyHash("PlayerSessionId");
+    const std::string key = "PlayerSessionId";
+    // WHEN
+    std::uint32_t runtimeHash = JsonKeyHash(key.c_str(), key.length());
+    // THEN
+    ASSERT_EQ(runtimeHash, compileTimeHash);
+}
+
+TEST(JsonFieldTableTest, GIVEN_derivedObject_WHEN_serialize_THEN_baseFieldsWrittenFirst) {
+    // GIVEN
+    TestDerived object;
+    object.action = "Test";
+    object.count = 3;
+    object.name = "name";
+    object.enabled = true;
+    object.properties["key"] = "value";
+    // WHEN
+    std::string json = Serialize(object);
+    // THEN
+    ASSERT_EQ(json, "{\"Action\":\"Test\",\"Count\":3,\"Name\":\"name\",\"Enabled\":true,\"Properties\":{\"key\":\"value\"}}");
+}
+
+TEST(JsonFieldTableTest, GIVEN_defaultObject_WHEN_serialize_THEN_onlyAlwaysWrittenFieldsPresent) {
+    // GIVEN
+    TestDerived object;
+    object.count = -1;
+    // WHEN
+    std::string json = Serialize(object);
+    // THEN
+    ASSERT_EQ(json, "{\"Enabled\":false,\"Properties\":{}}");
+}
+
+TEST(JsonFieldTableTest, GIVEN_membersInAnyOrder_WHEN_deserialize_THEN_baseAndDerivedFieldsRead) {
+    // GIVEN
+    rapidjson::Document document;
+    document.Parse("{\"Properties\":{\"a\":\"b\",\"n\":1},\"Unknown\":7,\"Enabled\":true,\"Count\":12,\"Name\":\"name\",\"Action\":\"Test\"}");
+    TestDerived object;
+    // WHEN
+    bool result = TestDerived::GetJsonFields().Deserialize(object, document);
+    // THEN
+    ASSERT_TRUE(result);
+    ASSERT_EQ(object.action, "Test");
+    ASSERT_EQ(object.count, 12);
+    ASSERT_EQ(object.name, "name");
+    ASSERT_TRUE(object.enabled);
+    ASSERT_EQ(object.properties.size(), 1u);
+    ASSERT_EQ(object.properties["a"], "b");
+}
+
+TEST(JsonFieldTableTest, GIVEN_populatedObject_WHEN_deserializeWithMissingFields_THEN_missingFieldsReset) {
+    // GIVEN
+    TestDerived object;
+    object.action = "Old";
+    object.count = 5;
+    object.name = "old";
+    object.enabled = true;
+    object.properties["old"] = "old";
+    rapidjson::Document document;
+    document.Parse("{\"Name\":\"new\"}");
+    // WHEN
+    TestDerived::GetJsonFields().Deserialize(object, document);
+    // THEN
+    ASSERT_EQ(object.action, "");
+    ASSERT_EQ(object.count, -1);
+    ASSERT_EQ(object.name, "new");
+    ASSERT_FALSE(object.enabled);
+    ASSERT_TRUE(object.properties.empty());
+}
+
+TEST(JsonFieldTableTest, GIVEN_wrongMemberTypes_WHEN_deserialize_THEN_fieldsDefaulted) {
+    // GIVEN
+    rapidjson::Document document;
+    document.Parse("{\"Action\":1,\"Count\":\"1\",\"Enabled\":\"true\",\"Properties\":[]}");
+    TestDerived object;
+    // WHEN
+    TestDerived::GetJsonFields().Deserialize(object, document);
+    // THEN
+    ASSERT_EQ(object.action, "");
+    ASSERT_EQ(object.count, -1);
+    ASSERT_FALSE(object.enabled);
+    ASSERT_TRUE(object.properties.empty());
+}
+
+// Microbenchmark comparing the table's single pass against a FindMember lookup per field, which is how
+// the models deserialized before. Throughput is printed rather than asserted since it depends on the host.
+class JsonFieldTableBenchmark : public ::testing::TestWithParam<int> {
+protected:
+    static constexpr const int ITERATIONS = 20000;
+};
+
+TEST_P(JsonFieldTableBenchmark, GIVEN_unknownMembersFirst_WHEN_deserialize_THEN_reportThroughput) {
+    // GIVEN
+    const int unknownMemberCount = GetParam();
+    std::string json = "{";
+    for (int i = 0; i < unknownMemberCount; i++) {
+        json += "\"Unknown" + std::to_string(i) + "\":" + std::to_string(i) + ",";
+    }
+    json += "\"Action\":\"Test\",\"Count\":3,\"Name\":\"name\",\"Enabled\":true,\"Properties\":{\"key\":\"value\"}}";
+    rapidjson::Document document;
+    document.Parse(json.c_str());
+    TestDerived tableObject;
+    TestDerived lookupObject;
+
+    // WHEN
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        TestDerived::GetJsonFields().Deserialize(tableObject, document);
+    }
+    std::chrono::duration<double> tableElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        lookupObject.action = JsonHelper::SafelyDeserializeString(document, "Action");
+        lookupObject.count = JsonHelper::SafelyDeserializeInt(document, "Count");
+        lookupObject.name = JsonHelper::SafelyDeserializeString(document, "Name");
+        lookupObject.enabled = document.HasMember("Enabled") && document["Enabled"].IsBool() ? document["Enabled"].GetBool() : false;
+        lookupObject.properties.clear();
+        auto properties = document.FindMember("Properties");
+        if (properties != document.MemberEnd() && properties->value.IsObject()) {
+            for (auto itr = properties->value.MemberBegin(); itr != properties->value.MemberEnd(); ++itr) {
+                lookupObject.properties[itr->name.GetString()] = itr->value.GetString();
+            }
+        }
+    }
+    std::chrono::duration<double> lookupElapsed = std::chrono::steady_clock::now() - start;
+
+    // THEN
+    printf("[ BENCH    ] %3d unknown members: table %.0f objects/s, per-field lookup %.0f objects/s\n", unknownMemberCount,
+           ITERATIONS / tableElapsed.count(), ITERATIONS / lookupElapsed.count());
+    ASSERT_EQ(tableObject.name, lookupObject.name);
+    ASSERT_EQ(tableObject.count, lookupObject.count);
+    ASSERT_EQ(tableObject.properties, lookupObject.properties);
+}
+
+INSTANTIATE_TEST_CASE_P(UnknownMembers, JsonFieldTableBenchmark, ::testing::Values(0, 10, 100));
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
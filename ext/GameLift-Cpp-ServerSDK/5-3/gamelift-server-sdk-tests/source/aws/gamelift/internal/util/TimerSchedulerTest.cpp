@@ -0,0 +1,199 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <aws/gamelift/internal/util/TimerScheduler.h>
+#include <cstdio>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+namespace Test {
+
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+TEST(TimerSchedulerTest, GIVEN_timers_WHEN_runDueTimers_THEN_onlyDueTimersRunInDeadlineOrder) {
+    // GIVEN
+    TimerScheduler scheduler;
+    std::vector<int> ran;
+    scheduler.Schedule(milliseconds(300), [&ran] { ran.push_back(3); });
+    scheduler.Schedule(milliseconds(100), [&ran] { ran.push_back(1); });
+    scheduler.Schedule(milliseconds(200), [&ran] { ran.push_back(2); });
+    // WHEN
+    std::size_t count = scheduler.RunDueTimers(steady_clock::now() + milliseconds(250));
+    // THEN
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(ran, std::vector<int>({1, 2}));
+    ASSERT_EQ(scheduler.GetPendingTimerCount(), 1u);
+}
+
+TEST(TimerSchedulerTest, GIVEN_timersWithSameDelay_WHEN_runDueTimers_THEN_runInScheduleOrder) {
+    // GIVEN
+    TimerScheduler scheduler;
+    std::vector<int> ran;
+    for (int i = 0; i < 5; i++) {
+        scheduler.Schedule(milliseconds(0), [&ran, i] { ran.push_back(i); });
+    }
+    // WHEN
+    scheduler.RunDueTimers(steady_clock::now() + milliseconds(20));
+    // THEN
+    ASSERT_EQ(ran, std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+TEST(TimerSchedulerTest, GIVEN_cancelledTimer_WHEN_runDueTimers_THEN_notRun) {
+    // GIVEN
+    TimerScheduler scheduler;
+    bool ran = false;
+    TimerScheduler::TimerId timerId = scheduler.Schedule(milliseconds(50), [&ran] { ran = true; });
+    // WHEN
+    bool cancelled = scheduler.Cancel(timerId);
+    scheduler.RunDueTimers(steady_clock::now() + milliseconds(100));
+    // THEN
+    ASSERT_TRUE(cancelled);
+    ASSERT_FALSE(ran);
+    ASSERT_FALSE(scheduler.Cancel(timerId));
+    ASSERT_FALSE(scheduler.Cancel(TimerScheduler::INVALID_TIMER_ID));
+    ASSERT_EQ(scheduler.GetPendingTimerCount(), 0u);
+}
+
+TEST(TimerSchedulerTest, GIVEN_delayLongerThanWheel_WHEN_runDueTimers_THEN_runOnlyOnceDeadlinePasses) {
+    // GIVEN
+    TimerScheduler scheduler(milliseconds(10), 8);
+    bool ran = false;
+    steady_clock::time_point start = steady_clock::now();
+    scheduler.Schedule(milliseconds(1000), [&ran] { ran = true; });
+    // WHEN
+    for (int elapsed = 0; elapsed < 990; elapsed += 10) {
+        scheduler.RunDueTimers(start + milliseconds(elapsed));
+    }
+    bool ranEarly = ran;
+    scheduler.RunDueTimers(start + milliseconds(1020));
+    // THEN
+    ASSERT_FALSE(ranEarly);
+    ASSERT_TRUE(ran);
+}
+
+TEST(TimerSchedulerTest, GIVEN_startedScheduler_WHEN_schedule_THEN_taskRunsOnSchedulerThreadAfterDelay) {
+    // GIVEN
+    TimerScheduler scheduler;
+    scheduler.Start();
+    std::promise<std::thread::id> ranOn;
+    steady_clock::time_point start = steady_clock::now();
+    // WHEN
+    scheduler.Schedule(milliseconds(50), [&ranOn] { ranOn.set_value(std::this_thread::get_id()); });
+    std::future<std::thread::id> future = ranOn.get_future();
+    // THEN
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_GE(steady_clock::now() - start, milliseconds(50));
+    ASSERT_NE(future.get(), std::this_thread::get_id());
+}
+
+TEST(TimerSchedulerTest, GIVEN_taskThatReschedulesItself_WHEN_started_THEN_runsRepeatedlyOnOneThread) {
+    // GIVEN
+    TimerScheduler scheduler;
+    scheduler.Start();
+    std::atomic<int> runs(0);
+    std::promise<void> done;
+    std::function<void()> tick;
+    tick = [&] {
+        if (++runs == 5) {
+            done.set_value();
+        } else {
+            scheduler.Schedule(milliseconds(10), tick);
+        }
+    };
+    // WHEN
+    scheduler.Schedule(milliseconds(0), tick);
+    // THEN
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(runs, 5);
+}
+
+TEST(TimerSchedulerTest, GIVEN_pendingTimers_WHEN_stop_THEN_discardedWithoutRunning) {
+    // GIVEN
+    TimerScheduler scheduler;
+    scheduler.Start();
+    std::atomic<bool> ran(false);
+    scheduler.Schedule(milliseconds(100), [&ran] { ran = true; });
+    // WHEN
+    scheduler.Stop();
+    std::this_thread::sleep_for(milliseconds(150));
+    // THEN
+    ASSERT_FALSE(ran);
+    ASSERT_EQ(scheduler.GetPendingTimerCount(), 0u);
+}
+
+TEST(TimerSchedulerTest, GIVEN_taskThatDestroysScheduler_WHEN_run_THEN_schedulerThreadExitsAfterTask) {
+    // GIVEN
+    std::unique_ptr<TimerScheduler> scheduler(new TimerScheduler());
+    scheduler->Start();
+    std::promise<void> destroyed;
+    // WHEN
+    scheduler->Schedule(milliseconds(0), [&scheduler, &destroyed] {
+        scheduler.reset();
+        destroyed.set_value();
+    });
+    // THEN
+    ASSERT_EQ(destroyed.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    std::this_thread::sleep_for(milliseconds(50));
+    ASSERT_EQ(scheduler, nullptr);
+}
+
+TEST(TimerSchedulerTest, GIVEN_earliestTimerCancelled_WHEN_runDueTimers_THEN_laterTimersStillRunOnTime) {
+    // GIVEN
+    TimerScheduler scheduler(milliseconds(10), 8);
+    std::vector<int> order;
+    TimerScheduler::TimerId first = scheduler.Schedule(milliseconds(10), [&order] { order.push_back(1); });
+    scheduler.Schedule(milliseconds(50), [&order] { order.push_back(2); });
+    scheduler.Schedule(milliseconds(200), [&order] { order.push_back(3); });
+    scheduler.Cancel(first);
+    // WHEN
+    steady_clock::time_point now = steady_clock::now();
+    std::size_t ranEarly = scheduler.RunDueTimers(now + milliseconds(100));
+    std::size_t ranLate = scheduler.RunDueTimers(now + milliseconds(300));
+    // THEN
+    ASSERT_EQ(ranEarly, 1u);
+    ASSERT_EQ(ranLate, 1u);
+    ASSERT_EQ(order, std::vector<int>({2, 3}));
+}
+
+// Microbenchmark for the pattern request deadlines follow: a timer armed per request and cancelled when the
+// response arrives. Throughput is printed rather than asserted since it depends on the host.
+TEST(TimerSchedulerTest, GIVEN_manyPendingTimers_WHEN_scheduleAndCancel_THEN_reportThroughput) {
+    // GIVEN
+    static constexpr const int PENDING_TIMERS = 10000;
+    static constexpr const int ITERATIONS = 200000;
+    TimerScheduler scheduler;
+    for (int i = 0; i < PENDING_TIMERS; i++) {
+        scheduler.Schedule(milliseconds(60000 + i), [] {});
+    }
+    // WHEN
+    steady_clock::time_point start = steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        TimerScheduler::TimerId timerId = scheduler.Schedule(milliseconds(20000), [] {});
+        scheduler.Cancel(timerId);
+    }
+    std::chrono::duration<double> elapsed = steady_clock::now() - start;
+    // THEN
+    printf("[ BENCH    ] %d pending timers: %.0f schedule+cancel/s\n", PENDING_TIMERS, ITERATIONS / elapsed.count());
+    ASSERT_EQ(scheduler.GetPendingTimerCount(), static_cast<std::size_t>(PENDING_TIMERS));
+}
+
+} // namespace Test
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
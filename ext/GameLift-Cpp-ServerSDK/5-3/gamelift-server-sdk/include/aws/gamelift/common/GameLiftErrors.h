@@ -60,7 +60,8 @@ enum class AWS_GAMELIFT_API GAMELIFT_ERROR_TYPE {
     WEBSOCKET_CONNECT_FAILURE_TIMEOUT,        // Timeout
     WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE, // Retriable failure to send message to the GameLift
                                               // Service WebSocket
-    WEBSOCKET_SEND_MESSAGE_FAILURE            // Failure to send message to the GameLift Service WebSocket
+    WEBSOCKET_SEND_MESSAGE_FAILURE,           // Failure to send message to the GameLift Service WebSocket
+    WEBSOCKET_SEND_MESSAGE_TIMEOUT            // No response from the GameLift Service WebSocket before the request's deadline
 
 };
 
@@ -228,6 +229,8 @@ private:
                 return "WebSocket Connection has timed out.";
             case GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE:
                 return "WebSocket Send Message Failed.";
+            case GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_TIMEOUT:
+                return "WebSocket Send Message has timed out.";
             default:
                 return "Unknown Error";
         }
@@ -306,6 +309,8 @@ private:
                 return "Connection to the GameLift Service WebSocket Connection has timed out.";
             case GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE:
                 return "Sending Message to the GameLift Service WebSocket has failed.";
+            case GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_TIMEOUT:
+                return "The GameLift Service WebSocket did not respond before the request's deadline.";
             default:
                 return "An unexpected error has occurred.";
         }
@@ -15,6 +15,7 @@
 #include <aws/gamelift/server/model/GetComputeCertificateResult.h>
 #include <aws/gamelift/server/model/GetFleetRoleCredentialsResult.h>
 #include <aws/gamelift/server/model/StartMatchBackfillResult.h>
+#include <aws/gamelift/server/model/StartupTimings.h>
 #include <future>
 
 namespace Aws {
@@ -125,5 +126,6 @@ typedef Outcome<Aws::GameLift::Server::Model::DescribePlayerSessionsResult, Game
 typedef Outcome<Aws::GameLift::Server::Model::StartMatchBackfillResult, GameLiftError> StartMatchBackfillOutcome;
 typedef Outcome<Aws::GameLift::Server::Model::GetComputeCertificateResult, GameLiftError> GetComputeCertificateOutcome;
 typedef Outcome<Aws::GameLift::Server::Model::GetFleetRoleCredentialsResult, GameLiftError> GetFleetRoleCredentialsOutcome;
+typedef Outcome<Aws::GameLift::Server::Model::StartupTimings, GameLiftError> StartupTimingsOutcome;
 } // namespace GameLift
 } // namespace Aws
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/GameLiftCommonState.h>
+#include <aws/gamelift/internal/model/request/WebSocketGetFleetRoleCredentialsRequest.h>
 #include <aws/gamelift/internal/network/GameLiftWebSocketClientManager.h>
 #include <aws/gamelift/internal/network/IGameLiftMessageHandler.h>
 #include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
@@ -26,9 +27,14 @@
 #include <aws/gamelift/server/GameLiftServerAPI.h>
 #include <aws/gamelift/server/model/ServerParameters.h>
 #include <aws/gamelift/server/model/StartMatchBackfillRequest.h>
+#include <aws/gamelift/server/model/ServerEvent.h>
 #include <aws/gamelift/server/model/StopMatchBackfillRequest.h>
 #include <aws/gamelift/server/model/UpdateGameSession.h>
-#include <condition_variable>
+#include <aws/gamelift/internal/util/BoundedMpscQueue.h>
+#include <aws/gamelift/internal/util/CallbackExecutor.h>
+#include <aws/gamelift/internal/util/TimerScheduler.h>
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 namespace Aws {
@@ -40,6 +46,14 @@ using namespace Aws::GameLift::Server::Model;
 typedef Outcome<GameLiftServerState *, GameLiftError> InitSDKOutcome;
 #endif
 
+// Completion callbacks for the asynchronous service calls
+typedef std::function<void(const GenericOutcome &)> GenericOutcomeCallback;
+typedef std::function<void(const DescribePlayerSessionsOutcome &)> DescribePlayerSessionsOutcomeCallback;
+typedef std::function<void(const StartMatchBackfillOutcome &)> StartMatchBackfillOutcomeCallback;
+typedef std::function<void(const GetComputeCertificateOutcome &)> GetComputeCertificateOutcomeCallback;
+typedef std::function<void(const GetFleetRoleCredentialsOutcome &)> GetFleetRoleCredentialsOutcomeCallback;
+typedef std::function<void(ServerEvent &)> ServerEventCallback;
+
 class GameLiftServerState : public GameLiftCommonState, public IGameLiftMessageHandler {
 public:
     static constexpr const char *LANGUAGE = "Cpp";
@@ -57,6 +71,14 @@ private:
 
     void GetOverrideParams(char **webSocketUrl, char **authToken, char **processId, char **hostId, char **fleetId);
     void ReportHealth();
+    void SendHeartbeat(bool healthy);
+    // Wraps the handler of an asynchronous service call so it is run by an executor, never on the scheduler or a socket thread
+    template <typename OutcomeT>
+    std::function<void(const OutcomeT &)> OnHandlerExecutor(const char *name, const std::function<void(const OutcomeT &)> &handler);
+    void StartCallbackExecutor(const Aws::GameLift::Server::ProcessParameters &processParameters);
+    void StartEventQueue(const Aws::GameLift::Server::ProcessParameters &processParameters);
+    void QueueEvent(ServerEvent &&event);
+    void StartHealthCheck();
     void HealthCheck();
     int GetNextHealthCheckIntervalMillis();
 
@@ -181,12 +203,65 @@ private:
 public:
     GetFleetRoleCredentialsOutcome GetFleetRoleCredentials(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request);
 
+    // Non-blocking variants of the service calls. The callback is invoked exactly once, from the socket
+    // thread that received the response or from the calling thread if the request fails before sending.
+    // A positive timeoutMillis bounds the whole call, retries included; otherwise the action's own timeout applies.
+    void ProcessEndingAsync(const GenericOutcomeCallback &callback, int timeoutMillis = 0);
+
+    void ActivateGameSessionAsync(const GenericOutcomeCallback &callback, int timeoutMillis = 0);
+
+    void UpdatePlayerSessionCreationPolicyAsync(PlayerSessionCreationPolicy newPlayerSessionPolicy, const GenericOutcomeCallback &callback, int timeoutMillis = 0);
+
+    void AcceptPlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeCallback &callback, int timeoutMillis = 0);
+
+    void RemovePlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeCallback &callback, int timeoutMillis = 0);
+
+    void DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                                     const DescribePlayerSessionsOutcomeCallback &callback, int timeoutMillis = 0);
+
+    void StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest,
+                                 const StartMatchBackfillOutcomeCallback &callback, int timeoutMillis = 0);
+
+    void StopMatchBackfillAsync(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &stopMatchBackfillRequest, const GenericOutcomeCallback &callback,
+                                int timeoutMillis = 0);
+
+    void GetComputeCertificateAsync(const GetComputeCertificateOutcomeCallback &callback, int timeoutMillis = 0);
+
+    void GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                      const GetFleetRoleCredentialsOutcomeCallback &callback, int timeoutMillis = 0);
+
+    // Hands queued events to the callback on the calling thread, oldest first, stopping after maxEvents unless it is
+    // negative. Only available when ProcessReady was called with polled events.
+    AwsLongOutcome PollEvents(const ServerEventCallback &callback, int maxEvents);
+
+    // Runs the SDK's pending network IO, timers and callbacks on the calling thread, spending up to the budget on
+    // network IO. Returns how much work ran. Only does anything when InitializeNetworking was poll driven.
+    AwsLongOutcome Poll(std::chrono::microseconds budget);
+
+    // How long each step of startup took, or why the connection made in the background failed
+    StartupTimingsOutcome GetStartupTimings();
+
     // When within 15 minutes of expiration we retrieve new instance role credentials
     static constexpr const time_t INSTANCE_ROLE_CREDENTIAL_TTL_MIN = 60 * 15;
 
 private:
     bool AssertNetworkInitialized();
 
+    // Sends ActivateServerProcess and starts the heartbeat. While the connection is still being made in the
+    // background, the request waits for it to open and this returns at once.
+    GenericOutcome ActivateServerProcess(const Aws::GameLift::Server::ProcessParameters &processParameters);
+    void OnStartupConnected(const GenericOutcome &outcome);
+    void OnServerProcessActivated(std::chrono::steady_clock::time_point sentAt, const GenericOutcome &outcome);
+
+    // Convert the raw websocket responses shared by the blocking and non-blocking calls
+    static DescribePlayerSessionsOutcome ToDescribePlayerSessionsOutcome(const GenericOutcome &rawResponse);
+    static StartMatchBackfillOutcome ToStartMatchBackfillOutcome(const GenericOutcome &rawResponse);
+    static GetComputeCertificateOutcome ToGetComputeCertificateOutcome(const GenericOutcome &rawResponse);
+    GetFleetRoleCredentialsOutcome ToGetFleetRoleCredentialsOutcome(const std::string &roleArn, const GenericOutcome &rawResponse);
+
+    // Returns true if the request was answered without a service call, from the cache or a validation failure.
+    bool TryResolveFleetRoleCredentialsLocally(WebSocketGetFleetRoleCredentialsRequest &webSocketRequest, GetFleetRoleCredentialsOutcome &outcome);
+
     bool m_processReady;
 
     // Only one game session per process.
@@ -211,13 +286,39 @@ private:
     std::string m_hostId;
     std::string m_processId;
     // Assume we're on managed EC2, if GetFleetRoleCredentials fails we know to set this to false
-    bool m_onManagedEC2 = true;
+    std::atomic<bool> m_onManagedEC2{true};
+    // Asynchronous responses update the cache from the socket threads
+    std::mutex m_instanceRoleResultCacheMutex;
     std::map<std::string, GetFleetRoleCredentialsResult> m_instanceRoleResultCache;
 
-    std::unique_ptr<std::thread> m_healthCheckThread;
-    std::condition_variable m_healthCheckConditionVariable;
+    // Heartbeats, request retries, reconnects and request deadlines all run as timers on this scheduler's thread
+    std::shared_ptr<TimerScheduler> m_timerScheduler;
+    // Guards m_healthCheckTimer, which the heartbeat reschedules from the scheduler thread
     std::mutex m_healthCheckMutex;
-    bool m_healthCheckInterrupted;
+    TimerScheduler::TimerId m_healthCheckTimer;
+    // Set from when the health check callback is handed to its executor until it returns
+    std::atomic<bool> m_healthCheckInFlight{false};
+    // Runs the health check callback, apart from the session callbacks so a long one can't make the process look unhealthy
+    std::unique_ptr<CallbackExecutor> m_healthCheckExecutor;
+    // Runs the developer's session and termination callbacks, in the order GameLift sent them
+    std::unique_ptr<CallbackExecutor> m_callbackExecutor;
+    // Runs the handlers of the asynchronous service calls, one at a time. Apart from the callback executor, so a session
+    // callback may wait on a handler. When poll driven, the handlers go to the callback executor and run in Poll.
+    std::unique_ptr<CallbackExecutor> m_handlerExecutor;
+    // In polled mode, events wait here for the game's PollEvents instead of going to the callbacks
+    bool m_pollEvents;
+    std::unique_ptr<BoundedMpscQueue<ServerEvent>> m_eventQueue;
+    // When poll driven, the SDK starts no threads and all of its work runs in Poll
+    bool m_pollDriven;
+    // Set while InitSDK's connection is still being made in the background. Service calls wait for it meanwhile.
+    std::atomic<bool> m_connecting{false};
+    // Guards the startup timings, which the socket threads fill in as each step finishes
+    std::mutex m_startupMutex;
+    StartupTimings m_startupTimings;
+    std::chrono::steady_clock::time_point m_startupStart;
+    std::chrono::steady_clock::time_point m_connectedAt;
+    bool m_startupConnectFailed = false;
+    GameLiftError m_startupConnectError;
 };
 
 } // namespace Internal
@@ -13,6 +13,8 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/ISerializable.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
+#include <cstdint>
 #include <iostream>
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
@@ -24,16 +26,25 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+/**
+ * Tag selecting the constructor for messages received from the GameLift WebSocket. Their request ID
+ * is read from the incoming json, so none is generated.
+ */
+struct InboundMessageTag {};
+constexpr InboundMessageTag INBOUND_MESSAGE{};
+
 /**
  * Base Message class representing a message that is sent to and from the GameLift WebSocket. All
  * messages have a request ID, which represents the following:
- * - For outgoing messages: A randomly generated ID
+ * - For outgoing messages: A randomly generated ID, ending in a numeric request handle which is used
+ * to correlate the response with the request
  * - For incoming messages: The ID of the outgoing message which triggered the incoming
- * messages/response
+ * messages/response. Construct these with INBOUND_MESSAGE and populate them with Deserialize.
  */
 class Message : public ISerializable {
 public:
-    Message() : m_requestId(Message::GenerateRandomRequestId()) {}
+    Message() : m_requestId(Message::GenerateRequestId()) {}
+    explicit Message(InboundMessageTag) {}
     Message(const Message &) = default;
     Message(Message &&) = default;
     Message &operator=(const Message &) = default;
@@ -63,36 +74,60 @@ public:
      */
     std::string Serialize() const override;
 
+    /**
+     * Serialize the Message into the given buffer, replacing its contents. Pair with
+     * JsonHelper::GetThreadLocalBuffer to send a message without allocating a string for it.
+     */
+    bool SerializeTo(rapidjson::StringBuffer &buffer) const;
+
     /**
      * Deserialize the given json string and populate the member variables.
      */
     bool Deserialize(const std::string &jsonString) override;
 
+    /**
+     * Given RapidJson Value deserialize and populate this message's member variables.
+     * Subclasses of Message should override this function in order to allow for polymorphic
+     * deserialization. Use this overload when the json has already been parsed.
+     */
+    virtual bool Deserialize(const rapidjson::Value &obj);
+
+    /**
+     * Returns the numeric handle encoded in the given request ID. Request IDs that weren't generated
+     * by this process are hashed into the same range.
+     */
+    static uint64_t ToRequestHandle(const std::string &requestId);
+
+    /**
+     * Returns a request ID no other message in this process has, such as for resending a request as a new one.
+     */
+    static std::string GenerateRequestId();
+
     friend std::ostream &operator<<(std::ostream &os, const Message &message);
 
 protected:
     /**
-     * Write this message's member variables to the stringBuffer using the provided writer
-     * Subclasses of Message should override this function in order to allow for polymorphic
-     * serialization.
+     * Returns this class's json fields. Subclasses chain their own field table to it.
      */
-    virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
+    static const JsonFieldTable<Message> &GetJsonFields();
 
     /**
-     * Given RapidJson Value deserialize and populate this message's member variables.
+     * Write this message's member variables to the stringBuffer using the provided writer
      * Subclasses of Message should override this function in order to allow for polymorphic
-     * deserialization.
+     * serialization.
      */
-    virtual bool Deserialize(const rapidjson::Value &obj);
+    virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
 
 private:
     static constexpr const char *ACTION = "Action";
     static constexpr const char *REQUEST_ID = "RequestId";
+    static constexpr const size_t REQUEST_ID_LENGTH = 32;
+    static constexpr const size_t REQUEST_HANDLE_HEX_DIGITS = 16;
+    static constexpr const size_t REQUEST_ID_PREFIX_LENGTH = REQUEST_ID_LENGTH - REQUEST_HANDLE_HEX_DIGITS;
+    static constexpr const uint64_t REQUEST_HANDLE_MASK = (uint64_t(1) << 62) - 1;
 
     std::string m_action;
     std::string m_requestId;
-
-    static std::string GenerateRandomRequestId();
 };
 
 } // namespace Internal
@@ -20,10 +20,9 @@ namespace GameLift {
 namespace Internal {
 class ResponseMessage : public Message {
 public:
-    ResponseMessage() : m_statusCode(-1), m_errorMessage("") {
-        SetAction("");
-        SetRequestId("");
-    }
+    ResponseMessage() : ResponseMessage(INBOUND_MESSAGE) {}
+
+    explicit ResponseMessage(InboundMessageTag tag) : Message(tag), m_statusCode(-1), m_errorMessage("") {}
 
     ResponseMessage(const ResponseMessage &) = default;
 
@@ -56,6 +55,11 @@ public:
     friend std::ostream &operator<<(std::ostream &os, const ResponseMessage &responseMessage);
 
 protected:
+    /**
+     * Returns this class's json fields. Subclasses chain their own field table to it.
+     */
+    static const JsonFieldTable<ResponseMessage> &GetJsonFields();
+
     virtual bool Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const;
 
     virtual bool Deserialize(const rapidjson::Value &obj);
@@ -135,6 +135,8 @@ public:
     bool Deserialize(const rapidjson::Value &obj);
 
 private:
+    static const JsonFieldTable<WebSocketGameSession> &GetJsonFields();
+
     static constexpr const char *GAME_SESSION_ID = "GameSessionId";
     static constexpr const char *NAME = "Name";
     static constexpr const char *FLEET_ID = "FleetId";
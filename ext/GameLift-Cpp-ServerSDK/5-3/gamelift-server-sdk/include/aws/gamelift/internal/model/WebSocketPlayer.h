@@ -12,6 +12,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/WebSocketAttributeValue.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 #include <map>
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
@@ -74,6 +75,8 @@ public:
     bool Deserialize(const rapidjson::Value &value);
 
 private:
+    static const JsonFieldTable<WebSocketPlayer> &GetJsonFields();
+
     static constexpr const char *PLAYER_ID = "PlayerId";
     static constexpr const char *PLAYER_ATTRIBUTES = "PlayerAttributes";
     static constexpr const char *LATENCY_IN_MS = "LatencyInMs";
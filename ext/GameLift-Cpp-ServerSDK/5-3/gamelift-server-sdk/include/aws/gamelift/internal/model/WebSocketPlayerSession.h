@@ -12,6 +12,7 @@
 #pragma once
 
 #include <aws/gamelift/internal/model/WebSocketPlayerSessionStatus.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/rapidjson.h>
@@ -150,6 +151,8 @@ public:
     bool Deserialize(const rapidjson::Value &value);
 
 private:
+    static const JsonFieldTable<WebSocketPlayerSession> &GetJsonFields();
+
     static constexpr const char *PLAYER_SESSION_ID = "PlayerSessionId";
     static constexpr const char *PLAYER_ID = "PlayerId";
     static constexpr const char *GAME_SESSION_ID = "GameSessionId";
@@ -0,0 +1,108 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/server/model/DescribePlayerSessionsResult.h>
+#include <aws/gamelift/server/model/PlayerSession.h>
+#include <cstdint>
+#include <rapidjson/reader.h>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * SAX handler that decodes a DescribePlayerSessions response straight into the public result type in
+ * a single pass, without building WebSocketPlayerSession objects first. Feed it either with a
+ * rapidjson::Reader over the raw response, or with Accept on an already parsed document.
+ *
+ * Fields are decoded the same way WebSocketDescribePlayerSessionsResponse::Deserialize and
+ * DescribePlayerSessionsAdapter::convert would: missing or mistyped numbers are -1, missing strings
+ * are empty, and null player sessions are skipped.
+ */
+class DescribePlayerSessionsDecoder : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, DescribePlayerSessionsDecoder> {
+public:
+    explicit DescribePlayerSessionsDecoder(Server::Model::DescribePlayerSessionsResult &result);
+
+    bool Null();
+    bool Bool(bool value);
+    bool Int(int value);
+    bool Uint(unsigned value);
+    bool Int64(int64_t value);
+    bool Uint64(uint64_t value);
+    bool Double(double value);
+    bool String(const char *value, rapidjson::SizeType length, bool copy);
+    bool StartObject();
+    bool Key(const char *name, rapidjson::SizeType length, bool copy);
+    bool EndObject(rapidjson::SizeType memberCount);
+    bool StartArray();
+    bool EndArray(rapidjson::SizeType elementCount);
+
+private:
+    enum class Field {
+        NONE,
+        NEXT_TOKEN,
+        PLAYER_SESSIONS,
+        PLAYER_SESSION_ID,
+        PLAYER_ID,
+        GAME_SESSION_ID,
+        FLEET_ID,
+        CREATION_TIME,
+        TERMINATION_TIME,
+        STATUS,
+        IP_ADDRESS,
+        PORT,
+        PLAYER_DATA,
+        DNS_NAME
+    };
+
+    // Nesting depth of the response object, the PlayerSessions array and each player session
+    static constexpr const int RESPONSE_DEPTH = 1;
+    static constexpr const int PLAYER_SESSIONS_DEPTH = 2;
+    static constexpr const int PLAYER_SESSION_DEPTH = 3;
+
+    static constexpr const char *NEXT_TOKEN = "NextToken";
+    static constexpr const char *PLAYER_SESSIONS = "PlayerSessions";
+    static constexpr const char *PLAYER_SESSION_ID = "PlayerSessionId";
+    static constexpr const char *PLAYER_ID = "PlayerId";
+    static constexpr const char *GAME_SESSION_ID = "GameSessionId";
+    static constexpr const char *FLEET_ID = "FleetId";
+    static constexpr const char *CREATION_TIME = "CreationTime";
+    static constexpr const char *TERMINATION_TIME = "TerminationTime";
+    static constexpr const char *STATUS = "Status";
+    static constexpr const char *IP_ADDRESS = "IpAddress";
+    static constexpr const char *PORT = "Port";
+    static constexpr const char *PLAYER_DATA = "PlayerData";
+    static constexpr const char *DNS_NAME = "DnsName";
+
+    Server::Model::DescribePlayerSessionsResult &m_result;
+#ifdef GAMELIFT_USE_STD
+    // Sessions are decoded in place and handed to the result in one move
+    std::vector<Server::Model::PlayerSession> m_playerSessions;
+#else
+    Server::Model::PlayerSession m_currentPlayerSession;
+#endif
+    // The player session being decoded, or nullptr outside of one
+    Server::Model::PlayerSession *m_playerSession;
+    int m_depth;
+    bool m_inPlayerSessions;
+    Field m_field;
+
+    bool Integer(int64_t value);
+    static bool NameEquals(const char *name, rapidjson::SizeType length, const char *expected);
+    static Server::Model::PlayerSessionStatus StatusForName(const char *name, rapidjson::SizeType length);
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -27,6 +27,7 @@ namespace Internal {
 class CreateGameSessionMessage : public Message {
 public:
     CreateGameSessionMessage() : m_maximumPlayerSessionCount(-1), m_port(-1) { SetAction(CREATE_GAME_SESSION); };
+    explicit CreateGameSessionMessage(InboundMessageTag tag) : Message(tag), m_maximumPlayerSessionCount(-1), m_port(-1) { SetAction(CREATE_GAME_SESSION); };
     CreateGameSessionMessage(const CreateGameSessionMessage &) = default;
     CreateGameSessionMessage(CreateGameSessionMessage &&) = default;
     CreateGameSessionMessage &operator=(const CreateGameSessionMessage &) = default;
@@ -121,6 +122,8 @@ protected:
     virtual bool Deserialize(const rapidjson::Value &obj);
 
 private:
+    static const JsonFieldTable<CreateGameSessionMessage> &GetJsonFields();
+
     static constexpr const char *CREATE_GAME_SESSION = "CreateGameSession";
     static constexpr const char *GAME_SESSION_ID = "GameSessionId";
     static constexpr const char *GAME_SESSION_NAME = "GameSessionName";
@@ -24,6 +24,7 @@ namespace Internal {
 class RefreshConnectionMessage : public Message {
 public:
     RefreshConnectionMessage() { SetAction(REFRESH_CONNECTION); };
+    explicit RefreshConnectionMessage(InboundMessageTag tag) : Message(tag) { SetAction(REFRESH_CONNECTION); };
     RefreshConnectionMessage(const RefreshConnectionMessage &) = default;
     RefreshConnectionMessage(RefreshConnectionMessage &&) = default;
     RefreshConnectionMessage &operator=(const RefreshConnectionMessage &) = default;
@@ -52,6 +53,8 @@ protected:
     virtual bool Deserialize(const rapidjson::Value &obj);
 
 private:
+    static const JsonFieldTable<RefreshConnectionMessage> &GetJsonFields();
+
     static constexpr const char *REFRESH_CONNECTION = "RefreshConnection";
     static constexpr const char *REFRESH_CONNECTION_ENDPOINT = "RefreshConnectionEndpoint";
     static constexpr const char *AUTH_TOKEN = "AuthToken";
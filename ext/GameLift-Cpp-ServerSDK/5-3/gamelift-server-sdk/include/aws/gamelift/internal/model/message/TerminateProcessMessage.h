@@ -25,6 +25,7 @@ namespace Internal {
 class TerminateProcessMessage : public Message {
 public:
     TerminateProcessMessage() : m_terminationTime(-1) { SetAction(TERMINATE_PROCESS); };
+    explicit TerminateProcessMessage(InboundMessageTag tag) : Message(tag), m_terminationTime(-1) { SetAction(TERMINATE_PROCESS); };
     TerminateProcessMessage(const TerminateProcessMessage &) = default;
     TerminateProcessMessage(TerminateProcessMessage &&) = default;
     TerminateProcessMessage &operator=(const TerminateProcessMessage &) = default;
@@ -47,6 +48,8 @@ protected:
     virtual bool Deserialize(const rapidjson::Value &obj);
 
 private:
+    static const JsonFieldTable<TerminateProcessMessage> &GetJsonFields();
+
     static constexpr const char *TERMINATE_PROCESS = "TerminateProcess";
     static constexpr const char *TERMINATION_TIME = "TerminationTime";
 
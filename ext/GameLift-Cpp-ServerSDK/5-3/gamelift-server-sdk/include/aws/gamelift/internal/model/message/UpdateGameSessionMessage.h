@@ -25,6 +25,7 @@ namespace Internal {
 class UpdateGameSessionMessage : public Message {
 public:
     UpdateGameSessionMessage() { SetAction(UPDATE_GAME_SESSION); };
+    explicit UpdateGameSessionMessage(InboundMessageTag tag) : Message(tag) { SetAction(UPDATE_GAME_SESSION); };
     UpdateGameSessionMessage(const UpdateGameSessionMessage &) = default;
     UpdateGameSessionMessage(UpdateGameSessionMessage &&) = default;
     UpdateGameSessionMessage &operator=(const UpdateGameSessionMessage &) = default;
@@ -65,6 +66,8 @@ protected:
     virtual bool Deserialize(const rapidjson::Value &obj);
 
 private:
+    static const JsonFieldTable<UpdateGameSessionMessage> &GetJsonFields();
+
     static constexpr const char *UPDATE_GAME_SESSION = "UpdateGameSession";
     static constexpr const char *GAME_SESSION = "GameSession";
     static constexpr const char *UPDATE_REASON = "UpdateReason";
@@ -58,6 +58,8 @@ protected:
     bool Deserialize(const rapidjson::Value &value);
 
 private:
+    static const JsonFieldTable<AcceptPlayerSessionRequest> &GetJsonFields();
+
     static constexpr const char *ACTION = "AcceptPlayerSession";
     static constexpr const char *GAME_SESSION_ID = "GameSessionId";
     static constexpr const char *PLAYER_SESSION_ID = "PlayerSessionId";
@@ -49,6 +49,8 @@ protected:
     bool Deserialize(const rapidjson::Value &value);
 
 private:
+    static const JsonFieldTable<ActivateGameSessionRequest> &GetJsonFields();
+
     static constexpr const char *ACTIVATE_GAME_SESSION = "ActivateGameSession";
     static constexpr const char *GAME_SESSION_ID = "GameSessionId";
 
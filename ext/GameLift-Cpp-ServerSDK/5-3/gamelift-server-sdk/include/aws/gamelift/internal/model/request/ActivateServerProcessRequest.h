@@ -77,6 +77,8 @@ protected:
     bool Deserialize(const rapidjson::Value &value);
 
 private:
+    static const JsonFieldTable<ActivateServerProcessRequest> &GetJsonFields();
+
     static constexpr const char *ACTIVATE_SERVER_PROCESS = "ActivateServerProcess";
     static constexpr const char *SDK_VERSION = "SdkVersion";
     static constexpr const char *SDK_LANGUAGE = "SdkLanguage";
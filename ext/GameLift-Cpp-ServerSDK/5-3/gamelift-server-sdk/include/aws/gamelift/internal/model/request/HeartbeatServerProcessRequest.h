@@ -47,6 +47,8 @@ protected:
     virtual bool Deserialize(const rapidjson::Value &obj);
 
 private:
+    static const JsonFieldTable<HeartbeatServerProcessRequest> &GetJsonFields();
+
     static constexpr const char *HEARTBEAT_SERVER_PROCESS = "HeartbeatServerProcess";
     static constexpr const char *HEALTH_STATUS = "HealthStatus";
 
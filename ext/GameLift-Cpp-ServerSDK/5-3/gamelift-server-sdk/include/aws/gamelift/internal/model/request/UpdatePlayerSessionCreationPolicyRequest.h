@@ -92,6 +92,8 @@ protected:
     bool Deserialize(const rapidjson::Value &value) override;
 
 private:
+    static const JsonFieldTable<UpdatePlayerSessionCreationPolicyRequest> &GetJsonFields();
+
     static constexpr const char *ACTION = "UpdatePlayerSessionCreationPolicy";
 
     static constexpr const char *GAME_SESSION_ID = "GameSessionId";
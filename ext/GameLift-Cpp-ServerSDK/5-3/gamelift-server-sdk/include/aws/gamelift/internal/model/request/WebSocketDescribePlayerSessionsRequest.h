@@ -91,6 +91,8 @@ protected:
     bool Deserialize(const rapidjson::Value &value) override;
 
 private:
+    static const JsonFieldTable<WebSocketDescribePlayerSessionsRequest> &GetJsonFields();
+
     static constexpr const char *ACTION = "DescribePlayerSessions";
 
     static constexpr const char *GAME_SESSION_ID = "GameSessionId";
@@ -55,6 +55,8 @@ protected:
     bool Deserialize(const rapidjson::Value &value) override;
 
 private:
+    static const JsonFieldTable<WebSocketGetFleetRoleCredentialsRequest> &GetJsonFields();
+
     static constexpr const char *ACTION = "GetFleetRoleCredentials";
 
     static constexpr const char *ROLE_ARN = "RoleArn";
@@ -76,6 +76,8 @@ protected:
     bool Deserialize(const rapidjson::Value &value) override;
 
 private:
+    static const JsonFieldTable<WebSocketStartMatchBackfillRequest> &GetJsonFields();
+
     static constexpr const char *ACTION = "StartMatchBackfill";
 
     static constexpr const char *TICKET_ID = "TicketId";
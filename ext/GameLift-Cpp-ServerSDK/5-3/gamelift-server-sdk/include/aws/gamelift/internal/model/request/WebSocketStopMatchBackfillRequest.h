@@ -59,6 +59,8 @@ protected:
     virtual bool Deserialize(const rapidjson::Value &obj);
 
 private:
+    static const JsonFieldTable<WebSocketStopMatchBackfillRequest> &GetJsonFields();
+
     static constexpr const char *STOP_MATCH_BACKFILL = "StopMatchBackfill";
     static constexpr const char *GAME_SESSION_ARN = "GameSessionArn";
     static constexpr const char *MATCHMAKING_CONFIG_ARN = "MatchmakingConfigurationArn";
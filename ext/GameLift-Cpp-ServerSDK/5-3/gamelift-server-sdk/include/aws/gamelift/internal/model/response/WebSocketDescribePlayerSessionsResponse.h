@@ -26,6 +26,7 @@ namespace Internal {
 class WebSocketDescribePlayerSessionsResponse : public Message {
 public:
     WebSocketDescribePlayerSessionsResponse() { SetAction(ACTION); };
+    explicit WebSocketDescribePlayerSessionsResponse(InboundMessageTag tag) : Message(tag) { SetAction(ACTION); };
     WebSocketDescribePlayerSessionsResponse(const WebSocketDescribePlayerSessionsResponse &) = default;
     WebSocketDescribePlayerSessionsResponse(WebSocketDescribePlayerSessionsResponse &&) = default;
     WebSocketDescribePlayerSessionsResponse &operator=(const WebSocketDescribePlayerSessionsResponse &) = default;
@@ -57,6 +58,8 @@ protected:
     bool Deserialize(const rapidjson::Value &value) override;
 
 private:
+    static const JsonFieldTable<WebSocketDescribePlayerSessionsResponse> &GetJsonFields();
+
     static constexpr const char *ACTION = "DescribePlayerSessions";
 
     static constexpr const char *PLAYER_SESSIONS = "PlayerSessions";
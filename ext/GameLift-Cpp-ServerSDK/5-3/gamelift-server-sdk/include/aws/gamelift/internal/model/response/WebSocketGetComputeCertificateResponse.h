@@ -25,6 +25,7 @@ namespace Internal {
 class WebSocketGetComputeCertificateResponse : public Message {
 public:
     WebSocketGetComputeCertificateResponse() { SetAction(ACTION); };
+    explicit WebSocketGetComputeCertificateResponse(InboundMessageTag tag) : Message(tag) { SetAction(ACTION); };
     WebSocketGetComputeCertificateResponse(const WebSocketGetComputeCertificateResponse &) = default;
     WebSocketGetComputeCertificateResponse(WebSocketGetComputeCertificateResponse &&) = default;
     WebSocketGetComputeCertificateResponse &operator=(const WebSocketGetComputeCertificateResponse &) = default;
@@ -56,6 +57,8 @@ protected:
     bool Deserialize(const rapidjson::Value &value) override;
 
 private:
+    static const JsonFieldTable<WebSocketGetComputeCertificateResponse> &GetJsonFields();
+
     static constexpr const char *ACTION = "GetComputeCertificate";
 
     static constexpr const char *COMPUTE_NAME = "ComputeName";
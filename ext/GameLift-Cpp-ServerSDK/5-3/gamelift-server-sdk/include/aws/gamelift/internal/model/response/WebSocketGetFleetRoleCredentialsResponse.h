@@ -20,6 +20,7 @@ namespace Internal {
 class WebSocketGetFleetRoleCredentialsResponse : public Message {
 public:
     WebSocketGetFleetRoleCredentialsResponse() : m_expiration(-1) { SetAction(ACTION); };
+    explicit WebSocketGetFleetRoleCredentialsResponse(InboundMessageTag tag) : Message(tag), m_expiration(-1) { SetAction(ACTION); };
 
     WebSocketGetFleetRoleCredentialsResponse(const WebSocketGetFleetRoleCredentialsResponse &) = default;
 
@@ -91,6 +92,8 @@ protected:
     bool Deserialize(const rapidjson::Value &value) override;
 
 private:
+    static const JsonFieldTable<WebSocketGetFleetRoleCredentialsResponse> &GetJsonFields();
+
     static constexpr const char *ACTION = "GetFleetRoleCredentials";
 
     static constexpr const char *ASSUMED_ROLE_USER_ARN = "AssumedRoleUserArn";
@@ -26,6 +26,7 @@ namespace Internal {
 class WebSocketStartMatchBackfillResponse : public Message {
 public:
     WebSocketStartMatchBackfillResponse() { SetAction(ACTION); };
+    explicit WebSocketStartMatchBackfillResponse(InboundMessageTag tag) : Message(tag) { SetAction(ACTION); };
     WebSocketStartMatchBackfillResponse(const WebSocketStartMatchBackfillResponse &) = default;
     WebSocketStartMatchBackfillResponse(WebSocketStartMatchBackfillResponse &&) = default;
     WebSocketStartMatchBackfillResponse &operator=(const WebSocketStartMatchBackfillResponse &) = default;
@@ -48,6 +49,8 @@ protected:
     bool Deserialize(const rapidjson::Value &value) override;
 
 private:
+    static const JsonFieldTable<WebSocketStartMatchBackfillResponse> &GetJsonFields();
+
     static constexpr const char *ACTION = "StartMatchBackfill";
 
     static constexpr const char *TICKET_ID = "TicketId";
@@ -0,0 +1,252 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/internal/network/ResolvedEndpointCache.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <websocketpp/transport/asio/endpoint.hpp>
+#include <websocketpp/uri.hpp>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * The Asio transport, except for how a client connection finds and opens its TCP connection.
+ *
+ * The host's addresses come from a ResolvedEndpointCache, so only the first connection, and the first after the TTL
+ * or after every cached address failed, waits on DNS. The addresses are then raced Happy Eyeballs style (RFC 8305):
+ * the next one is tried whenever the last fails or CONNECTION_ATTEMPT_DELAY_MILLIS passes without it connecting,
+ * and the first to connect is kept. Connections through a proxy are left to the Asio transport.
+ */
+template <typename config>
+class EndpointCachingTransport : public websocketpp::transport::asio::endpoint<config> {
+public:
+    typedef websocketpp::transport::asio::endpoint<config> base;
+    typedef typename base::transport_con_ptr transport_con_ptr;
+    typedef typename base::socket_con_type socket_con_type;
+    typedef typename base::timer_ptr timer_ptr;
+
+    static constexpr const int CONNECTION_ATTEMPT_DELAY_MILLIS = 250;
+
+    // Every handler of a connect runs on its connection's strand, which is what keeps its state consistent
+    static_assert(config::enable_multithreading, "EndpointCachingTransport needs the connection strands of a multithreaded transport");
+
+    EndpointCachingTransport() : m_endpointCache(std::make_shared<ResolvedEndpointCache>()) {}
+
+protected:
+    // Hides the Asio transport's own, which the client calls on its transport type
+    void async_connect(transport_con_ptr tcon, websocketpp::uri_ptr uri, websocketpp::transport::connect_handler callback) {
+        if (!tcon->get_proxy().empty()) {
+            base::async_connect(tcon, uri, callback);
+            return;
+        }
+
+        std::shared_ptr<ConnectRace> race = std::make_shared<ConnectRace>();
+        race->connection = tcon;
+        race->callback = callback;
+        race->hostAndPort = uri->get_host() + ":" + uri->get_port_str();
+        race->port = uri->get_port();
+        race->nextEndpoint = 0;
+        race->pendingAttempts = 0;
+        race->settled = false;
+        race->completed = false;
+        // One deadline for resolving and connecting, the two the Asio transport would have allowed between them
+        race->connectTimer = tcon->set_timer(config::timeout_dns_resolve + config::timeout_connect,
+                                             [this, race](const websocketpp::lib::error_code &errorCode) { OnConnectTimeout(race, errorCode); });
+
+        std::vector<std::string> addresses;
+        if (m_endpointCache->Lookup(race->hostAndPort, addresses)) {
+            race->endpoints = ToEndpoints(addresses, race->port);
+            tcon->get_strand()->post([this, race] { StartNextAttempt(race); });
+            return;
+        }
+
+        race->resolver = std::make_shared<asio::ip::tcp::resolver>(this->get_io_service());
+        race->resolver->async_resolve(
+            uri->get_host(), uri->get_port_str(),
+            tcon->get_strand()->wrap([this, race](const asio::error_code &errorCode, asio::ip::tcp::resolver::results_type results) {
+                OnResolved(race, errorCode, results);
+            }));
+    }
+
+private:
+    struct ConnectRace {
+        transport_con_ptr connection;
+        websocketpp::transport::connect_handler callback;
+        std::string hostAndPort;
+        uint16_t port;
+        std::shared_ptr<asio::ip::tcp::resolver> resolver;
+        std::vector<asio::ip::tcp::endpoint> endpoints;
+        std::size_t nextEndpoint;
+        // A socket per address tried. The winner's is handed over to the connection.
+        std::vector<std::shared_ptr<asio::ip::tcp::socket>> attempts;
+        std::size_t pendingAttempts;
+        std::shared_ptr<asio::steady_timer> attemptDelayTimer;
+        timer_ptr connectTimer;
+        // Settled once an attempt has won or the race is given up; completed once the callback has run
+        bool settled;
+        bool completed;
+    };
+
+    static std::vector<asio::ip::tcp::endpoint> ToEndpoints(const std::vector<std::string> &addresses, uint16_t port) {
+        std::vector<asio::ip::tcp::endpoint> endpoints;
+        for (const std::string &address : addresses) {
+            asio::error_code errorCode;
+            asio::ip::address ipAddress = asio::ip::make_address(address, errorCode);
+            if (!errorCode) {
+                endpoints.push_back(asio::ip::tcp::endpoint(ipAddress, port));
+            }
+        }
+        return endpoints;
+    }
+
+    void OnResolved(const std::shared_ptr<ConnectRace> &race, const asio::error_code &errorCode, const asio::ip::tcp::resolver::results_type &results) {
+        race->resolver.reset();
+        if (race->completed) {
+            return;
+        }
+        if (errorCode) {
+            Complete(race, socket_con_type::translate_ec(errorCode));
+            return;
+        }
+        std::vector<std::string> addresses;
+        for (const asio::ip::tcp::resolver::results_type::value_type &entry : results) {
+            addresses.push_back(entry.endpoint().address().to_string());
+        }
+        race->endpoints = ToEndpoints(m_endpointCache->Store(race->hostAndPort, addresses), race->port);
+        StartNextAttempt(race);
+    }
+
+    void StartNextAttempt(const std::shared_ptr<ConnectRace> &race) {
+        if (race->settled) {
+            return;
+        }
+        if (race->nextEndpoint >= race->endpoints.size()) {
+            // Nothing left to try. While attempts are still under way, the last of them to fail completes the race.
+            if (race->pendingAttempts == 0) {
+                m_endpointCache->Invalidate(race->hostAndPort);
+                Complete(race, websocketpp::transport::error::make_error_code(websocketpp::transport::error::pass_through));
+            }
+            return;
+        }
+        const asio::ip::tcp::endpoint endpoint = race->endpoints[race->nextEndpoint++];
+        std::shared_ptr<asio::ip::tcp::socket> attempt = std::make_shared<asio::ip::tcp::socket>(this->get_io_service());
+        race->attempts.push_back(attempt);
+        race->pendingAttempts++;
+        attempt->async_connect(endpoint, race->connection->get_strand()->wrap([this, race, attempt, endpoint](const asio::error_code &errorCode) {
+            OnAttemptComplete(race, attempt, endpoint, errorCode);
+        }));
+
+        if (race->nextEndpoint < race->endpoints.size()) {
+            race->attemptDelayTimer = std::make_shared<asio::steady_timer>(this->get_io_service());
+            race->attemptDelayTimer->expires_after(std::chrono::milliseconds(CONNECTION_ATTEMPT_DELAY_MILLIS));
+            race->attemptDelayTimer->async_wait(race->connection->get_strand()->wrap([this, race](const asio::error_code &errorCode) {
+                if (!errorCode) {
+                    StartNextAttempt(race);
+                }
+            }));
+        }
+    }
+
+    void OnAttemptComplete(const std::shared_ptr<ConnectRace> &race, const std::shared_ptr<asio::ip::tcp::socket> &attempt,
+                           const asio::ip::tcp::endpoint &endpoint, const asio::error_code &errorCode) {
+        race->pendingAttempts--;
+        asio::error_code ignored;
+        if (race->settled) {
+            attempt->close(ignored);
+            return;
+        }
+        if (errorCode) {
+            attempt->close(ignored);
+            if (race->nextEndpoint < race->endpoints.size()) {
+                // No point waiting out the delay for an address that has already failed
+                if (race->attemptDelayTimer) {
+                    race->attemptDelayTimer->cancel(ignored);
+                }
+                StartNextAttempt(race);
+            } else if (race->pendingAttempts == 0) {
+                // Every address failed, and the cached ones may be out of date
+                m_endpointCache->Invalidate(race->hostAndPort);
+                Complete(race, socket_con_type::translate_ec(errorCode));
+            }
+            return;
+        }
+
+        m_endpointCache->Prefer(race->hostAndPort, endpoint.address().to_string());
+        Settle(race, attempt);
+        asio::error_code handOverError;
+        asio::ip::tcp::socket::native_handle_type handle = attempt->release(handOverError);
+        if (!handOverError) {
+            race->connection->get_raw_socket().assign(endpoint.protocol(), handle, handOverError);
+        }
+        if (!handOverError) {
+            Complete(race, websocketpp::lib::error_code());
+            return;
+        }
+        // Where a socket can't be released, connect the connection's own to the address that answered
+        attempt->close(ignored);
+        race->connection->get_raw_socket().async_connect(
+            endpoint, race->connection->get_strand()->wrap([this, race](const asio::error_code &connectError) {
+                Complete(race, connectError ? socket_con_type::translate_ec(connectError) : websocketpp::lib::error_code());
+            }));
+    }
+
+    void OnConnectTimeout(const std::shared_ptr<ConnectRace> &race, const websocketpp::lib::error_code &errorCode) {
+        if (errorCode == websocketpp::transport::error::operation_aborted || race->completed) {
+            return;
+        }
+        asio::error_code ignored;
+        if (race->resolver) {
+            race->resolver->cancel();
+        }
+        race->connection->get_raw_socket().cancel(ignored);
+        Complete(race, errorCode ? errorCode : websocketpp::transport::error::make_error_code(websocketpp::transport::error::timeout));
+    }
+
+    // Stops any more attempts and closes the ones still under way, other than the winner's if there is one
+    void Settle(const std::shared_ptr<ConnectRace> &race, const std::shared_ptr<asio::ip::tcp::socket> &winner) {
+        race->settled = true;
+        asio::error_code ignored;
+        if (race->attemptDelayTimer) {
+            race->attemptDelayTimer->cancel(ignored);
+        }
+        for (const std::shared_ptr<asio::ip::tcp::socket> &attempt : race->attempts) {
+            if (attempt != winner) {
+                attempt->close(ignored);
+            }
+        }
+        race->attempts.clear();
+    }
+
+    void Complete(const std::shared_ptr<ConnectRace> &race, const websocketpp::lib::error_code &errorCode) {
+        if (race->completed) {
+            return;
+        }
+        race->completed = true;
+        Settle(race, nullptr);
+        race->connectTimer->cancel();
+        race->callback(errorCode);
+    }
+
+    std::shared_ptr<ResolvedEndpointCache> m_endpointCache;
+};
+
+template <typename config> constexpr const int EndpointCachingTransport<config>::CONNECTION_ATTEMPT_DELAY_MILLIS;
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -15,7 +15,16 @@
 #include <aws/gamelift/internal/model/Message.h>
 #include <aws/gamelift/internal/model/Uri.h>
 #include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
+#include <aws/gamelift/internal/network/LatencyEstimator.h>
+#include <aws/gamelift/internal/network/OutboundScheduler.h>
+#include <aws/gamelift/internal/retry/CircuitBreaker.h>
+#include <aws/gamelift/internal/retry/RetryBudget.h>
+#include <aws/gamelift/internal/retry/RetryStrategy.h>
+#include <aws/gamelift/internal/util/TimerScheduler.h>
+#include <chrono>
+#include <deque>
 #include <future>
+#include <memory>
 #include <mutex>
 
 namespace Aws {
@@ -28,20 +37,129 @@ namespace Internal {
  */
 class GameLiftWebSocketClientManager {
 public:
-    GameLiftWebSocketClientManager(std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper) : m_webSocketClientWrapper(webSocketClientWrapper) {}
+    // Retries, reconnects and request deadlines run on the given scheduler, which is shared with the wrapper.
+    // Without one, the manager starts its own.
+    GameLiftWebSocketClientManager(std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper, std::shared_ptr<TimerScheduler> timerScheduler = nullptr);
 
-    ~GameLiftWebSocketClientManager() = default;
+    // Fails the callbacks of messages still queued for the connection to come back
+    ~GameLiftWebSocketClientManager();
 
     inline bool IsConnected() { return m_webSocketClientWrapper->IsConnected(); }
 
     Aws::GameLift::GenericOutcome Connect(std::string websocketUrl, const std::string &authToken, const std::string &processId, const std::string &hostId,
                                           const std::string &fleetId);
-    // Messages are synchronously sent and a response is waited for.
-    GenericOutcome SendSocketMessage(Message &message);
+    // Connects without waiting for the connection, for refreshes that arrive on a socket thread. The callback is
+    // invoked exactly once with the outcome.
+    void ConnectAsync(std::string websocketUrl, const std::string &authToken, const std::string &processId, const std::string &hostId,
+                      const std::string &fleetId, const std::function<void(const GenericOutcome &)> &callback);
+    // Messages are synchronously sent and a response is waited for. When poll driven, the wrapper's socket work
+    // and the scheduler's timers run on the waiting thread until the response arrives, since nothing else runs them.
+    GenericOutcome SendSocketMessage(Message &message, std::chrono::milliseconds timeout = std::chrono::milliseconds::zero());
+    // Messages are sent without waiting for the response. Retriable failures are retried with backoff
+    // on the scheduler. The callback is invoked exactly once, from the socket thread that received the
+    // response, the scheduler thread, or the calling thread if the first attempt failed outright.
+    //
+    // How long each attempt waits for its response, and how many attempts are made, depends on the message's
+    // action (see GetRequestPolicy). Once the action has had enough responses, an attempt waits a few times its
+    // 99th percentile round trip instead, up to the policy's timeout. Idempotent reads are hedged: an attempt
+    // that outlasts the action's 95th percentile is sent again under a new request ID, and whichever response
+    // arrives first is used. A positive timeout also bounds the whole call, retries included: once it
+    // passes, the callback fails with WEBSOCKET_SEND_MESSAGE_TIMEOUT and the request is not sent again.
+    //
+    // Messages that are safe to replay (heartbeats, RemovePlayerSession and UpdatePlayerSessionCreationPolicy)
+    // are queued instead while disconnected, and sent in order once the connection is back. Their callback runs once
+    // they have been sent and answered, or fails once they are dropped: replaced by a newer heartbeat, turned away by
+    // a full queue, or still queued when the manager is destroyed. One still unanswered when the timeout passes, or
+    // after three minutes without one, fails with WEBSOCKET_SEND_MESSAGE_TIMEOUT. Only the latest queued heartbeat is kept.
+    void SendSocketMessageAsync(Message &message, const SocketMessageCallback &callback, std::chrono::milliseconds timeout = std::chrono::milliseconds::zero());
     void Disconnect();
+    // Matches a wrapper switched to poll driven, whose socket work and timers only run when something polls them.
+    // Called once, before Connect.
+    void SetPollDriven() { m_pollDriven = true; }
+
+    // Messages waiting for the socket to accept them, and how many were turned away to keep control messages moving
+    OutboundScheduler::OutboundStats GetOutboundStats() const { return m_outboundScheduler->GetStats(); }
+    // Retries made and turned down across all requests, and whether requests are currently failing fast
+    RetryBudget::RetryBudgetStats GetRetryBudgetStats() const { return m_retryBudget->GetStats(); }
+    CircuitBreaker::CircuitBreakerStats GetCircuitBreakerStats() const { return m_circuitBreaker->GetStats(); }
+    // How quickly the service has been answering the action, once it has answered enough of them
+    bool TryGetLatencyStats(const std::string &action, LatencyEstimator::LatencyStats &stats) const { return m_latencyEstimator->TryGetStats(action, stats); }
 
 private:
+    // How a message sent while disconnected is handled
+    enum class ReplayPolicy { NONE, REPLAY, REPLAY_LATEST };
+
+    struct QueuedMessage {
+        std::string requestId;
+        std::string action;
+        std::shared_ptr<const std::string> jsonMessage;
+        SocketMessageCallback callback;
+        // Once it passes, the callback fails with WEBSOCKET_SEND_MESSAGE_TIMEOUT and the message is no longer queued.
+        // A flushed message is sent under what is left of it.
+        std::chrono::steady_clock::time_point deadline;
+        // Dequeues the message at its deadline. Cancelled once the message leaves the queue any other way.
+        TimerScheduler::TimerId expiryTimer;
+    };
+    // Shared with the wrapper's connected handler and with the callbacks of replayed messages, either of
+    // which can outlive the manager. A message is only queued, and a flush only stops, after checking the
+    // connection under the lock, so a message is never left queued behind the flush that should have sent it.
+    struct OfflineQueue {
+        std::mutex lock;
+        std::deque<QueuedMessage> messages;
+        std::size_t bytes = 0;
+        // Set while a flush is sending. Messages sent meanwhile queue behind it, so they aren't sent out of order.
+        bool flushing = false;
+    };
+
+    // How long one attempt waits for its response, and how many attempts a request gets
+    struct RequestPolicy {
+        int attemptTimeoutMillis;
+        int maxRetries;
+    };
+
+    // An attempt at a request, which a hedge sends a second time. The first response decides the attempt, unless
+    // it is a retriable failure and the other copy is still out.
+    struct HedgedAttempt {
+        std::mutex lock;
+        int outstanding = 1;
+        bool done = false;
+    };
+
+    static ReplayPolicy GetReplayPolicy(const std::string &action);
+    static RequestPolicy GetRequestPolicy(const std::string &action);
+    static OutboundScheduler::Priority GetPriority(const std::string &action);
+    static bool IsHedged(const std::string &action);
+    // How an attempt's outcome counts towards retrying it, and towards the breaker's and budget's view of the service
+    static RetryStrategy::AttemptResult ToAttemptResult(const GenericOutcome &outcome);
+    // Requires offlineQueue.lock. A queued message the new one replaces is handed back, to be failed.
+    static bool Enqueue(OfflineQueue &offlineQueue, QueuedMessage &&message, bool replaceQueued, QueuedMessage &replacedMessage);
+    // Returns false if the message already left the queue, so whatever took it completes it
+    static bool Dequeue(OfflineQueue &offlineQueue, const std::string &requestId);
+    // Requires offlineQueue.lock, which the timer waits on, so it can be scheduled before the message is enqueued
+    static TimerScheduler::TimerId ScheduleExpiry(TimerScheduler &timerScheduler, const std::shared_ptr<OfflineQueue> &offlineQueue,
+                                                  const QueuedMessage &message);
+    // What every request sent by one manager shares, and what the wrapper's connected handler holds on to
+    struct SendContext {
+        std::shared_ptr<OutboundScheduler> outboundScheduler;
+        std::shared_ptr<TimerScheduler> timerScheduler;
+        std::shared_ptr<RetryBudget> retryBudget;
+        std::shared_ptr<CircuitBreaker> circuitBreaker;
+        std::shared_ptr<LatencyEstimator> latencyEstimator;
+    };
+
+    SendContext GetSendContext() const {
+        return SendContext{m_outboundScheduler, m_timerScheduler, m_retryBudget, m_circuitBreaker, m_latencyEstimator};
+    }
+    static void FlushOfflineQueue(const std::shared_ptr<OfflineQueue> &offlineQueue, const std::shared_ptr<IWebSocketClientWrapper> &webSocketClientWrapper,
+                                  const SendContext &sendContext);
+    static void SendWithRetries(const std::shared_ptr<IWebSocketClientWrapper> &webSocketClientWrapper, const SendContext &sendContext,
+                                const std::string &action, const std::string &requestId,
+                                const std::shared_ptr<const std::string> &jsonMessage, std::chrono::steady_clock::time_point deadline,
+                                const SocketMessageCallback &callback, const std::string &hedgeRequestId = std::string(),
+                                const std::shared_ptr<const std::string> &hedgeJsonMessage = nullptr);
     static bool EndsWith(const std::string &actualString, const std::string &ending);
+    static Uri BuildUri(std::string websocketUrl, const std::string &authToken, const std::string &processId, const std::string &hostId,
+                        const std::string &fleetId);
 
     static constexpr const char *PID_KEY = "pID";
     static constexpr const char *SDK_VERSION_KEY = "sdkVersion";
@@ -52,8 +170,51 @@ private:
 
     static constexpr const char *REQUIRED_URL_ENDING = "/";
 
+    static constexpr const char *HEARTBEAT_SERVER_PROCESS = "HeartbeatServerProcess";
+    static constexpr const char *ACTIVATE_SERVER_PROCESS = "ActivateServerProcess";
+    static constexpr const char *TERMINATE_SERVER_PROCESS = "TerminateServerProcess";
+    static constexpr const char *ACTIVATE_GAME_SESSION = "ActivateGameSession";
+    static constexpr const char *ACCEPT_PLAYER_SESSION = "AcceptPlayerSession";
+    static constexpr const char *REMOVE_PLAYER_SESSION = "RemovePlayerSession";
+    static constexpr const char *UPDATE_PLAYER_SESSION_CREATION_POLICY = "UpdatePlayerSessionCreationPolicy";
+    static constexpr const char *DESCRIBE_PLAYER_SESSIONS = "DescribePlayerSessions";
+    static constexpr const char *START_MATCH_BACKFILL = "StartMatchBackfill";
+    static constexpr const char *STOP_MATCH_BACKFILL = "StopMatchBackfill";
+    static constexpr const char *GET_COMPUTE_CERTIFICATE = "GetComputeCertificate";
+    static constexpr const char *GET_FLEET_ROLE_CREDENTIALS = "GetFleetRoleCredentials";
+
+    // Player admission sits on the game's join path, so it gives up quickly rather than keep a player waiting
+    static constexpr const int PLAYER_ADMISSION_TIMEOUT_MILLIS = 5000;
+    static constexpr const int PLAYER_ADMISSION_MAX_RETRIES = 3;
+    // A heartbeat that doesn't get through is soon replaced by the next one
+    static constexpr const int HEARTBEAT_TIMEOUT_MILLIS = 10000;
+    static constexpr const int HEARTBEAT_MAX_RETRIES = 2;
+    static constexpr const int BULK_TIMEOUT_MILLIS = 10000;
+    static constexpr const int BULK_MAX_RETRIES = 3;
+    static constexpr const int DEFAULT_TIMEOUT_MILLIS = 20000;
+    static constexpr const int DEFAULT_MAX_RETRIES = 5;
+
+    // How long a blocking call in poll driven mode runs socket work for, and then waits for its response, each time round
+    static constexpr const int POLL_BUDGET_MICROS = 1000;
+    static constexpr const int POLL_WAIT_MILLIS = 1;
+
+    // Bytes of queued messages held while disconnected. Messages beyond it fail as they would without the queue.
+    static constexpr std::size_t OFFLINE_QUEUE_MAX_BYTES = 64 * 1024;
+    // How long a queued message without a timeout of its own waits for the connection, as long as the wrapper
+    // holds a send for a reconnect
+    static constexpr const int OFFLINE_QUEUE_MAX_WAIT_MILLIS = 180000;
+
     // The WebSocketClient that this class is managing.
     std::shared_ptr<IWebSocketClientWrapper> m_webSocketClientWrapper;
+    std::shared_ptr<TimerScheduler> m_timerScheduler;
+    std::shared_ptr<OfflineQueue> m_offlineQueue;
+    std::shared_ptr<OutboundScheduler> m_outboundScheduler;
+    // Shared by every request, so the whole process backs off together when the service is struggling
+    std::shared_ptr<RetryBudget> m_retryBudget;
+    std::shared_ptr<CircuitBreaker> m_circuitBreaker;
+    // Filled in by the wrapper as responses arrive, and read to size each attempt's timeout and hedge
+    std::shared_ptr<LatencyEstimator> m_latencyEstimator;
+    bool m_pollDriven = false;
 };
 } // namespace Internal
 } // namespace GameLift
@@ -12,23 +12,125 @@
 #pragma once
 #include <aws/gamelift/common/Outcome.h>
 #include <aws/gamelift/internal/model/Uri.h>
+#include <aws/gamelift/internal/network/LatencyEstimator.h>
+#include <aws/gamelift/internal/util/TimerScheduler.h>
+#include <chrono>
+#include <cstddef>
 #include <functional>
+#include <memory>
+#include <rapidjson/document.h>
 #include <string>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+/**
+ * Invoked exactly once with the response (or failure) of a message sent with SendSocketMessageAsync.
+ */
+typedef std::function<void(const GenericOutcome &)> SocketMessageCallback;
+
+/**
+ * Handles an incoming GameLift event. The message is parsed once on receipt and handed over as a JSON object.
+ */
+typedef std::function<GenericOutcome(const rapidjson::Value &)> GameLiftEventHandler;
+
 /**
  * Interface for a class that wraps a websocket implementation.
  */
 class IWebSocketClientWrapper {
 public:
     virtual Aws::GameLift::GenericOutcome Connect(const Uri &uri) = 0;
+    /**
+     * Connects without blocking the caller, e.g. to refresh the connection from a socket thread. The
+     * callback is invoked exactly once with the outcome. Wrappers without a native asynchronous path
+     * fall back to the blocking Connect.
+     */
+    virtual void ConnectAsync(const Uri &uri, const std::function<void(const GenericOutcome &)> &callback) { callback(Connect(uri)); }
     virtual Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const std::string &message) = 0;
+    /**
+     * Sends a message without blocking on its response. The callback runs on the socket thread that
+     * received the response, or on the calling thread if the message could not be sent. Wrappers
+     * without a native asynchronous path fall back to the blocking SendSocketMessage.
+     */
+    virtual void SendSocketMessageAsync(const std::string &requestId, const std::string &message, const SocketMessageCallback &callback) {
+        callback(SendSocketMessage(requestId, message));
+    }
+    /**
+     * Overloads taking the message as a character range, so a message serialized into a reused buffer
+     * can be sent without first being copied into a string. The range only needs to stay valid for
+     * the duration of the call. Wrappers that don't override these copy the range into a string.
+     */
+    virtual Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const char *message, std::size_t length) {
+        return SendSocketMessage(requestId, std::string(message, length));
+    }
+    virtual void SendSocketMessageAsync(const std::string &requestId, const char *message, std::size_t length, const SocketMessageCallback &callback) {
+        SendSocketMessageAsync(requestId, std::string(message, length), callback);
+    }
+    /**
+     * Sends with the given response deadline instead of the wrapper's default one. A request that gets no
+     * response in time, counting any wait for a reconnect, fails with a retriable error. Wrappers without
+     * per-request deadlines ignore the timeout.
+     */
+    virtual void SendSocketMessageAsync(const std::string &requestId, const char *message, std::size_t length, std::chrono::milliseconds timeout,
+                                        const SocketMessageCallback &callback) {
+        SendSocketMessageAsync(requestId, message, length, callback);
+    }
+    /**
+     * Withdraws a message still waiting for the connection to come back, e.g. because its caller has given up on
+     * it, so it isn't sent once the connection returns. Its callback gets WEBSOCKET_SEND_MESSAGE_TIMEOUT. A message
+     * already written is left to its response or timeout. Wrappers that never hold messages back do nothing.
+     */
+    virtual void CancelSend(const std::string &requestId) {}
+    /**
+     * How many bytes of written messages are still waiting for the socket. Sends are buffered without bound, so this
+     * is how a sender sees the socket falling behind. Wrappers that write straight through report 0.
+     */
+    virtual std::size_t GetBufferedAmount() { return 0; }
     virtual void Disconnect() = 0;
-    virtual void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) = 0;
+    virtual void RegisterGameLiftCallback(const std::string &gameLiftEvent, const GameLiftEventHandler &callback) = 0;
     virtual bool IsConnected() = 0;
+    /**
+     * Hands the wrapper the scheduler to run its reconnects and request deadlines on, instead of
+     * sleeping or blocking one of its own threads. Called once, before Connect.
+     */
+    virtual void SetTimerScheduler(const std::shared_ptr<TimerScheduler> &timerScheduler) {}
+    /**
+     * Switches the wrapper to running its socket work only when Poll is called, on the host's thread,
+     * instead of on threads of its own. Called once, before Connect.
+     */
+    virtual void SetPollDriven() {}
+    /**
+     * Trades throughput for a smaller footprint, for hosts that pack many server processes together: as
+     * few threads as the wrapper can work with, and connection state shared across connections where it
+     * can be. Called once, before Connect.
+     */
+    virtual void SetLowFootprint() {}
+    /**
+     * Keeps a second connection to the same endpoint open, so traffic can fail over to it when the active
+     * one drops. Wrappers without standby support reconnect as usual. Called once, before Connect.
+     */
+    virtual void SetWarmStandby() {}
+    /**
+     * Registers a handler to run each time a connection becomes usable: after Connect, a refresh, a
+     * reconnect or a failover. It runs on a socket or scheduler thread. Called once, before Connect.
+     */
+    virtual void SetConnectedHandler(const std::function<void()> &handler) {}
+    /**
+     * Hands the wrapper an estimator to record each response's round trip in, under the response's action.
+     * Called once, before Connect.
+     */
+    virtual void SetLatencyEstimator(const std::shared_ptr<LatencyEstimator> &latencyEstimator) {}
+    /**
+     * Fills in how long each phase of setting up the latest connection took: connect, TLS and upgrade. Wrappers
+     * that don't time their connections leave the timings as they are.
+     */
+    virtual void GetConnectTimings(Aws::GameLift::Server::Model::StartupTimings &timings) {}
+    /**
+     * Runs socket work that is ready, on the calling thread, until there is none left or the budget is
+     * spent. Returns how many handlers ran. Wrappers that run their own threads have nothing to do here.
+     */
+    virtual std::size_t Poll(std::chrono::microseconds budget) { return 0; }
 
     virtual ~IWebSocketClientWrapper() = default;
 };
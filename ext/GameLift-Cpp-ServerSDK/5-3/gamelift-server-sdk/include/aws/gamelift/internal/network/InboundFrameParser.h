@@ -0,0 +1,57 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <memory>
+#include <rapidjson/document.h>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Parses inbound websocket frames in place. String values in the resulting document point into the
+ * frame itself rather than being copied, and the DOM nodes are allocated from an arena owned by the
+ * parser that is reset at the start of every frame.
+ *
+ * A parser must only be used by one thread at a time. The document, and any strings borrowed from
+ * it, stay valid until the next call to Parse or until the frame is released.
+ */
+class InboundFrameParser {
+public:
+    typedef rapidjson::GenericDocument<rapidjson::UTF8<>, rapidjson::MemoryPoolAllocator<>, rapidjson::MemoryPoolAllocator<>> FrameDocument;
+
+    InboundFrameParser();
+    InboundFrameParser(const InboundFrameParser &) = delete;
+    InboundFrameParser &operator=(const InboundFrameParser &) = delete;
+
+    /**
+     * Parses the frame, overwriting its contents. Returns the root object, or nullptr if the frame
+     * isn't a JSON object.
+     */
+    const rapidjson::Value *Parse(std::string &frame);
+
+private:
+    // Large enough for typical frames, bigger ones spill over into chunks freed on the next reset
+    static constexpr const size_t ARENA_SIZE = 16 * 1024;
+    // The parser's working stack is allocated from the same arena
+    static constexpr const size_t PARSE_STACK_CAPACITY = 1024;
+
+    std::unique_ptr<char[]> m_arena;
+    rapidjson::MemoryPoolAllocator<> m_allocator;
+    FrameDocument m_document;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,89 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Tracks how quickly the service answers each action, from when a request is written to when its response arrives.
+ *
+ * Each action keeps a smoothed average of its round trips, and a histogram of them in buckets that are each 10%
+ * wider than the last, so any percentile can be read back to within 10%. Older samples are halved away as new ones
+ * arrive, so the estimates follow the service as it slows down or recovers.
+ */
+class LatencyEstimator {
+public:
+    // Percentiles aren't reported, and timeouts aren't adapted, until an action has had this many responses
+    static constexpr const int MIN_SAMPLES = 20;
+    // An adapted timeout allows a few times the slowest responses seen, but never less than a second
+    static constexpr const int TIMEOUT_P99_MULTIPLIER = 3;
+    static constexpr const int MIN_TIMEOUT_MILLIS = 1000;
+
+    struct LatencyStats {
+        std::size_t samples;
+        std::chrono::milliseconds smoothed;
+        std::chrono::milliseconds p95;
+        std::chrono::milliseconds p99;
+    };
+
+    LatencyEstimator() = default;
+
+    LatencyEstimator(const LatencyEstimator &) = delete;
+    LatencyEstimator &operator=(const LatencyEstimator &) = delete;
+
+    void Record(const std::string &action, std::chrono::steady_clock::duration roundTrip);
+
+    /**
+     * Returns false, and leaves stats untouched, until the action has had MIN_SAMPLES responses.
+     */
+    bool TryGetStats(const std::string &action, LatencyStats &stats) const;
+
+    /**
+     * Returns how long to wait for a response to the action: TIMEOUT_P99_MULTIPLIER times its 99th percentile,
+     * kept between MIN_TIMEOUT_MILLIS and the given ceiling. Actions without enough samples get the ceiling.
+     */
+    std::chrono::milliseconds GetTimeout(const std::string &action, std::chrono::milliseconds ceiling) const;
+
+private:
+    // Bucket i holds round trips from BUCKET_GROWTH^i to BUCKET_GROWTH^(i+1) ms. The last one starts around 3 minutes.
+    static constexpr const int BUCKET_COUNT = 128;
+    static constexpr const double BUCKET_GROWTH = 1.1;
+    // Weight of each new sample in the smoothed average, as for TCP's smoothed round trip time
+    static constexpr const double SMOOTHING = 0.125;
+    // Once the histogram holds this much weight, every bucket is halved
+    static constexpr const double DECAY_WEIGHT = 1000.0;
+
+    struct ActionLatency {
+        std::size_t samples;
+        double smoothedMillis;
+        double weight;
+        std::array<double, BUCKET_COUNT> buckets;
+    };
+
+    static std::chrono::milliseconds GetPercentile(const ActionLatency &actionLatency, double percentile);
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, ActionLatency> m_actions;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,128 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/common/Outcome.h>
+#include <aws/gamelift/internal/util/TimerScheduler.h>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Decides which outbound message goes to the socket next when the socket can't keep up.
+ *
+ * While the socket keeps up, messages go straight out in the order they are submitted. Once the bytes it has yet to
+ * send reach the high-water mark, or a write is refused for lack of buffer space, messages queue in one lane per
+ * priority and are written highest priority first once it has drained, so a burst of bulk requests never holds up a
+ * heartbeat. The lanes are bounded:
+ * bulk messages are rejected once they fill their share, and queued bulk messages are shed to make room for higher
+ * priority ones. Control messages are never rejected.
+ */
+class OutboundScheduler {
+public:
+    // In the order lanes are written
+    enum class Priority { CONTROL, PLAYER_ADMISSION, BULK };
+
+    static constexpr const std::size_t DEFAULT_MAX_QUEUED_BYTES = 256 * 1024;
+    static constexpr const std::size_t DEFAULT_MAX_QUEUED_BULK_BYTES = 64 * 1024;
+    // Unsent bytes past which newly submitted messages wait their turn by priority
+    static constexpr const std::size_t DEFAULT_HIGH_WATER_BYTES = 64 * 1024;
+    // How often a blocked scheduler checks whether the socket has drained
+    static constexpr const int BACKPRESSURE_RETRY_MILLIS = 20;
+    // A message refused this many times is failed with the refusal, so its sender's own retries take over
+    static constexpr const int MAX_WRITE_REFUSALS = 3;
+
+    typedef std::function<void(const GenericOutcome &)> WriteCallback;
+    // Writes one message and invokes the callback exactly once with its outcome. A retriable failure reported before
+    // the write returns means the socket refused it; the message stays queued and is written again later.
+    typedef std::function<void(const WriteCallback &)> Write;
+    // How many bytes the socket has been handed but not yet sent
+    typedef std::function<std::size_t()> BufferedAmount;
+
+    struct OutboundStats {
+        std::size_t queuedMessages;
+        std::size_t queuedBytes;
+        std::size_t rejectedMessages;
+        std::size_t shedMessages;
+    };
+
+    // Writes refused by the socket are retried from a timer on the given scheduler
+    explicit OutboundScheduler(std::shared_ptr<TimerScheduler> timerScheduler, std::size_t maxQueuedBytes = DEFAULT_MAX_QUEUED_BYTES,
+                               std::size_t maxQueuedBulkBytes = DEFAULT_MAX_QUEUED_BULK_BYTES);
+    ~OutboundScheduler();
+
+    OutboundScheduler(const OutboundScheduler &) = delete;
+    OutboundScheduler &operator=(const OutboundScheduler &) = delete;
+
+    /**
+     * Writes the message now if nothing is queued ahead of it, and queues it otherwise. The callback receives the
+     * write's outcome, or WEBSOCKET_SEND_MESSAGE_FAILURE if the message was rejected or shed. Safe to call from any
+     * thread, including from a write's callback.
+     */
+    void Submit(Priority priority, std::size_t bytes, Write write, WriteCallback callback);
+
+    /**
+     * Holds messages back whenever the socket has at least highWaterBytes still to send, and resumes writing once it
+     * drains below that. Without it, only refused writes hold messages back. Called once, before the first Submit.
+     */
+    void SetBufferedAmount(BufferedAmount bufferedAmount, std::size_t highWaterBytes = DEFAULT_HIGH_WATER_BYTES);
+
+    OutboundStats GetStats() const;
+
+private:
+    static constexpr const int PRIORITY_COUNT = 3;
+
+    struct QueuedWrite {
+        std::size_t bytes;
+        int refusals;
+        Write write;
+        WriteCallback callback;
+    };
+
+    // Retry timers hold on to this rather than the scheduler, so one that fires late never touches a destroyed scheduler
+    struct SharedState {
+        std::shared_ptr<TimerScheduler> timerScheduler;
+        std::size_t maxQueuedBytes;
+        std::size_t maxQueuedBulkBytes;
+        BufferedAmount bufferedAmount;
+        std::size_t highWaterBytes;
+
+        mutable std::mutex mutex;
+        std::deque<QueuedWrite> lanes[PRIORITY_COUNT];
+        std::size_t laneBytes[PRIORITY_COUNT];
+        // Set while a thread is writing queued messages, so only one does at a time
+        bool dispatching;
+        // Set from a refused write, or from the socket reaching the high-water mark, until the socket has drained
+        bool blocked;
+        bool stopping;
+        std::size_t rejectedMessages;
+        std::size_t shedMessages;
+    };
+
+    static void Dispatch(const std::shared_ptr<SharedState> &state);
+    static bool IsAboveHighWater(const SharedState &state);
+    // Requires state.blocked. Clears it and dispatches once the socket has drained.
+    static void ScheduleResume(const std::shared_ptr<SharedState> &state);
+    static std::size_t GetQueuedBytes(const SharedState &state);
+
+    std::shared_ptr<SharedState> m_state;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,148 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Fixed-capacity, lock-free table correlating in-flight requests with their responses.
+ *
+ * Entries are keyed by a 62-bit request handle. Each handle probes a short window of slots starting
+ * at (handle % Capacity). A slot's key and state are packed into a single atomic word, so claiming,
+ * publishing and taking an entry are each one compare-and-swap and a response can never take an
+ * entry that was recycled for a different handle.
+ *
+ * Inserting a handle that is already in flight is rejected on a best-effort basis: two concurrent
+ * inserts of the same handle may both succeed, in which case they are taken one at a time.
+ */
+template <typename T, std::size_t Capacity = 1024> class RequestCorrelationTable {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    enum class InsertResult { INSERTED, DUPLICATE, FULL };
+
+    // Handles are truncated to this many bits to leave room for the slot state
+    static constexpr const std::uint64_t HANDLE_MASK = (std::uint64_t(1) << 62) - 1;
+    static constexpr const std::size_t MAX_PROBE_LENGTH = Capacity < 16 ? Capacity : 16;
+
+    RequestCorrelationTable() : m_slots(new Slot[Capacity]) {}
+
+    ~RequestCorrelationTable() { delete[] m_slots; }
+
+    RequestCorrelationTable(const RequestCorrelationTable &) = delete;
+    RequestCorrelationTable &operator=(const RequestCorrelationTable &) = delete;
+
+    /**
+     * Stores the value under the handle. Returns FULL when every slot in the handle's probe window is
+     * in use; the caller should treat this as a retriable condition.
+     */
+    InsertResult TryInsert(std::uint64_t handle, T &&value) {
+        handle &= HANDLE_MASK;
+        const std::size_t start = static_cast<std::size_t>(handle) & (Capacity - 1);
+
+        for (std::size_t probe = 0; probe < MAX_PROBE_LENGTH; probe++) {
+            std::uint64_t tag = m_slots[(start + probe) & (Capacity - 1)].tag.load(std::memory_order_acquire);
+            if (tag != FREE && KeyOf(tag) == handle) {
+                return InsertResult::DUPLICATE;
+            }
+        }
+
+        for (std::size_t probe = 0; probe < MAX_PROBE_LENGTH; probe++) {
+            Slot &slot = m_slots[(start + probe) & (Capacity - 1)];
+            std::uint64_t expected = FREE;
+            if (slot.tag.compare_exchange_strong(expected, MakeTag(handle, CLAIMED), std::memory_order_acquire, std::memory_order_relaxed)) {
+                slot.value = std::move(value);
+                slot.tag.store(MakeTag(handle, PENDING), std::memory_order_release);
+                return InsertResult::INSERTED;
+            }
+        }
+
+        return InsertResult::FULL;
+    }
+
+    /**
+     * Removes the entry stored under the handle and moves its value out. Returns false if the handle
+     * isn't in flight, e.g. because its response or timeout already took it.
+     */
+    bool TryTake(std::uint64_t handle, T &value) {
+        handle &= HANDLE_MASK;
+        const std::size_t start = static_cast<std::size_t>(handle) & (Capacity - 1);
+        const std::uint64_t pendingTag = MakeTag(handle, PENDING);
+
+        for (std::size_t probe = 0; probe < MAX_PROBE_LENGTH; probe++) {
+            Slot &slot = m_slots[(start + probe) & (Capacity - 1)];
+            std::uint64_t expected = pendingTag;
+            if (slot.tag.compare_exchange_strong(expected, MakeTag(handle, TAKING), std::memory_order_acquire, std::memory_order_relaxed)) {
+                value = std::move(slot.value);
+                slot.value = T();
+                slot.tag.store(FREE, std::memory_order_release);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Takes every entry that is currently in flight, invoking the consumer with each value.
+     */
+    template <typename Consumer> void TakeAll(Consumer consumer) {
+        for (std::size_t i = 0; i < Capacity; i++) {
+            Slot &slot = m_slots[i];
+            std::uint64_t tag = slot.tag.load(std::memory_order_acquire);
+            if (StateOf(tag) == PENDING && slot.tag.compare_exchange_strong(tag, MakeTag(KeyOf(tag), TAKING), std::memory_order_acquire)) {
+                T value = std::move(slot.value);
+                slot.value = T();
+                slot.tag.store(FREE, std::memory_order_release);
+                consumer(value);
+            }
+        }
+    }
+
+private:
+    // Slot states, stored in the low two bits of the tag
+    static constexpr const std::uint64_t FREE = 0;
+    static constexpr const std::uint64_t CLAIMED = 1;
+    static constexpr const std::uint64_t PENDING = 2;
+    static constexpr const std::uint64_t TAKING = 3;
+
+    static std::uint64_t MakeTag(std::uint64_t handle, std::uint64_t state) { return (handle << 2) | state; }
+    static std::uint64_t KeyOf(std::uint64_t tag) { return tag >> 2; }
+    static std::uint64_t StateOf(std::uint64_t tag) { return tag & 3; }
+
+    struct SlotData {
+        std::atomic<std::uint64_t> tag;
+        T value;
+
+        SlotData() : tag(FREE), value() {}
+    };
+
+    // Slots are padded out to a multiple of a cache line so that neighbouring requests, which get
+    // consecutive handles, don't contend on the same line
+    static constexpr const std::size_t CACHE_LINE_SIZE = 64;
+    struct Slot : SlotData {
+        char padding[CACHE_LINE_SIZE - sizeof(SlotData) % CACHE_LINE_SIZE];
+    };
+
+    Slot *m_slots;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,84 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Keeps the addresses a host and port resolved to for a while, so reconnects and refreshes don't all go back to DNS.
+ * When the service drops every process at once, that is thousands of lookups of the same name at the same moment.
+ *
+ * Addresses are kept in the order they should be tried: whichever last connected first, then alternating between
+ * IPv6 and IPv4. A host whose addresses all fail to connect should be invalidated, so the next attempt resolves it
+ * again rather than waiting out the TTL.
+ */
+class ResolvedEndpointCache {
+public:
+    static constexpr const int DEFAULT_TTL_SECONDS = 300;
+    // The endpoint, plus the few a connection refresh may move to
+    static constexpr const int DEFAULT_MAX_HOSTS = 8;
+
+    explicit ResolvedEndpointCache(std::chrono::seconds ttl = std::chrono::seconds(DEFAULT_TTL_SECONDS), int maxHosts = DEFAULT_MAX_HOSTS);
+
+    ResolvedEndpointCache(const ResolvedEndpointCache &) = delete;
+    ResolvedEndpointCache &operator=(const ResolvedEndpointCache &) = delete;
+
+    /**
+     * Fills in the addresses cached for the host and port, and returns whether there were any that haven't expired.
+     */
+    bool Lookup(const std::string &hostAndPort, std::vector<std::string> &addresses,
+                std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    /**
+     * Caches the addresses the host and port just resolved to, in the order the resolver returned them, and returns
+     * them in the order they should be tried.
+     */
+    std::vector<std::string> Store(const std::string &hostAndPort, const std::vector<std::string> &addresses,
+                                   std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    // Moves the address that just connected to the front, so the next connection tries it first
+    void Prefer(const std::string &hostAndPort, const std::string &address);
+
+    void Invalidate(const std::string &hostAndPort);
+
+    // Alternates address families, starting with the first one's, keeping the resolver's order within each (RFC 8305)
+    static std::vector<std::string> InterleaveFamilies(const std::vector<std::string> &addresses);
+
+private:
+    struct HostAddresses {
+        std::string hostAndPort;
+        std::vector<std::string> addresses;
+        std::chrono::steady_clock::time_point expiresAt;
+    };
+
+    // Requires m_mutex
+    std::vector<HostAddresses>::iterator FindHost(const std::string &hostAndPort);
+
+    const std::chrono::seconds m_ttl;
+    const std::size_t m_maxHosts;
+
+    std::mutex m_mutex;
+    // Least recently stored host first
+    std::vector<HostAddresses> m_hosts;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,97 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <openssl/ssl.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Keeps the TLS sessions the client was handed, by host name, so later connections to the same host can resume
+ * one instead of repeating the full key exchange.
+ *
+ * Sessions are captured from every connection made with a context the cache is attached to, including TLS 1.3
+ * tickets that arrive after the handshake. A TLS 1.2 session is reused for every connection to its host; a TLS
+ * 1.3 ticket is only used once, as RFC 8446 asks, and each resumed connection is handed fresh ones.
+ */
+class TlsSessionCache : public std::enable_shared_from_this<TlsSessionCache> {
+public:
+    // The endpoint, plus the few a connection refresh may move to
+    static constexpr const int DEFAULT_MAX_HOSTS = 8;
+    // A TLS 1.3 server sends a couple of tickets per connection, enough for an active and a standby connection
+    static constexpr const int MAX_SESSIONS_PER_HOST = 2;
+
+    struct TlsSessionStats {
+        std::size_t fullHandshakes;
+        std::size_t resumedHandshakes;
+    };
+
+    explicit TlsSessionCache(int maxHosts = DEFAULT_MAX_HOSTS);
+    ~TlsSessionCache();
+
+    TlsSessionCache(const TlsSessionCache &) = delete;
+    TlsSessionCache &operator=(const TlsSessionCache &) = delete;
+
+    /**
+     * Captures the sessions of every connection made with the context from now on. Called once per context, on a
+     * cache owned by a shared_ptr: the context keeps the cache alive for as long as it is around itself.
+     */
+    void Attach(SSL_CTX *context);
+
+    /**
+     * Offers a cached session for the connection's host, named by its SNI, before its handshake starts. Returns
+     * whether there was one. The server may still turn it down and do a full handshake.
+     */
+    bool Resume(SSL *connection);
+
+    /**
+     * Counts a finished handshake as full or resumed.
+     */
+    void RecordHandshake(SSL *connection);
+
+    TlsSessionStats GetStats() const;
+
+private:
+    struct HostSessions {
+        std::string host;
+        // Newest last
+        std::deque<SSL_SESSION *> sessions;
+    };
+
+    static int OnNewSession(SSL *connection, SSL_SESSION *session);
+    static int GetContextIndex();
+    static bool IsExpired(SSL_SESSION *session);
+
+    // Takes ownership of the session. Returns false, without taking it, if the connection has no host name.
+    bool Store(SSL *connection, SSL_SESSION *session);
+    // Requires m_mutex
+    std::vector<HostSessions>::iterator FindHost(const std::string &host);
+
+    const std::size_t m_maxHosts;
+
+    mutable std::mutex m_mutex;
+    // Least recently stored host first
+    std::vector<HostSessions> m_hosts;
+    TlsSessionStats m_stats;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -11,16 +11,41 @@
  */
 #pragma once
 
+#include <aws/gamelift/internal/network/EndpointCachingTransport.h>
 #include <aws/gamelift/internal/network/IWebSocketClientWrapper.h>
-#include <condition_variable>
+#include <aws/gamelift/internal/network/RequestCorrelationTable.h>
+#include <aws/gamelift/internal/network/TlsSessionCache.h>
+#include <aws/gamelift/internal/util/TimerScheduler.h>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 #include <websocketpp/client.hpp>
 #include <websocketpp/config/asio_client.hpp>
 
+#ifndef GAMELIFT_WEBSOCKET_READ_BUFFER_SIZE
+// Bytes each connection reads from its socket at a time, allocated once per connection. GameLift messages are
+// small, so builds for densely packed fleets can lower it.
+#define GAMELIFT_WEBSOCKET_READ_BUFFER_SIZE 16384
+#endif
+
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-typedef websocketpp::client<websocketpp::config::asio_tls_client> WebSocketppClientType;
+struct WebSocketppClientConfig : public websocketpp::config::asio_tls_client {
+    typedef WebSocketppClientConfig type;
+    typedef websocketpp::config::asio_tls_client base;
+
+    static const size_t connection_read_buffer_size = GAMELIFT_WEBSOCKET_READ_BUFFER_SIZE;
+
+    // Connect attempts, including reconnects after a drop, refreshes and the warm standby, reuse the endpoint's
+    // resolved addresses and race them instead of resolving it every time
+    typedef EndpointCachingTransport<base::transport_config> transport_type;
+};
+typedef websocketpp::client<WebSocketppClientConfig> WebSocketppClientType;
 
 /**
  * Implementation of a WebSocketClientWrapper for the Websocketpp Library.
@@ -28,13 +53,47 @@ typedef websocketpp::client<websocketpp::config::asio_tls_client> WebSocketppCli
  */
 class WebSocketppClientWrapper : public IWebSocketClientWrapper {
 public:
+    // Connection refreshes are make-before-break: sends move to the new connection as soon as it opens, and the
+    // old one is closed once the requests sent on it are answered, or dropped at the drain deadline.
+    struct ConnectionRefreshStats {
+        std::size_t refreshes;
+        std::size_t drainedRequests;
+        std::size_t droppedRequests;
+        std::chrono::milliseconds lastRefreshDuration;
+    };
+
+    // Every transition happens in a socket handler or a timer task, neither of which ever blocks. Sends made while
+    // the state isn't CONNECTED wait for it to get there, and go out as soon as it does.
+    enum class ConnectionState { DISCONNECTED, CONNECTING, CONNECTED, RECONNECTING };
+
     WebSocketppClientWrapper(std::shared_ptr<WebSocketppClientType> webSocketClient);
 
     Aws::GameLift::GenericOutcome Connect(const Uri &uri) override;
+    void ConnectAsync(const Uri &uri, const std::function<void(const GenericOutcome &)> &callback) override;
     Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const std::string &message) override;
+    void SendSocketMessageAsync(const std::string &requestId, const std::string &message, const SocketMessageCallback &callback) override;
+    Aws::GameLift::GenericOutcome SendSocketMessage(const std::string &requestId, const char *message, std::size_t length) override;
+    void SendSocketMessageAsync(const std::string &requestId, const char *message, std::size_t length, const SocketMessageCallback &callback) override;
+    void SendSocketMessageAsync(const std::string &requestId, const char *message, std::size_t length, std::chrono::milliseconds timeout,
+                                const SocketMessageCallback &callback) override;
+    void CancelSend(const std::string &requestId) override;
+    std::size_t GetBufferedAmount() override;
     void Disconnect() override;
-    void RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) override;
+    void RegisterGameLiftCallback(const std::string &gameLiftEvent, const GameLiftEventHandler &callback) override;
     bool IsConnected() override;
+    void SetTimerScheduler(const std::shared_ptr<TimerScheduler> &timerScheduler) override;
+    void SetPollDriven() override;
+    void SetLowFootprint() override;
+    void SetWarmStandby() override;
+    void SetConnectedHandler(const std::function<void()> &handler) override;
+    void SetLatencyEstimator(const std::shared_ptr<LatencyEstimator> &latencyEstimator) override;
+    void GetConnectTimings(Aws::GameLift::Server::Model::StartupTimings &timings) override;
+    std::size_t Poll(std::chrono::microseconds budget) override;
+
+    ConnectionRefreshStats GetRefreshStats();
+    // How many connections resumed a TLS session instead of doing the full handshake
+    TlsSessionCache::TlsSessionStats GetTlsSessionStats() const { return m_tlsSessionCache->GetStats(); }
+    ConnectionState GetConnectionState();
 
     ~WebSocketppClientWrapper();
 
@@ -42,30 +101,125 @@ private:
     const int WEBSOCKET_OPEN_HANDSHAKE_TIMEOUT_MILLIS = 20000; // 20 seconds
     const int SERVICE_CALL_TIMEOUT_MILLIS = 20000;             // 20 seconds
     const int OK_STATUS_CODE = 200;
-    const int WAIT_FOR_RECONNECT_RETRY_DELAY_SECONDS = 5;
-    const int WAIT_FOR_RECONNECT_MAX_RETRIES = 180 / WAIT_FOR_RECONNECT_RETRY_DELAY_SECONDS; // retry up to 3 minutes
+    const int POLL_WAIT_MILLIS = 1;
+    const int DRAIN_DEADLINE_MILLIS = 5000;
+    const int STANDBY_RETRY_MILLIS = 5000;
 
     // The WebSocketpp objects this class wraps
     std::shared_ptr<WebSocketppClientType> m_webSocketClient;
     WebSocketppClientType::connection_ptr m_connection;
     std::unique_ptr<std::thread> m_socket_thread_1;
     std::unique_ptr<std::thread> m_socket_thread_2;
+    // When poll driven, the socket threads are never started and socket work only runs in Poll
+    bool m_pollDriven;
+    // In low footprint mode a single socket thread runs every connection
+    bool m_lowFootprint;
+    // Every connection shares one TLS context, configured once up front. Reconnects and refreshes to a host the
+    // wrapper has connected to before resume the TLS session from the cache instead of doing the full handshake.
+    std::shared_ptr<TlsSessionCache> m_tlsSessionCache;
+    websocketpp::lib::shared_ptr<asio::ssl::context> m_sharedTlsContext;
+    // With a warm standby, a second connection to m_uri is kept open while connected. It carries no requests until
+    // the active connection drops abnormally and it takes over.
+    bool m_warmStandby;
+
+    // Reconnects, connect retries and request deadlines are timers on this scheduler. Its tasks refer to
+    // this wrapper, so a scheduler shared with the wrapper must be stopped before the wrapper is destroyed.
+    std::shared_ptr<TimerScheduler> m_timerScheduler;
+    bool m_ownsTimerScheduler;
+    std::function<void()> m_connectedHandler;
+    std::shared_ptr<LatencyEstimator> m_latencyEstimator;
 
-    // synchronization variables
+    // synchronization variables, guarding the connection state below
     std::mutex m_lock;
-    std::condition_variable m_cond;
-    bool m_connectionStateChanged;
     websocketpp::lib::error_code m_fail_error_code;
     websocketpp::http::status_code::value m_fail_response_code;
+    ConnectionState m_connectionState;
+    // How the handshake of the latest connection to open went, phase by phase
+    Aws::GameLift::Server::Model::StartupTimings m_connectTimings;
+
+    // Messages sent while connecting or reconnecting wait here until that finishes, their response deadline passes
+    // or their caller withdraws them. The wait counts towards the deadline.
+    struct SendAwaitingReconnect {
+        std::string requestId;
+        std::string message;
+        std::chrono::steady_clock::time_point deadline;
+        SocketMessageCallback callback;
+        TimerScheduler::TimerId timeoutTimer;
+    };
+    std::vector<SendAwaitingReconnect> m_sendsAwaitingReconnect;
+
+    // The handles of the requests in flight on m_connection, and on the connection it replaced while that drains.
+    // Only requests still listed when the drain deadline passes have to be dropped.
+    std::vector<uint64_t> m_requestHandles;
+    std::vector<uint64_t> m_drainingRequestHandles;
+    WebSocketppClientType::connection_ptr m_drainingConnection;
+    TimerScheduler::TimerId m_drainTimer;
+    std::size_t m_drainingRequestCount;
+    // Set by a Connect that replaces an open connection
+    bool m_refreshing;
+    std::chrono::steady_clock::time_point m_refreshStart;
+    ConnectionRefreshStats m_refreshStats;
+    WebSocketppClientType::connection_ptr m_standbyConnection;
+    bool m_standbyConnecting;
 
-    std::map<std::string, std::function<GenericOutcome(std::string)>> m_eventHandlers;
-    std::mutex m_requestToPromiseLock;
-    std::map<std::string, std::promise<GenericOutcome>> m_requestIdToPromise;
+    // Event handlers are matched on a hash of the action computed at registration, so dispatching a
+    // message needs neither a key string nor a tree walk.
+    struct EventHandlerEntry {
+        std::size_t actionHash;
+        std::string action;
+        GameLiftEventHandler handler;
+    };
+    std::vector<EventHandlerEntry> m_eventHandlers;
+    // A request stays pending until its response arrives or its timer expires, whichever is first.
+    // Pending requests are keyed by the handle encoded in their request ID (see Message::ToRequestHandle).
+    struct PendingRequest {
+        SocketMessageCallback callback;
+        TimerScheduler::TimerId timeoutTimer;
+        std::chrono::steady_clock::time_point sentAt;
+    };
+    RequestCorrelationTable<PendingRequest> m_pendingRequests;
     Uri m_uri;
+    // When each phase of a connect attempt finished. The transport calls back in order, one phase at a time.
+    struct ConnectAttemptTimes {
+        std::chrono::steady_clock::time_point started;
+        std::chrono::steady_clock::time_point tcpConnected;
+        std::chrono::steady_clock::time_point tlsConnected;
+    };
 
     // Helper methods
-    WebSocketppClientType::connection_ptr PerformConnect(const Uri &uri, websocketpp::lib::error_code &error);
-    Aws::GameLift::GenericOutcome SendSocketMessageAsync(const std::string &message);
+    void StartSocketThreads();
+    Aws::GameLift::GenericOutcome AwaitOutcome(std::future<Aws::GameLift::GenericOutcome> &future);
+    void ConnectWithRetries(const Uri &uri, const std::function<void(const GenericOutcome &)> &onComplete);
+    void AttemptConnect(const Uri &uri, const std::function<void(bool)> &attemptComplete);
+    Aws::GameLift::GenericOutcome ToConnectFailureOutcome(const websocketpp::lib::error_code &errorCode, websocketpp::http::status_code::value responseCode);
+    static bool IsRetriableConnectFailure(const websocketpp::lib::error_code &errorCode, websocketpp::http::status_code::value responseCode);
+    static std::string DescribeConnectFailure(const websocketpp::lib::error_code &errorCode, websocketpp::http::status_code::value responseCode);
+    WebSocketppClientType::connection_ptr GetConnection();
+    Aws::GameLift::GenericOutcome WriteSocketMessage(const char *message, std::size_t length);
+    // A response names its action, so its round trip is recorded under it. Other completions pass none.
+    bool CompletePendingRequest(const std::string &requestId, const GenericOutcome &outcome, const std::string &respondingAction = std::string());
+    void FailPendingRequests();
+    void WaitForReconnect(const std::string &requestId, const char *message, std::size_t length, std::chrono::milliseconds timeout,
+                          const SocketMessageCallback &callback);
+    void ResumeSendsAwaitingReconnect(bool connected);
+    // Takes the send waiting under the request ID off the list and cancels its timeout. Returns its callback, or an
+    // empty one if it has already been sent, failed or withdrawn.
+    SocketMessageCallback TakeSendAwaitingReconnect(const std::string &requestId);
+    void FailRequestsInFlight();
+    void TrackRequest(uint64_t requestHandle);
+    void UntrackRequest(uint64_t requestHandle);
+    void StartDrain(const WebSocketppClientType::connection_ptr &oldConnection);
+    void FinishDrain();
+    void OpenStandby();
+    void OnStandbyConnected(websocketpp::connection_hdl connection);
+    void OnStandbyFailed();
+    bool FailOverToStandby(const WebSocketppClientType::connection_ptr &droppedConnection);
+    const GameLiftEventHandler *FindEventHandler(const char *action, std::size_t actionLength) const;
+    static std::size_t HashAction(const char *action, std::size_t actionLength);
+    websocketpp::lib::shared_ptr<asio::ssl::context> CreateTlsContext();
+    // Run once the connection's TCP socket is up, before its TLS handshake, and once the handshake is done
+    void ResumeTlsSession(websocketpp::connection_hdl connection);
+    void RecordTlsHandshake(websocketpp::connection_hdl connection);
 
     // CallBacks
     void OnConnected(websocketpp::connection_hdl connection);
@@ -28,7 +28,7 @@ public:
     ~DescribePlayerSessionsCallback() = default;
 
     // Methods
-    GenericOutcome OnDescribePlayerSessions(const std::string &data);
+    GenericOutcome OnDescribePlayerSessions(const rapidjson::Value &data);
 
     static constexpr const char *DESCRIBE_PLAYER_SESSIONS = "DescribePlayerSessions";
 };
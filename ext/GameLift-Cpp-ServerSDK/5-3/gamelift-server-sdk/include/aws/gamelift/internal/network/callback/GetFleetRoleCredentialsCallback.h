@@ -29,7 +29,7 @@ public:
     ~GetFleetRoleCredentialsCallback() = default;
 
     // Methods
-    GenericOutcome OnGetFleetRoleCredentials(const std::string &data);
+    GenericOutcome OnGetFleetRoleCredentials(const rapidjson::Value &data);
 
     static constexpr const char *GET_FLEET_ROLE_CREDENTIALS = "GetFleetRoleCredentials";
 };
@@ -28,7 +28,7 @@ public:
     ~StartMatchBackfillCallback() = default;
 
     // Methods
-    GenericOutcome OnStartMatchBackfill(const std::string &data);
+    GenericOutcome OnStartMatchBackfill(const rapidjson::Value &data);
 
     static constexpr const char *START_MATCH_BACKFILL = "StartMatchBackfill";
 };
@@ -0,0 +1,85 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Stops attempts going out while the service is clearly failing, shared by every retry strategy that is handed it.
+ *
+ * CLOSED lets every attempt through. After enough consecutive attempts fail, the breaker opens and refuses
+ * attempts outright, so callers fail fast instead of waiting out timeouts. Once it has been open for a while it
+ * turns HALF_OPEN and lets a few probe attempts through: if one succeeds the breaker closes, and if one fails it
+ * opens again.
+ */
+class CircuitBreaker {
+public:
+    enum class State { CLOSED, OPEN, HALF_OPEN };
+
+    static constexpr const int DEFAULT_FAILURE_THRESHOLD = 10;
+    static constexpr const int DEFAULT_OPEN_MILLIS = 5000;
+    static constexpr const int DEFAULT_HALF_OPEN_PROBES = 1;
+
+    struct CircuitBreakerStats {
+        State state;
+        std::size_t timesOpened;
+        std::size_t rejectedAttempts;
+    };
+
+    explicit CircuitBreaker(int failureThreshold = DEFAULT_FAILURE_THRESHOLD,
+                            std::chrono::milliseconds openDuration = std::chrono::milliseconds(DEFAULT_OPEN_MILLIS),
+                            int halfOpenProbes = DEFAULT_HALF_OPEN_PROBES);
+
+    CircuitBreaker(const CircuitBreaker &) = delete;
+    CircuitBreaker &operator=(const CircuitBreaker &) = delete;
+
+    /**
+     * Returns whether an attempt may go out now. Every attempt let through must be followed by exactly one call
+     * to RecordSuccess, RecordFailure or Release.
+     */
+    bool TryAcquire(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    // Success means the service answered, even if it turned the request down
+    void RecordSuccess();
+    // Failure means the service failed, with a 5xx response or none in time
+    void RecordFailure(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    // For an attempt let through that never reached the service. Changes nothing, except that a probe can go out in its place.
+    void Release();
+
+    CircuitBreakerStats GetStats() const;
+
+private:
+    // Requires m_mutex
+    void Open(std::chrono::steady_clock::time_point now);
+
+    const int m_failureThreshold;
+    const std::chrono::milliseconds m_openDuration;
+    const int m_halfOpenProbes;
+
+    mutable std::mutex m_mutex;
+    State m_state;
+    int m_consecutiveFailures;
+    int m_probesInFlight;
+    std::chrono::steady_clock::time_point m_openedAt;
+    std::size_t m_timesOpened;
+    std::size_t m_rejectedAttempts;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
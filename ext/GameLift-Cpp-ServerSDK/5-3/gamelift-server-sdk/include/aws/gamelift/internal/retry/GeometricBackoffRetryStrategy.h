@@ -21,7 +21,8 @@ public:
         : m_maxRetries(DEFAULT_MAX_RETRIES), m_initialRetryIntervalSeconds(DEFAULT_INITIAL_RETRY_INTERVAL_SECONDS),
           m_maxRetryIntervalSeconds(MAX_RETRY_INTERVAL_SECONDS), m_retryFactor(DEFAULT_RETRY_FACTOR) {}
 
-    void apply(const std::function<bool(void)> &callable) override;
+protected:
+    int getRetryDelayMillis(int retry) override;
 
 private:
     static constexpr const int DEFAULT_MAX_RETRIES = 7;
@@ -11,17 +11,22 @@
  */
 
 #include <aws/gamelift/internal/retry/RetryStrategy.h>
+#include <random>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 class JitteredGeometricBackoffRetryStrategy : public RetryStrategy {
 public:
-    JitteredGeometricBackoffRetryStrategy()
-        : m_maxRetries(DEFAULT_MAX_RETRIES), m_initialRetryIntervalMs(DEFAULT_INITIAL_RETRY_INTERVAL_MS), m_retryFactor(DEFAULT_RETRY_FACTOR),
-          m_minRetryDelayMs(DEFAULT_MIN_RETRY_DELAY_MS) {}
+    JitteredGeometricBackoffRetryStrategy() : JitteredGeometricBackoffRetryStrategy(DEFAULT_MAX_RETRIES) {}
 
-    void apply(const std::function<bool(void)> &callable) override;
+    // maxRetries counts every attempt, including the first
+    explicit JitteredGeometricBackoffRetryStrategy(int maxRetries)
+        : m_maxRetries(maxRetries), m_initialRetryIntervalMs(DEFAULT_INITIAL_RETRY_INTERVAL_MS), m_retryFactor(DEFAULT_RETRY_FACTOR),
+          m_minRetryDelayMs(DEFAULT_MIN_RETRY_DELAY_MS), m_randGenerator(std::random_device()()) {}
+
+protected:
+    int getRetryDelayMillis(int retry) override;
 
 private:
     static constexpr const int DEFAULT_MAX_RETRIES = 5;
@@ -33,6 +38,7 @@ private:
     int m_initialRetryIntervalMs;
     int m_retryFactor;
     int m_minRetryDelayMs;
+    std::mt19937 m_randGenerator;
 };
 } // namespace Internal
 } // namespace GameLift
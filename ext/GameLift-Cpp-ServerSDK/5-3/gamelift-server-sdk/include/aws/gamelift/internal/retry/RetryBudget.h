@@ -0,0 +1,68 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Caps how much retrying a process does, shared by every retry strategy that is handed it.
+ *
+ * A token bucket: each retry spends a whole token, and each attempt that gets through earns back a fraction of
+ * one. While calls succeed, the bucket stays full and retries go out as usual. Once most calls fail, retries
+ * quickly use up the bucket and are limited to that fraction of the successes, so a degraded service isn't
+ * buried under retries from every thread at once.
+ */
+class RetryBudget {
+public:
+    // Retries that can go out in a burst, e.g. after a dropped connection
+    static constexpr const int DEFAULT_MAX_TOKENS = 10;
+    // Retries stay under one in ten successful attempts once the burst is spent
+    static constexpr const int DEFAULT_SUCCESSES_PER_TOKEN = 10;
+
+    struct RetryBudgetStats {
+        std::size_t retriesAllowed;
+        std::size_t retriesDenied;
+        double tokens;
+    };
+
+    explicit RetryBudget(int maxTokens = DEFAULT_MAX_TOKENS, int successesPerToken = DEFAULT_SUCCESSES_PER_TOKEN);
+
+    RetryBudget(const RetryBudget &) = delete;
+    RetryBudget &operator=(const RetryBudget &) = delete;
+
+    void RecordSuccess();
+
+    /**
+     * Spends a token for one retry. Returns false, and spends nothing, if the budget is used up.
+     */
+    bool TryAcquireRetry();
+
+    RetryBudgetStats GetStats() const;
+
+private:
+    const double m_maxTokens;
+    const double m_tokensPerSuccess;
+
+    mutable std::mutex m_mutex;
+    double m_tokens;
+    std::size_t m_retriesAllowed;
+    std::size_t m_retriesDenied;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
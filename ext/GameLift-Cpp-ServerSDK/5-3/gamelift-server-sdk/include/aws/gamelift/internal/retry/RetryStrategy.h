@@ -9,17 +9,82 @@
  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
  *
  */
+
 #pragma once
 
+#include <aws/gamelift/internal/retry/CircuitBreaker.h>
+#include <aws/gamelift/internal/retry/RetryBudget.h>
+#include <aws/gamelift/internal/util/TimerScheduler.h>
 #include <functional>
+#include <memory>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 class RetryStrategy {
 public:
-    virtual void apply(const std::function<bool(void)> &callable) = 0;
+    // How an attempt went. Whether it is retried is kept apart from how it is recorded with the breaker and budget,
+    // so an attempt that stops the retries without reaching the service isn't taken for a healthy service.
+    enum class AttemptResult {
+        // The service answered, even if it turned the request down. Recorded as a success, and not retried.
+        ANSWERED,
+        // The service failed or didn't answer in time. Recorded as a failure, and retried while retries are left.
+        FAILED_RETRIABLE,
+        // The service failed in a way another attempt won't fix. Recorded as a failure, and not retried.
+        FAILED,
+        // The attempt never reached the service, e.g. it was shed or the caller's deadline had passed. Recorded
+        // nowhere, and not retried.
+        NOT_SENT
+    };
+
+    // Starts one attempt of an asynchronous operation. The attempt calls attemptComplete exactly once, with its result.
+    typedef std::function<void(const std::function<void(AttemptResult)> &attemptComplete)> AsyncCallable;
+
+    virtual ~RetryStrategy() = default;
+
+    /**
+     * Shares a retry budget across strategies, so retries from every caller draw on the same tokens. A retry the
+     * budget can't pay for isn't made, and the last attempt's result stands.
+     */
+    void SetRetryBudget(const std::shared_ptr<RetryBudget> &retryBudget) { m_retryBudget = retryBudget; }
+
+    /**
+     * Shares a circuit breaker across strategies. Every attempt asks the breaker first; one it refuses isn't made,
+     * and completes as a failure.
+     */
+    void SetCircuitBreaker(const std::shared_ptr<CircuitBreaker> &circuitBreaker) { m_circuitBreaker = circuitBreaker; }
+
+    /**
+     * Calls the callable until it returns true or the retries run out, sleeping on the calling thread in between.
+     * True is recorded as ANSWERED and false as FAILED_RETRIABLE.
+     */
+    virtual void apply(const std::function<bool(void)> &callable);
+
+    /**
+     * Same retries as apply(), but the backoff between attempts is a timer on the scheduler, so no thread waits.
+     * Retries start on the scheduler thread. onComplete receives the result of the last attempt, or NOT_SENT if the
+     * breaker refused it.
+     */
+    static void applyAsync(const std::shared_ptr<RetryStrategy> &retryStrategy, TimerScheduler &timerScheduler, const AsyncCallable &callable,
+                           const std::function<void(AttemptResult)> &onComplete);
+
+protected:
+    /**
+     * Returns the delay before the given retry, counting from 1, or a negative value when no retries are left.
+     */
+    virtual int getRetryDelayMillis(int retry) = 0;
+
+private:
+    // Records an attempt's result with the breaker and budget, and returns the delay before the next one, or a
+    // negative value if there is to be none
+    int onAttemptComplete(AttemptResult result, int retry);
+
+    static void attemptAsync(const std::shared_ptr<RetryStrategy> &retryStrategy, TimerScheduler &timerScheduler, const AsyncCallable &callable,
+                             const std::function<void(AttemptResult)> &onComplete, int retry);
+
+    std::shared_ptr<RetryBudget> m_retryBudget;
+    std::shared_ptr<CircuitBreaker> m_circuitBreaker;
 };
 } // namespace Internal
 } // namespace GameLift
-} // namespace Aws
\ No newline at end of file
+} // namespace Aws
@@ -0,0 +1,114 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Fixed-capacity, lock-free queue with any number of producers and a single consumer.
+ *
+ * Every slot is allocated up front, so pushing and consuming never allocate: a pushed value is moved into its slot,
+ * and the consumer works on it in place. Each slot carries a sequence number that says whose turn it is, so producers
+ * only contend on the tail index, and the consumer never contends with anyone. Neither side ever blocks; a push into
+ * a full queue fails instead.
+ */
+template <typename T> class BoundedMpscQueue {
+public:
+    // The capacity is rounded up to a power of two, so a position maps to its slot with a mask
+    explicit BoundedMpscQueue(std::size_t capacity) : m_mask(RoundUpToPowerOfTwo(capacity) - 1), m_slots(new Slot[m_mask + 1]), m_head(0), m_tail(0) {
+        for (std::size_t i = 0; i <= m_mask; i++) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMpscQueue(const BoundedMpscQueue &) = delete;
+    BoundedMpscQueue &operator=(const BoundedMpscQueue &) = delete;
+
+    /**
+     * Moves the value into the queue. Returns false, leaving the value untouched, if the queue is full. Safe to call
+     * from any thread.
+     */
+    bool TryPush(T &&value) {
+        std::size_t position = m_tail.load(std::memory_order_relaxed);
+        while (true) {
+            Slot &slot = m_slots[position & m_mask];
+            const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t lag = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (lag == 0) {
+                if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.value = std::move(value);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+                // Another producer took this position; position now holds the new tail
+            } else if (lag < 0) {
+                // The slot still holds a value the consumer hasn't taken, a full turn of the queue ago
+                return false;
+            } else {
+                position = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Hands the oldest value to the consumer, in place, then resets its slot. Returns false if the queue is empty.
+     * Only one thread may consume.
+     */
+    template <typename Consumer> bool TryConsume(Consumer &&consumer) {
+        const std::size_t position = m_head.load(std::memory_order_relaxed);
+        Slot &slot = m_slots[position & m_mask];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+        consumer(slot.value);
+        // Don't hold on to whatever the consumer left behind until the slot is reused
+        slot.value = T();
+        m_head.store(position + 1, std::memory_order_relaxed);
+        slot.sequence.store(position + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t GetCapacity() const { return m_mask + 1; }
+
+private:
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    static std::size_t RoundUpToPowerOfTwo(std::size_t value) {
+        std::size_t powerOfTwo = 1;
+        while (powerOfTwo < value) {
+            powerOfTwo <<= 1;
+        }
+        return powerOfTwo;
+    }
+
+    const std::size_t m_mask;
+    std::unique_ptr<Slot[]> m_slots;
+    // Written by the consumer only
+    std::atomic<std::size_t> m_head;
+    // Claimed by producers
+    std::atomic<std::size_t> m_tail;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
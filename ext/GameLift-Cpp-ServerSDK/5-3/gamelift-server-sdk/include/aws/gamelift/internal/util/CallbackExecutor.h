@@ -0,0 +1,138 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#pragma once
+
+#include <aws/gamelift/internal/util/TimerScheduler.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Runs the developer's callbacks (OnStartGameSession, OnUpdateGameSession, OnProcessTerminate) off the socket threads.
+ *
+ * Callbacks start in the order they were submitted, on at most maxConcurrentCallbacks worker threads. With the
+ * default of one worker they also finish in that order, so an UpdateGameSession never overtakes the
+ * CreateGameSession before it. Every callback is timed; one that runs past the slow callback threshold is reported
+ * while it is still running, and again with its total time once it returns.
+ */
+class CallbackExecutor {
+public:
+    static constexpr const int DEFAULT_MAX_CONCURRENT_CALLBACKS = 1;
+    static constexpr const int DEFAULT_SLOW_CALLBACK_MILLIS = 5000;
+
+    struct CallbackStats {
+        std::size_t completedCallbacks;
+        std::size_t slowCallbacks;
+        std::chrono::microseconds totalExecutionTime;
+        std::chrono::microseconds maxExecutionTime;
+    };
+
+    // Slow callbacks are reported from a timer on the given scheduler while they run. Without one, they are only
+    // reported once they return.
+    explicit CallbackExecutor(std::shared_ptr<TimerScheduler> timerScheduler = nullptr);
+    ~CallbackExecutor();
+
+    CallbackExecutor(const CallbackExecutor &) = delete;
+    CallbackExecutor &operator=(const CallbackExecutor &) = delete;
+
+    /**
+     * Starts the worker threads. Only the first call has an effect; callbacks submitted before it are kept and run
+     * once the workers are up.
+     */
+    void Start(int maxConcurrentCallbacks = DEFAULT_MAX_CONCURRENT_CALLBACKS,
+               std::chrono::milliseconds slowCallbackThreshold = std::chrono::milliseconds(DEFAULT_SLOW_CALLBACK_MILLIS));
+
+    /**
+     * Waits for running callbacks to return and discards the ones that haven't started.
+     * Safe to call from a callback, in which case that callback's worker exits once it returns.
+     */
+    void Stop();
+
+    /**
+     * Queues a callback. The name identifies it in slow callback reports.
+     */
+    void Submit(const char *name, std::function<void()> callback);
+
+    /**
+     * Runs the callbacks queued so far on the calling thread, in order, for an executor that was never started.
+     * Returns how many ran. A callback may destroy the executor, in which case the rest stay queued and are discarded.
+     */
+    std::size_t RunQueuedCallbacks();
+
+    CallbackStats GetStats() const;
+    std::size_t GetQueuedCallbackCount() const;
+
+    /**
+     * Wraps a callback and its payload into a task that moves the payload into the callback when it runs, so a
+     * GameSession handed to the executor is never copied.
+     */
+    template <typename Callback, typename Payload> static std::function<void()> MovePayloadInto(Callback callback, Payload &&payload);
+
+private:
+    struct QueuedCallback {
+        const char *name;
+        std::function<void()> callback;
+    };
+
+    // Workers hold on to this rather than the executor, so a worker that outlives Stop() (because it called it)
+    // never touches a destroyed executor.
+    struct SharedState {
+        std::shared_ptr<TimerScheduler> timerScheduler;
+        std::chrono::milliseconds slowCallbackThreshold;
+
+        mutable std::mutex mutex;
+        std::condition_variable callbackQueued;
+        std::deque<QueuedCallback> queue;
+        bool stopping;
+        CallbackStats stats;
+    };
+
+    template <typename Callback, typename Payload> class PayloadTask {
+    public:
+        PayloadTask(Callback callback, Payload &&payload) : m_callback(std::move(callback)), m_payload(std::move(payload)) {}
+        void operator()() { m_callback(std::move(m_payload)); }
+
+    private:
+        Callback m_callback;
+        Payload m_payload;
+    };
+
+    static void RunWorker(const std::shared_ptr<SharedState> &state);
+    static void RunCallback(SharedState &state, QueuedCallback &queuedCallback);
+
+    std::shared_ptr<SharedState> m_state;
+    std::mutex m_workersMutex;
+    std::vector<std::thread> m_workers;
+};
+
+template <typename Callback, typename Payload> std::function<void()> CallbackExecutor::MovePayloadInto(Callback callback, Payload &&payload) {
+    typedef typename std::remove_reference<Payload>::type PayloadType;
+    return PayloadTask<Callback, PayloadType>(std::move(callback), std::move(payload));
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
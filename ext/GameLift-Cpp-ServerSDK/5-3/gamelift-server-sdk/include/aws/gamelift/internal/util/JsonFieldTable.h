@@ -0,0 +1,402 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+constexpr std::size_t JsonKeyLength(const char *key) { return *key == '\0' ? 0 : 1 + JsonKeyLength(key + 1); }
+
+/**
+ * Dispatch hash of a json key, built from its length and its first and last characters. This is cheap
+ * enough to compute for every member of an incoming object and is distinct for the keys of every model
+ * class; a match is still confirmed by comparing the key itself.
+ */
+constexpr std::uint32_t JsonKeyHash(const char *key, std::size_t length) {
+    return length == 0 ? 0
+                       : (static_cast<std::uint32_t>(length) << 16) | (static_cast<std::uint32_t>(static_cast<unsigned char>(key[0])) << 8) |
+                             static_cast<unsigned char>(key[length - 1]);
+}
+
+constexpr std::uint32_t JsonKeyHash(const char *key) { return JsonKeyHash(key, JsonKeyLength(key)); }
+
+/**
+ * Describes how one member of T maps to a json key. Use the factory functions to create one for each
+ * supported member type; each encodes values the way the matching JsonHelper function does.
+ */
+template <typename T> struct JsonField {
+    typedef void (*WriteFunction)(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer);
+    // Called with nullptr when the key is missing, in which case the member is reset to its default
+    typedef void (*ReadFunction)(T &object, const rapidjson::Value *value);
+
+    constexpr JsonField(const char *key, WriteFunction write, ReadFunction read)
+        : key(key), keyLength(JsonKeyLength(key)), keyHash(JsonKeyHash(key)), write(write), read(read) {}
+
+    const char *key;
+    std::size_t keyLength;
+    std::uint32_t keyHash;
+    WriteFunction write;
+    ReadFunction read;
+
+    // Written when non-empty, "" when missing
+    template <std::string T::*Member> static constexpr JsonField String(const char *key) {
+        return JsonField(key, &WriteString<Member>, &ReadString<Member>);
+    }
+
+    // Written when positive, -1 when missing
+    template <int T::*Member> static constexpr JsonField Int(const char *key) { return JsonField(key, &WriteInt<Member>, &ReadInt<Member>); }
+
+    // Written when positive, -1 when missing
+    template <long T::*Member> static constexpr JsonField Long(const char *key) { return JsonField(key, &WriteLong<Member>, &ReadLong<Member>); }
+
+    // Written when positive, -1 when missing
+    template <std::int64_t T::*Member> static constexpr JsonField Int64(const char *key) {
+        return JsonField(key, &WriteInt64<Member>, &ReadInt64<Member>);
+    }
+
+    // Always written, false when missing
+    template <bool T::*Member> static constexpr JsonField Bool(const char *key) { return JsonField(key, &WriteBool<Member>, &ReadBool<Member>); }
+
+    // Always written as a json object, empty when missing. Non-string values are skipped.
+    template <std::map<std::string, std::string> T::*Member> static constexpr JsonField StringMap(const char *key) {
+        return JsonField(key, &WriteStringMap<Member>, &ReadStringMap<Member>);
+    }
+
+    // Always written as a json object, empty when missing. Non-int values are skipped.
+    template <std::map<std::string, int> T::*Member> static constexpr JsonField IntMap(const char *key) {
+        return JsonField(key, &WriteIntMap<Member>, &ReadIntMap<Member>);
+    }
+
+    // Written when there are log paths
+    template <Aws::GameLift::Server::LogParameters T::*Member> static constexpr JsonField LogPaths(const char *key) {
+        return JsonField(key, &WriteLogParameters<Member>, &ReadLogParameters<Member>);
+    }
+
+    // A nested object serialized by M's own Serialize and Deserialize. Default constructed when missing.
+    template <typename M, M T::*Member> static constexpr JsonField Object(const char *key) {
+        return JsonField(key, &WriteObject<M, Member>, &ReadObject<M, Member>);
+    }
+
+    // Always written as a json array of objects, empty when missing. Null entries are skipped.
+    template <typename M, std::vector<M> T::*Member> static constexpr JsonField ObjectList(const char *key) {
+        return JsonField(key, &WriteObjectList<M, Member>, &ReadObjectList<M, Member>);
+    }
+
+    // Always written as a json object of objects, empty when missing. Null entries are skipped.
+    template <typename M, std::map<std::string, M> T::*Member> static constexpr JsonField ObjectMap(const char *key) {
+        return JsonField(key, &WriteObjectMap<M, Member>, &ReadObjectMap<M, Member>);
+    }
+
+private:
+    template <std::string T::*Member> static void WriteString(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        JsonHelper::WriteNonEmptyString(writer, key, object.*Member);
+    }
+
+    template <std::string T::*Member> static void ReadString(T &object, const rapidjson::Value *value) {
+        if (value != nullptr && value->IsString()) {
+            (object.*Member).assign(value->GetString(), value->GetStringLength());
+        } else {
+            (object.*Member).clear();
+        }
+    }
+
+    template <int T::*Member> static void WriteInt(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        JsonHelper::WritePositiveInt(writer, key, object.*Member);
+    }
+
+    template <int T::*Member> static void ReadInt(T &object, const rapidjson::Value *value) {
+        object.*Member = value != nullptr && value->IsInt() ? value->GetInt() : -1;
+    }
+
+    template <long T::*Member> static void WriteLong(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        JsonHelper::WritePositiveLong(writer, key, object.*Member);
+    }
+
+    template <long T::*Member> static void ReadLong(T &object, const rapidjson::Value *value) {
+        object.*Member = value != nullptr && value->IsInt64() ? static_cast<long>(value->GetInt64()) : -1;
+    }
+
+    template <std::int64_t T::*Member> static void WriteInt64(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        if (object.*Member > 0) {
+            writer->String(key);
+            writer->Int64(object.*Member);
+        }
+    }
+
+    template <std::int64_t T::*Member> static void ReadInt64(T &object, const rapidjson::Value *value) {
+        object.*Member = value != nullptr && value->IsInt64() ? value->GetInt64() : -1;
+    }
+
+    template <bool T::*Member> static void WriteBool(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        writer->String(key);
+        writer->Bool(object.*Member);
+    }
+
+    template <bool T::*Member> static void ReadBool(T &object, const rapidjson::Value *value) {
+        object.*Member = value != nullptr && value->IsBool() ? value->GetBool() : false;
+    }
+
+    template <std::map<std::string, std::string> T::*Member>
+    static void WriteStringMap(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        writer->String(key);
+        writer->StartObject();
+        for (auto const &entry : object.*Member) {
+            writer->String(entry.first.c_str());
+            writer->String(entry.second.c_str());
+        }
+        writer->EndObject();
+    }
+
+    template <std::map<std::string, std::string> T::*Member> static void ReadStringMap(T &object, const rapidjson::Value *value) {
+        (object.*Member).clear();
+        if (value != nullptr && value->IsObject()) {
+            for (auto itr = value->MemberBegin(); itr != value->MemberEnd(); ++itr) {
+                if (itr->value.IsString()) {
+                    (object.*Member)[itr->name.GetString()] = itr->value.GetString();
+                }
+            }
+        }
+    }
+
+    template <std::map<std::string, int> T::*Member>
+    static void WriteIntMap(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        writer->String(key);
+        writer->StartObject();
+        for (auto const &entry : object.*Member) {
+            writer->String(entry.first.c_str());
+            writer->Int(entry.second);
+        }
+        writer->EndObject();
+    }
+
+    template <std::map<std::string, int> T::*Member> static void ReadIntMap(T &object, const rapidjson::Value *value) {
+        (object.*Member).clear();
+        if (value != nullptr && value->IsObject()) {
+            for (auto itr = value->MemberBegin(); itr != value->MemberEnd(); ++itr) {
+                if (itr->value.IsInt()) {
+                    (object.*Member)[itr->name.GetString()] = itr->value.GetInt();
+                }
+            }
+        }
+    }
+
+    template <Aws::GameLift::Server::LogParameters T::*Member>
+    static void WriteLogParameters(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        JsonHelper::WriteLogParameters(writer, key, object.*Member);
+    }
+
+    template <Aws::GameLift::Server::LogParameters T::*Member> static void ReadLogParameters(T &object, const rapidjson::Value *value) {
+        object.*Member = value != nullptr ? JsonHelper::SafelyDeserializeLogParameters(*value) : Aws::GameLift::Server::LogParameters();
+    }
+
+    template <typename M, M T::*Member> static void WriteObject(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        writer->String(key);
+        writer->StartObject();
+        (object.*Member).Serialize(writer);
+        writer->EndObject();
+    }
+
+    template <typename M, M T::*Member> static void ReadObject(T &object, const rapidjson::Value *value) {
+        if (value != nullptr && value->IsObject()) {
+            (object.*Member).Deserialize(*value);
+        } else {
+            object.*Member = M();
+        }
+    }
+
+    template <typename M, std::vector<M> T::*Member>
+    static void WriteObjectList(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        writer->String(key);
+        writer->StartArray();
+        for (const M &element : object.*Member) {
+            writer->StartObject();
+            element.Serialize(writer);
+            writer->EndObject();
+        }
+        writer->EndArray();
+    }
+
+    template <typename M, std::vector<M> T::*Member> static void ReadObjectList(T &object, const rapidjson::Value *value) {
+        std::vector<M> &list = object.*Member;
+        list.clear();
+        if (value != nullptr && value->IsArray()) {
+            list.reserve(value->Size());
+            for (auto itr = value->Begin(); itr != value->End(); ++itr) {
+                if (!itr->IsNull()) {
+                    list.emplace_back();
+                    list.back().Deserialize(*itr);
+                }
+            }
+        }
+    }
+
+    template <typename M, std::map<std::string, M> T::*Member>
+    static void WriteObjectMap(const T &object, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        writer->String(key);
+        writer->StartObject();
+        for (auto const &entry : object.*Member) {
+            writer->String(entry.first.c_str());
+            writer->StartObject();
+            entry.second.Serialize(writer);
+            writer->EndObject();
+        }
+        writer->EndObject();
+    }
+
+    template <typename M, std::map<std::string, M> T::*Member> static void ReadObjectMap(T &object, const rapidjson::Value *value) {
+        (object.*Member).clear();
+        if (value != nullptr && value->IsObject()) {
+            for (auto itr = value->MemberBegin(); itr != value->MemberEnd(); ++itr) {
+                if (!itr->value.IsNull()) {
+                    (object.*Member)[itr->name.GetString()].Deserialize(itr->value);
+                }
+            }
+        }
+    }
+};
+
+/**
+ * The json fields of a class, optionally chained to the table of its base class. Serialize writes the
+ * base class's fields first and then this class's, in table order. Deserialize resets every field and
+ * then makes a single pass over the object's members. A member whose key length no field has is
+ * skipped at once; any other is looked up by ReadMember, which scans the fields, so the cost is
+ * O(members x fields) in the worst case. The tables are small (a dozen fields at most, counting the
+ * base class's), and a non-matching field costs one integer compare of its key hash, so the scan
+ * stays within a few cache lines. An indexed slot table would also need a hash checked to be
+ * collision-free for every class.
+ *
+ * Classes build their table once, in a function-local static:
+ *
+ *     const JsonFieldTable<Foo> &Foo::GetJsonFields() {
+ *         static const JsonField<Foo> fields[] = {JsonField<Foo>::String<&Foo::m_bar>(BAR)};
+ *         static const JsonFieldTable<Foo> table(fields, Message::GetJsonFields());
+ *         return table;
+ *     }
+ */
+template <typename T> class JsonFieldTable {
+public:
+    template <std::size_t N>
+    explicit JsonFieldTable(const JsonField<T> (&fields)[N])
+        : m_fields(fields), m_fieldCount(N), m_keyLengthMask(KeyLengthMask(fields, N)), m_base(nullptr), m_serializeBase(nullptr),
+          m_readBaseMember(nullptr), m_resetBase(nullptr) {}
+
+    template <typename Base, std::size_t N>
+    JsonFieldTable(const JsonField<T> (&fields)[N], const JsonFieldTable<Base> &base)
+        : m_fields(fields), m_fieldCount(N), m_keyLengthMask(KeyLengthMask(fields, N) | base.m_keyLengthMask), m_base(&base),
+          m_serializeBase(&SerializeBase<Base>), m_readBaseMember(&ReadBaseMember<Base>), m_resetBase(&ResetBase<Base>) {}
+
+    JsonFieldTable(const JsonFieldTable &) = delete;
+    JsonFieldTable &operator=(const JsonFieldTable &) = delete;
+
+    bool Serialize(const T &object, rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
+        if (m_base != nullptr) {
+            m_serializeBase(m_base, object, writer);
+        }
+        for (std::size_t i = 0; i < m_fieldCount; i++) {
+            m_fields[i].write(object, m_fields[i].key, writer);
+        }
+        return true;
+    }
+
+    bool Deserialize(T &object, const rapidjson::Value &value) const {
+        Reset(object);
+        if (!value.IsObject()) {
+            return true;
+        }
+        for (auto itr = value.MemberBegin(); itr != value.MemberEnd(); ++itr) {
+            const char *name = itr->name.GetString();
+            const std::size_t length = itr->name.GetStringLength();
+            // Most members that no field wants are rejected here without hashing or walking the tables
+            if ((m_keyLengthMask & KeyLengthBit(length)) == 0) {
+                continue;
+            }
+            ReadMember(object, name, length, JsonKeyHash(name, length), itr->value);
+        }
+        return true;
+    }
+
+    /**
+     * Resets every field, including the base class's, to its missing-key default.
+     */
+    void Reset(T &object) const {
+        if (m_base != nullptr) {
+            m_resetBase(m_base, object);
+        }
+        for (std::size_t i = 0; i < m_fieldCount; i++) {
+            m_fields[i].read(object, nullptr);
+        }
+    }
+
+    /**
+     * Reads a single member into the field with the given key. Returns false if neither this class nor
+     * its base class has a field for it. Linear in the number of fields: the key hash only makes each
+     * comparison cheap, it does not index the table.
+     */
+    bool ReadMember(T &object, const char *name, std::size_t length, std::uint32_t hash, const rapidjson::Value &value) const {
+        for (std::size_t i = 0; i < m_fieldCount; i++) {
+            const JsonField<T> &field = m_fields[i];
+            if (field.keyHash == hash && field.keyLength == length && memcmp(field.key, name, length) == 0) {
+                field.read(object, &value);
+                return true;
+            }
+        }
+        return m_base != nullptr && m_readBaseMember(m_base, object, name, length, hash, value);
+    }
+
+private:
+    template <typename> friend class JsonFieldTable;
+
+    static std::uint64_t KeyLengthBit(std::size_t length) { return std::uint64_t(1) << (length % 64); }
+
+    static std::uint64_t KeyLengthMask(const JsonField<T> *fields, std::size_t fieldCount) {
+        std::uint64_t mask = 0;
+        for (std::size_t i = 0; i < fieldCount; i++) {
+            mask |= KeyLengthBit(fields[i].keyLength);
+        }
+        return mask;
+    }
+
+    // The base class's table is stored untyped; these restore its type and upcast the object
+    template <typename Base> static void SerializeBase(const void *base, const T &object, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+        static_cast<const JsonFieldTable<Base> *>(base)->Serialize(object, writer);
+    }
+
+    template <typename Base>
+    static bool ReadBaseMember(const void *base, T &object, const char *name, std::size_t length, std::uint32_t hash, const rapidjson::Value &value) {
+        return static_cast<const JsonFieldTable<Base> *>(base)->ReadMember(object, name, length, hash, value);
+    }
+
+    template <typename Base> static void ResetBase(const void *base, T &object) { static_cast<const JsonFieldTable<Base> *>(base)->Reset(object); }
+
+    const JsonField<T> *m_fields;
+    std::size_t m_fieldCount;
+    // One bit per key length, modulo 64, of this table's and its base's keys
+    std::uint64_t m_keyLengthMask;
+    const void *m_base;
+    void (*m_serializeBase)(const void *base, const T &object, rapidjson::Writer<rapidjson::StringBuffer> *writer);
+    bool (*m_readBaseMember)(const void *base, T &object, const char *name, std::size_t length, std::uint32_t hash, const rapidjson::Value &value);
+    void (*m_resetBase)(const void *base, T &object);
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -35,8 +35,26 @@ public:
     static long SafelyDeserializeLong(const rapidjson::Value &value, const char *key);
     static void WritePositiveLong(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, long value);
 
+    /**
+     * Returns this thread's reusable serialization buffer, emptied. Its contents are only valid until
+     * the next call on the same thread.
+     */
+    static rapidjson::StringBuffer &GetThreadLocalBuffer();
+
+    /**
+     * Parses a copy of the json string in place, using this thread's scratch arena. Returns the root
+     * object, or nullptr if the string isn't a JSON object. The result is only valid until the next
+     * call on the same thread.
+     */
+    static const rapidjson::Value *ParseThreadLocal(const std::string &jsonString);
+
     static Aws::GameLift::Server::LogParameters SafelyDeserializeLogParameters(const rapidjson::Value &value, const char *key);
+    static Aws::GameLift::Server::LogParameters SafelyDeserializeLogParameters(const rapidjson::Value &value);
     static void WriteLogParameters(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, const Aws::GameLift::Server::LogParameters &value);
+
+private:
+    // Buffers grown past this size by an unusually large message are released rather than kept
+    static constexpr const size_t MAX_RETAINED_BUFFER_SIZE = 64 * 1024;
 };
 
 } // namespace Internal
@@ -0,0 +1,132 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+/**
+ * Runs delayed tasks for the SDK: heartbeats, retry backoffs, reconnect attempts and request deadlines.
+ *
+ * Timers live in a hashed wheel of fixed-width ticks, so scheduling and cancelling cost the same however many
+ * timers are pending. Due tasks run one at a time on a single scheduler thread, in deadline order, and must not
+ * block; anything that has to wait should schedule another timer instead. The scheduler thread sleeps until the
+ * earliest deadline rather than waking every tick. Each slot tracks its own earliest deadline, so finding the next
+ * one looks at the slots rather than at every pending timer.
+ */
+class TimerScheduler {
+public:
+    typedef std::uint64_t TimerId;
+
+    static constexpr const TimerId INVALID_TIMER_ID = 0;
+    static constexpr const int DEFAULT_TICK_MILLIS = 10;
+    static constexpr const std::size_t DEFAULT_WHEEL_SIZE = 512;
+
+    explicit TimerScheduler(std::chrono::milliseconds tick = std::chrono::milliseconds(DEFAULT_TICK_MILLIS), std::size_t wheelSize = DEFAULT_WHEEL_SIZE);
+    ~TimerScheduler();
+
+    TimerScheduler(const TimerScheduler &) = delete;
+    TimerScheduler &operator=(const TimerScheduler &) = delete;
+
+    /**
+     * Starts the scheduler thread. Timers scheduled before Start() are kept and run once it is up.
+     */
+    void Start();
+
+    /**
+     * Stops the scheduler thread and discards every pending timer without running it.
+     * Safe to call from a task, and to destroy the scheduler from one: the scheduler thread exits once that task
+     * returns, and never touches the scheduler itself again.
+     */
+    void Stop();
+
+    /**
+     * Runs the task once the delay has elapsed, rounded up to the next tick. Returns an id for Cancel().
+     */
+    TimerId Schedule(std::chrono::milliseconds delay, std::function<void()> task);
+
+    /**
+     * Cancels a pending timer. Returns false if the timer already ran, is running, or was never scheduled.
+     */
+    bool Cancel(TimerId timerId);
+
+    /**
+     * Runs every timer due at or before the given time on the calling thread, and returns how many ran.
+     * Lets a host without a scheduler thread drive the timers itself.
+     */
+    std::size_t RunDueTimers(std::chrono::steady_clock::time_point now);
+
+    std::size_t GetPendingTimerCount() const;
+
+private:
+    // The low bits of a TimerId hold the wheel slot so Cancel() only has to look at one slot.
+    static constexpr const int SLOT_BITS = 16;
+    static constexpr const std::uint64_t NO_DEADLINE = UINT64_MAX;
+
+    struct Timer {
+        TimerId id;
+        std::uint64_t deadlineTick;
+        std::function<void()> task;
+    };
+
+    // The scheduler thread holds on to this rather than the scheduler, so a thread that outlives Stop() (because a
+    // task called it) never touches a destroyed scheduler.
+    struct SharedState {
+        SharedState(std::chrono::milliseconds tick, std::size_t wheelSize);
+
+        const std::chrono::milliseconds tick;
+        const std::chrono::steady_clock::time_point epoch;
+
+        mutable std::mutex mutex;
+        std::condition_variable wakeUp;
+        std::vector<std::vector<Timer>> wheel;
+        // The earliest deadline among each slot's timers, NO_DEADLINE for an empty slot
+        std::vector<std::uint64_t> slotDeadlineTicks;
+        bool stopping;
+        // Bumped by every Start(), so a thread left over from before a Stop() exits instead of running timers
+        std::uint64_t generation;
+        // Every timer with a deadline at or before this tick has been collected.
+        std::uint64_t lastCollectedTick;
+        std::uint64_t nextDeadlineTick;
+        std::uint64_t nextSequence;
+        std::size_t pendingTimerCount;
+    };
+
+    static void Run(const std::shared_ptr<SharedState> &state, std::uint64_t generation);
+    static std::uint64_t ToTick(const SharedState &state, std::chrono::steady_clock::time_point time);
+    // Moves every timer due by the given tick into dueTimers, in the order they should run. Requires the state's mutex.
+    static void CollectDueTimers(SharedState &state, std::uint64_t nowTick, std::vector<Timer> &dueTimers);
+    // Recomputes a slot's earliest deadline after timers were removed from it. Requires the state's mutex.
+    static void UpdateSlotDeadlineTick(SharedState &state, std::size_t slot);
+    // Finds the earliest pending deadline after nowTick, one slot per tick. Requires the state's mutex.
+    static void UpdateNextDeadlineTick(SharedState &state, std::uint64_t nowTick);
+
+    std::shared_ptr<SharedState> m_state;
+    // Guarded by the state's mutex
+    std::thread m_thread;
+};
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -18,9 +18,11 @@
 #include <aws/gamelift/server/ProcessParameters.h>
 #include <aws/gamelift/server/model/DescribePlayerSessionsRequest.h>
 #include <aws/gamelift/server/model/GetFleetRoleCredentialsRequest.h>
+#include <aws/gamelift/server/model/ServerEvent.h>
 #include <aws/gamelift/server/model/ServerParameters.h>
 #include <aws/gamelift/server/model/StartMatchBackfillRequest.h>
 #include <aws/gamelift/server/model/StopMatchBackfillRequest.h>
+#include <functional>
 #include <future>
 
 /* The GameLiftServerAPI contains methods that should be used by the server executable you upload to
@@ -37,6 +39,15 @@ typedef Aws::GameLift::Outcome<Aws::GameLift::Internal::GameLiftServerState *, G
 typedef Aws::GameLift::Outcome<std::vector<std::string>, GameLiftError> GetExpectedPlayerSessionIDsOutcome;
 typedef Aws::GameLift::Outcome<std::vector<std::string>, GameLiftError> GetConnectedPlayerSessionIDsOutcome;
 
+// Handlers for the asynchronous service calls
+typedef std::function<void(const GenericOutcome &)> GenericOutcomeHandler;
+typedef std::function<void(const StartMatchBackfillOutcome &)> StartMatchBackfillOutcomeHandler;
+typedef std::function<void(const DescribePlayerSessionsOutcome &)> DescribePlayerSessionsOutcomeHandler;
+typedef std::function<void(const GetComputeCertificateOutcome &)> GetComputeCertificateOutcomeHandler;
+typedef std::function<void(const GetFleetRoleCredentialsOutcome &)> GetFleetRoleCredentialsOutcomeHandler;
+// Handler for events drained with PollEvents
+typedef std::function<void(Aws::GameLift::Server::Model::ServerEvent &)> ServerEventHandler;
+
 /**
 @return The current SDK version.
 */
@@ -53,6 +64,8 @@ AWS_GAMELIFT_API InitSDKOutcome InitSDK();
 /**
 Initializes the GameLift server.
 Should be called when the server starts with the given server parameters, before any GameLift-dependent initialization happens.
+With ServerParameters::SetAsyncStartup(true), returns without waiting for the connection to GameLift, which is made
+in the background while the game loads.
 @return Pointer to the internal server state indicating that the server process is ready to call ProcessReady().
 */
 AWS_GAMELIFT_API InitSDKOutcome InitSDK(const Aws::GameLift::Server::Model::ServerParameters &serverParameters);
@@ -64,6 +77,8 @@ Game-property-dependent initialization (such as loading a user-requested map) sh
 that time. The onHealthCheck callback is invoked asynchronously. There is no mechanism to to destroy
 the resulting thread. If it does not complete in a given time period the server status will be
 reported as unhealthy.
+If InitSDK's connection is still being made in the background, returns at once and the process is activated the
+moment the connection opens.
 @param processParameters The parameters required to successfully run the process.
 */
 AWS_GAMELIFT_API GenericOutcome ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters);
@@ -141,7 +156,70 @@ AWS_GAMELIFT_API GenericOutcome RemovePlayerSession(const std::string &playerSes
 AWS_GAMELIFT_API DescribePlayerSessionsOutcome
 DescribePlayerSessions(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest);
 
+/**
+Asynchronous variants of the service calls above. Each returns immediately and invokes the handler
+exactly once with the outcome the blocking call would have returned. The handler runs on the SDK's
+handler thread, one handler at a time (in Poll when poll driven), or on the calling thread if the request
+fails before it is sent. It must not block: it may make further SDK calls, but every handler after it waits
+until it returns, so it must never wait on another handler. It should synchronize any access to game
+state. Handlers still outstanding when the SDK is destroyed are not called.
+@param timeoutMillis The most time the call may take, retries included. If it passes first, the handler gets a
+WEBSOCKET_SEND_MESSAGE_TIMEOUT error. 0 leaves each request to its own timeout, which is short for player
+session calls and longer for rarer ones such as GetComputeCertificate.
+*/
+AWS_GAMELIFT_API void ProcessEndingAsync(const GenericOutcomeHandler &handler, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void ActivateGameSessionAsync(const GenericOutcomeHandler &handler, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest,
+                                              const StartMatchBackfillOutcomeHandler &handler, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void StopMatchBackfillAsync(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &request, const GenericOutcomeHandler &handler,
+                                             int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void UpdatePlayerSessionCreationPolicyAsync(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy,
+                                                             const GenericOutcomeHandler &handler, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void AcceptPlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeHandler &handler, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void RemovePlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeHandler &handler, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                                                  const DescribePlayerSessionsOutcomeHandler &handler, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void GetComputeCertificateAsync(const GetComputeCertificateOutcomeHandler &handler, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                                   const GetFleetRoleCredentialsOutcomeHandler &handler, int timeoutMillis = 0);
+
+/**
+Hands the events queued since the last call to the handler, oldest first, on the calling thread. Call it from the
+game loop when ProcessReady was called with ProcessParameters::setPollEvents(true); the session and termination
+callbacks are not called in that mode. Polling never waits on an SDK thread and doesn't allocate.
+@param maxEvents The most events to hand over in this call, or -1 for all of them.
+@return How many events were handed to the handler, or PROCESS_NOT_READY if events aren't being polled.
+*/
+AWS_GAMELIFT_API AwsLongOutcome PollEvents(const ServerEventHandler &handler, int maxEvents = -1);
+
+/**
+Runs the SDK's pending work on the calling thread: network IO, retry and heartbeat timers, and the session and
+termination callbacks. Call it from the game loop, every frame, when InitSDK was called with
+ServerParameters::SetPollDriven(true); the SDK has no threads of its own in that mode, so nothing happens between
+calls. Does nothing otherwise.
+@param budgetMicros The most time to spend on network IO in this call, in microseconds.
+@return How many pieces of work ran.
+*/
+AWS_GAMELIFT_API AwsLongOutcome Poll(int budgetMicros = 1000);
+
 #else
+// Handlers for the asynchronous service calls. The state pointer passed with the handler is handed back unchanged.
+typedef void (*GenericOutcomeHandler)(const GenericOutcome &outcome, void *state);
+typedef void (*StartMatchBackfillOutcomeHandler)(const StartMatchBackfillOutcome &outcome, void *state);
+typedef void (*DescribePlayerSessionsOutcomeHandler)(const DescribePlayerSessionsOutcome &outcome, void *state);
+typedef void (*GetComputeCertificateOutcomeHandler)(const GetComputeCertificateOutcome &outcome, void *state);
+typedef void (*GetFleetRoleCredentialsOutcomeHandler)(const GetFleetRoleCredentialsOutcome &outcome, void *state);
+typedef void (*ServerEventHandler)(Aws::GameLift::Server::Model::ServerEvent &event, void *state);
+
 /**
 @return The current SDK version.
 */
@@ -158,6 +236,8 @@ AWS_GAMELIFT_API GenericOutcome InitSDK();
 /**
 Initializes the GameLift server.
 Should be called when the server starts with the given server parameters, before any GameLift-dependent initialization happens.
+With ServerParameters::SetAsyncStartup(true), returns without waiting for the connection to GameLift, which is made
+in the background while the game loads.
 @return Pointer to the internal server state indicating that the server process is ready to call ProcessReady().
 */
 AWS_GAMELIFT_API GenericOutcome InitSDK(const Aws::GameLift::Server::Model::ServerParameters &serverParameters);
@@ -169,6 +249,8 @@ Game-property-dependent initialization (such as loading a user-requested map) sh
 that time. The onHealthCheck callback is invoked asynchronously. There is no mechanism to to destroy
 the resulting thread. If it does not complete in a given time period the server status will be
 reported as unhealthy.
+If InitSDK's connection is still being made in the background, returns at once and the process is activated the
+moment the connection opens.
 @param processParameters The parameters required to successfully run the process.
 */
 AWS_GAMELIFT_API GenericOutcome ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters);
@@ -265,6 +347,61 @@ AWS_GAMELIFT_API GenericOutcome RemovePlayerSession(const char *playerSessionId)
 AWS_GAMELIFT_API DescribePlayerSessionsOutcome
 DescribePlayerSessions(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest);
 
+/**
+Asynchronous variants of the service calls above. Each returns immediately and invokes the handler
+exactly once with the outcome the blocking call would have returned. The handler runs on the SDK's
+handler thread, one handler at a time (in Poll when poll driven), or on the calling thread if the request
+fails before it is sent. It must not block: it may make further SDK calls, but every handler after it waits
+until it returns, so it must never wait on another handler. It should synchronize any access to game
+state. Handlers still outstanding when the SDK is destroyed are not called.
+@param timeoutMillis The most time the call may take, retries included. If it passes first, the handler gets a
+WEBSOCKET_SEND_MESSAGE_TIMEOUT error. 0 leaves each request to its own timeout, which is short for player
+session calls and longer for rarer ones such as GetComputeCertificate.
+*/
+AWS_GAMELIFT_API void ProcessEndingAsync(GenericOutcomeHandler handler, void *state, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void ActivateGameSessionAsync(GenericOutcomeHandler handler, void *state, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest,
+                                              StartMatchBackfillOutcomeHandler handler, void *state, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void StopMatchBackfillAsync(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &request, GenericOutcomeHandler handler, void *state,
+                                             int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void UpdatePlayerSessionCreationPolicyAsync(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy,
+                                                             GenericOutcomeHandler handler, void *state, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void AcceptPlayerSessionAsync(const char *playerSessionId, GenericOutcomeHandler handler, void *state, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void RemovePlayerSessionAsync(const char *playerSessionId, GenericOutcomeHandler handler, void *state, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                                                  DescribePlayerSessionsOutcomeHandler handler, void *state, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void GetComputeCertificateAsync(GetComputeCertificateOutcomeHandler handler, void *state, int timeoutMillis = 0);
+
+AWS_GAMELIFT_API void GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                                   GetFleetRoleCredentialsOutcomeHandler handler, void *state, int timeoutMillis = 0);
+
+/**
+Hands the events queued since the last call to the handler, oldest first, on the calling thread. Call it from the
+game loop when ProcessReady was called with ProcessParameters::setPollEvents(true); the session and termination
+callbacks are not called in that mode. Polling never waits on an SDK thread and doesn't allocate.
+@param maxEvents The most events to hand over in this call, or -1 for all of them.
+@return How many events were handed to the handler, or PROCESS_NOT_READY if events aren't being polled.
+*/
+AWS_GAMELIFT_API AwsLongOutcome PollEvents(ServerEventHandler handler, void *state, int maxEvents);
+
+/**
+Runs the SDK's pending work on the calling thread: network IO, retry and heartbeat timers, and the session and
+termination callbacks. Call it from the game loop, every frame, when InitSDK was called with
+ServerParameters::SetPollDriven(true); the SDK has no threads of its own in that mode, so nothing happens between
+calls. Does nothing otherwise.
+@param budgetMicros The most time to spend on network IO in this call, in microseconds.
+@return How many pieces of work ran.
+*/
+AWS_GAMELIFT_API AwsLongOutcome Poll(int budgetMicros);
+
 #endif
 
 /**
@@ -284,6 +421,13 @@ AWS_GAMELIFT_API GetComputeCertificateOutcome GetComputeCertificate();
  */
 AWS_GAMELIFT_API GetFleetRoleCredentialsOutcome GetFleetRoleCredentials(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request);
 
+/**
+Reports how long each step of startup took: connecting to GameLift (name resolution and TCP), the TLS handshake, the
+WebSocket upgrade, and GameLift answering ProcessReady. Steps that haven't finished yet are -1.
+@return The startup timings, or the error the connection failed with if InitSDK's background connection failed.
+*/
+AWS_GAMELIFT_API StartupTimingsOutcome GetStartupTimings();
+
 } // namespace Server
 } // namespace GameLift
 } // namespace Aws
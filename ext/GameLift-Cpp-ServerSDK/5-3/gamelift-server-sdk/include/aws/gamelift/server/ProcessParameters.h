@@ -28,23 +28,34 @@ typedef bool (*HealthCheckFn)(void *);
 #endif
 
 class ProcessParameters {
+public:
+    static constexpr const int DEFAULT_MAX_CONCURRENT_CALLBACKS = 1;
+    static constexpr const int DEFAULT_SLOW_CALLBACK_THRESHOLD_MILLIS = 5000;
+    static constexpr const int DEFAULT_EVENT_QUEUE_CAPACITY = 64;
+
 #ifdef GAMELIFT_USE_STD
 public:
     ProcessParameters()
         : m_onStartGameSession(nullptr), m_onUpdateGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr), m_port(-1),
-          m_logParameters(LogParameters()) {}
+          m_logParameters(LogParameters()),
+          m_maxConcurrentCallbacks(DEFAULT_MAX_CONCURRENT_CALLBACKS), m_slowCallbackThresholdMillis(DEFAULT_SLOW_CALLBACK_THRESHOLD_MILLIS),
+          m_pollEvents(false), m_eventQueueCapacity(DEFAULT_EVENT_QUEUE_CAPACITY) {}
 
     ProcessParameters(const std::function<void(Aws::GameLift::Server::Model::GameSession)> onStartGameSession, const std::function<void()> onProcessTerminate,
                       const std::function<bool()> onHealthCheck, int port, const Aws::GameLift::Server::LogParameters logParameters)
         : m_onStartGameSession(onStartGameSession), m_onUpdateGameSession([](const Aws::GameLift::Server::Model::UpdateGameSession &) {}),
-          m_onProcessTerminate(onProcessTerminate), m_onHealthCheck(onHealthCheck), m_port(port), m_logParameters(logParameters) {}
+          m_onProcessTerminate(onProcessTerminate), m_onHealthCheck(onHealthCheck), m_port(port), m_logParameters(logParameters),
+          m_maxConcurrentCallbacks(DEFAULT_MAX_CONCURRENT_CALLBACKS), m_slowCallbackThresholdMillis(DEFAULT_SLOW_CALLBACK_THRESHOLD_MILLIS),
+          m_pollEvents(false), m_eventQueueCapacity(DEFAULT_EVENT_QUEUE_CAPACITY) {}
 
     ProcessParameters(const std::function<void(Aws::GameLift::Server::Model::GameSession)> onStartGameSession,
                       const std::function<void(Aws::GameLift::Server::Model::UpdateGameSession)> onUpdateGameSession,
                       const std::function<void()> onProcessTerminate, const std::function<bool()> onHealthCheck, int port,
                       const Aws::GameLift::Server::LogParameters logParameters)
         : m_onStartGameSession(onStartGameSession), m_onUpdateGameSession(onUpdateGameSession), m_onProcessTerminate(onProcessTerminate),
-          m_onHealthCheck(onHealthCheck), m_port(port), m_logParameters(logParameters) {}
+          m_onHealthCheck(onHealthCheck), m_port(port), m_logParameters(logParameters),
+          m_maxConcurrentCallbacks(DEFAULT_MAX_CONCURRENT_CALLBACKS), m_slowCallbackThresholdMillis(DEFAULT_SLOW_CALLBACK_THRESHOLD_MILLIS),
+          m_pollEvents(false), m_eventQueueCapacity(DEFAULT_EVENT_QUEUE_CAPACITY) {}
 
     AWS_GAMELIFT_API std::function<void(Aws::GameLift::Server::Model::GameSession)> getOnStartGameSession() const { return m_onStartGameSession; }
     AWS_GAMELIFT_API std::function<void(Aws::GameLift::Server::Model::UpdateGameSession)> getOnUpdateGameSession() const { return m_onUpdateGameSession; }
@@ -53,6 +64,30 @@ public:
     AWS_GAMELIFT_API int getPort() const { return m_port; }
     AWS_GAMELIFT_API Aws::GameLift::Server::LogParameters getLogParameters() const { return m_logParameters; }
 
+    /**
+     * Callbacks run in arrival order on at most this many SDK threads. With more than one, a callback may start
+     * before the previous one has returned. The health check callback runs on an SDK thread of its own, so a long
+     * session callback doesn't delay it.
+     */
+    AWS_GAMELIFT_API void setMaxConcurrentCallbacks(int maxConcurrentCallbacks) { m_maxConcurrentCallbacks = maxConcurrentCallbacks; }
+    AWS_GAMELIFT_API int getMaxConcurrentCallbacks() const { return m_maxConcurrentCallbacks; }
+    /**
+     * A callback that runs longer than this is reported on stdout, while it is still running and again once it returns.
+     */
+    AWS_GAMELIFT_API void setSlowCallbackThresholdMillis(int slowCallbackThresholdMillis) { m_slowCallbackThresholdMillis = slowCallbackThresholdMillis; }
+    AWS_GAMELIFT_API int getSlowCallbackThresholdMillis() const { return m_slowCallbackThresholdMillis; }
+    /**
+     * When set, the session and termination callbacks are not called. Their events are queued instead, for the game to
+     * drain with Server::PollEvents() from its own loop. The health check callback is still called by the SDK.
+     */
+    AWS_GAMELIFT_API void setPollEvents(bool pollEvents) { m_pollEvents = pollEvents; }
+    AWS_GAMELIFT_API bool getPollEvents() const { return m_pollEvents; }
+    /**
+     * How many polled events can wait for PollEvents() at once. An event that arrives while the queue is full is dropped.
+     */
+    AWS_GAMELIFT_API void setEventQueueCapacity(int eventQueueCapacity) { m_eventQueueCapacity = eventQueueCapacity; }
+    AWS_GAMELIFT_API int getEventQueueCapacity() const { return m_eventQueueCapacity; }
+
 private:
     std::function<void(Aws::GameLift::Server::Model::GameSession)> m_onStartGameSession;
     std::function<void(Aws::GameLift::Server::Model::UpdateGameSession)> m_onUpdateGameSession;
@@ -60,11 +95,17 @@ private:
     std::function<bool()> m_onHealthCheck;
     int m_port;
     Aws::GameLift::Server::LogParameters m_logParameters;
+    int m_maxConcurrentCallbacks;
+    int m_slowCallbackThresholdMillis;
+    bool m_pollEvents;
+    int m_eventQueueCapacity;
 #else
 public:
     ProcessParameters()
         : m_onStartGameSession(nullptr), m_onUpdateGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr),
-          m_startGameSessionState(nullptr), m_processTerminateState(nullptr), m_healthCheckState(nullptr), m_port(-1), m_logParameters(LogParameters()) {}
+          m_startGameSessionState(nullptr), m_processTerminateState(nullptr), m_healthCheckState(nullptr), m_port(-1), m_logParameters(LogParameters()),
+          m_maxConcurrentCallbacks(DEFAULT_MAX_CONCURRENT_CALLBACKS), m_slowCallbackThresholdMillis(DEFAULT_SLOW_CALLBACK_THRESHOLD_MILLIS),
+          m_pollEvents(false), m_eventQueueCapacity(DEFAULT_EVENT_QUEUE_CAPACITY) {}
 
     ProcessParameters(StartGameSessionFn onStartGameSession, void *startGameSessionState, UpdateGameSessionFn onUpdateGameSession, void *updateGameSessionState,
                       ProcessTerminateFn onProcessTerminate, void *processTerminateState, HealthCheckFn onHealthCheck, void *healthCheckState, int port,
@@ -73,7 +114,9 @@ public:
 
           m_onStartGameSession(onStartGameSession), m_onUpdateGameSession(onUpdateGameSession), m_onProcessTerminate(onProcessTerminate),
           m_onHealthCheck(onHealthCheck), m_startGameSessionState(startGameSessionState), m_updateGameSessionState(updateGameSessionState),
-          m_processTerminateState(processTerminateState), m_healthCheckState(healthCheckState), m_port(port), m_logParameters(logParameters) {}
+          m_processTerminateState(processTerminateState), m_healthCheckState(healthCheckState), m_port(port), m_logParameters(logParameters),
+          m_maxConcurrentCallbacks(DEFAULT_MAX_CONCURRENT_CALLBACKS), m_slowCallbackThresholdMillis(DEFAULT_SLOW_CALLBACK_THRESHOLD_MILLIS),
+          m_pollEvents(false), m_eventQueueCapacity(DEFAULT_EVENT_QUEUE_CAPACITY) {}
 
     ProcessParameters(StartGameSessionFn onStartGameSession, void *startGameSessionState, ProcessTerminateFn onProcessTerminate, void *processTerminateState,
                       HealthCheckFn onHealthCheck, void *healthCheckState, int port, const Aws::GameLift::Server::LogParameters logParameters)
@@ -82,7 +125,9 @@ public:
           m_onStartGameSession(onStartGameSession), m_onUpdateGameSession([](Aws::GameLift::Server::Model::UpdateGameSession, void *) {}),
           m_onProcessTerminate(onProcessTerminate), m_onHealthCheck(onHealthCheck), m_startGameSessionState(startGameSessionState),
           m_updateGameSessionState(nullptr), m_processTerminateState(processTerminateState), m_healthCheckState(healthCheckState), m_port(port),
-          m_logParameters(logParameters) {}
+          m_logParameters(logParameters),
+          m_maxConcurrentCallbacks(DEFAULT_MAX_CONCURRENT_CALLBACKS), m_slowCallbackThresholdMillis(DEFAULT_SLOW_CALLBACK_THRESHOLD_MILLIS),
+          m_pollEvents(false), m_eventQueueCapacity(DEFAULT_EVENT_QUEUE_CAPACITY) {}
 
     AWS_GAMELIFT_API StartGameSessionFn getOnStartGameSession() const { return m_onStartGameSession; }
     AWS_GAMELIFT_API void *getStartGameSessionState() const { return m_startGameSessionState; }
@@ -95,6 +140,30 @@ public:
     AWS_GAMELIFT_API int getPort() const { return m_port; }
     AWS_GAMELIFT_API Aws::GameLift::Server::LogParameters getLogParameters() const { return m_logParameters; }
 
+    /**
+     * Callbacks run in arrival order on at most this many SDK threads. With more than one, a callback may start
+     * before the previous one has returned. The health check callback runs on an SDK thread of its own, so a long
+     * session callback doesn't delay it.
+     */
+    AWS_GAMELIFT_API void setMaxConcurrentCallbacks(int maxConcurrentCallbacks) { m_maxConcurrentCallbacks = maxConcurrentCallbacks; }
+    AWS_GAMELIFT_API int getMaxConcurrentCallbacks() const { return m_maxConcurrentCallbacks; }
+    /**
+     * A callback that runs longer than this is reported on stdout, while it is still running and again once it returns.
+     */
+    AWS_GAMELIFT_API void setSlowCallbackThresholdMillis(int slowCallbackThresholdMillis) { m_slowCallbackThresholdMillis = slowCallbackThresholdMillis; }
+    AWS_GAMELIFT_API int getSlowCallbackThresholdMillis() const { return m_slowCallbackThresholdMillis; }
+    /**
+     * When set, the session and termination callbacks are not called. Their events are queued instead, for the game to
+     * drain with Server::PollEvents() from its own loop. The health check callback is still called by the SDK.
+     */
+    AWS_GAMELIFT_API void setPollEvents(bool pollEvents) { m_pollEvents = pollEvents; }
+    AWS_GAMELIFT_API bool getPollEvents() const { return m_pollEvents; }
+    /**
+     * How many polled events can wait for PollEvents() at once. An event that arrives while the queue is full is dropped.
+     */
+    AWS_GAMELIFT_API void setEventQueueCapacity(int eventQueueCapacity) { m_eventQueueCapacity = eventQueueCapacity; }
+    AWS_GAMELIFT_API int getEventQueueCapacity() const { return m_eventQueueCapacity; }
+
 private:
     StartGameSessionFn m_onStartGameSession;
     UpdateGameSessionFn m_onUpdateGameSession;
@@ -106,6 +175,10 @@ private:
     void *m_healthCheckState;
     int m_port;
     Aws::GameLift::Server::LogParameters m_logParameters;
+    int m_maxConcurrentCallbacks;
+    int m_slowCallbackThresholdMillis;
+    bool m_pollEvents;
+    int m_eventQueueCapacity;
 #endif
 };
 } // namespace Server
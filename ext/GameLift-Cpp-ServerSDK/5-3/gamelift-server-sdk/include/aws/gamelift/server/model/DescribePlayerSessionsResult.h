@@ -91,7 +91,7 @@ public:
      * <p>Collection of objects containing properties for each player session that
      * matches the request.</p>
      */
-    inline void SetPlayerSessions(std::vector<PlayerSession> &&value) { m_playerSessions = value; }
+    inline void SetPlayerSessions(std::vector<PlayerSession> &&value) { m_playerSessions = std::move(value); }
 
     /**
      * <p>Collection of objects containing properties for each player session that
@@ -107,7 +107,7 @@ public:
      * matches the request.</p>
      */
     inline DescribePlayerSessionsResult &WithPlayerSessions(std::vector<PlayerSession> &&value) {
-        SetPlayerSessions(value);
+        SetPlayerSessions(std::move(value));
         return *this;
     }
 
@@ -125,7 +125,7 @@ public:
      * matches the request.</p>
      */
     inline DescribePlayerSessionsResult &AddPlayerSession(PlayerSession &&value) {
-        m_playerSessions.push_back(value);
+        m_playerSessions.push_back(std::move(value));
         return *this;
     }
 
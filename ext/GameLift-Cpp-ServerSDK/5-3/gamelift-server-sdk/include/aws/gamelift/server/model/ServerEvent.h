@@ -0,0 +1,88 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/common/GameLift_EXPORTS.h>
+
+#include <aws/gamelift/server/model/GameSession.h>
+#include <aws/gamelift/server/model/UpdateGameSession.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Server {
+namespace Model {
+enum class ServerEventType { NONE, START_GAME_SESSION, UPDATE_GAME_SESSION, PROCESS_TERMINATE };
+
+/**
+ * <p>An event from GameLift, delivered through PollEvents() when ProcessParameters::setPollEvents(true) was set.
+ * Each event carries the data the matching callback would have received: a GameSession for START_GAME_SESSION, an
+ * UpdateGameSession for UPDATE_GAME_SESSION, and the termination time for PROCESS_TERMINATE.</p>
+ * <p>The event handed to the PollEvents handler is only valid during the call. Its payload may be moved out.</p>
+ */
+class AWS_GAMELIFT_API ServerEvent {
+public:
+    ServerEvent() : m_type(ServerEventType::NONE), m_terminationTime(-1) {}
+
+    static ServerEvent ForStartGameSession(GameSession &&gameSession) {
+        ServerEvent event;
+        event.m_type = ServerEventType::START_GAME_SESSION;
+        event.m_gameSession = std::move(gameSession);
+        return event;
+    }
+
+    static ServerEvent ForUpdateGameSession(UpdateGameSession &&updateGameSession) {
+        ServerEvent event;
+        event.m_type = ServerEventType::UPDATE_GAME_SESSION;
+        event.m_updateGameSession = std::move(updateGameSession);
+        return event;
+    }
+
+    static ServerEvent ForProcessTerminate(long terminationTime) {
+        ServerEvent event;
+        event.m_type = ServerEventType::PROCESS_TERMINATE;
+        event.m_terminationTime = terminationTime;
+        return event;
+    }
+
+    /**
+     * <p>Which of the payloads below is set.</p>
+     */
+    inline ServerEventType GetType() const { return m_type; }
+
+    /**
+     * <p>The game session to start, for START_GAME_SESSION.</p>
+     */
+    inline GameSession &GetGameSession() { return m_gameSession; }
+    inline const GameSession &GetGameSession() const { return m_gameSession; }
+
+    /**
+     * <p>The update, for UPDATE_GAME_SESSION.</p>
+     */
+    inline UpdateGameSession &GetUpdateGameSession() { return m_updateGameSession; }
+    inline const UpdateGameSession &GetUpdateGameSession() const { return m_updateGameSession; }
+
+    /**
+     * <p>When GameLift will terminate the process in epoch seconds, for PROCESS_TERMINATE.</p>
+     */
+    inline long GetTerminationTime() const { return m_terminationTime; }
+
+private:
+    ServerEventType m_type;
+    GameSession m_gameSession;
+    UpdateGameSession m_updateGameSession;
+    long m_terminationTime;
+};
+
+} // namespace Model
+} // namespace Server
+} // namespace GameLift
+} // namespace Aws
@@ -134,12 +134,74 @@ public:
         return *this;
     }
 
+    /**
+     * <p>Whether the SDK runs without threads of its own. When set, nothing happens in the background: the host
+     * calls Server::Poll() from its loop, every frame, to run the SDK's network IO, timers, heartbeats and
+     * callbacks on its own thread. Calls that wait for a response drive the same work while they wait.</p>
+     */
+    inline bool GetPollDriven() const { return m_pollDriven; }
+
+    inline void SetPollDriven(bool pollDriven) { m_pollDriven = pollDriven; }
+
+    inline ServerParameters &WithPollDriven(bool pollDriven) {
+        SetPollDriven(pollDriven);
+        return *this;
+    }
+
+    /**
+     * <p>Whether the SDK keeps its per-process overhead to a minimum, for fleets that pack many server processes
+     * onto an instance. When set, the SDK runs its network IO on a single thread. Connection refreshes share that
+     * thread with the connection they replace, so they may take slightly longer.</p>
+     */
+    inline bool GetLowFootprint() const { return m_lowFootprint; }
+
+    inline void SetLowFootprint(bool lowFootprint) { m_lowFootprint = lowFootprint; }
+
+    inline ServerParameters &WithLowFootprint(bool lowFootprint) {
+        SetLowFootprint(lowFootprint);
+        return *this;
+    }
+
+    /**
+     * <p>Whether the SDK keeps a second, standby connection to GameLift open next to the one it sends on. When the
+     * active connection drops, traffic fails over to the standby at once instead of waiting for a new connection
+     * to be set up, and a new standby is opened in the background. Costs one extra idle connection.</p>
+     */
+    inline bool GetWarmStandby() const { return m_warmStandby; }
+
+    inline void SetWarmStandby(bool warmStandby) { m_warmStandby = warmStandby; }
+
+    inline ServerParameters &WithWarmStandby(bool warmStandby) {
+        SetWarmStandby(warmStandby);
+        return *this;
+    }
+
+    /**
+     * <p>Whether InitSDK returns at once instead of waiting for the connection to GameLift. The connection is made
+     * in the background while the game loads, and a ProcessReady called before it opens is sent the moment it
+     * does. Other service calls made before then wait for it too. If the connection can't be made, calls fail
+     * with GAMELIFT_SERVER_NOT_INITIALIZED and GetStartupTimings reports why. When poll driven, the connection
+     * only makes progress in Poll.</p>
+     */
+    inline bool GetAsyncStartup() const { return m_asyncStartup; }
+
+    inline void SetAsyncStartup(bool asyncStartup) { m_asyncStartup = asyncStartup; }
+
+    inline ServerParameters &WithAsyncStartup(bool asyncStartup) {
+        SetAsyncStartup(asyncStartup);
+        return *this;
+    }
+
 private:
     std::string m_webSocketUrl;
     std::string m_fleetId;
     std::string m_processId;
     std::string m_hostId;
     std::string m_authToken;
+    bool m_pollDriven = false;
+    bool m_lowFootprint = false;
+    bool m_warmStandby = false;
+    bool m_asyncStartup = false;
 #else
 public:
     ServerParameters() {
@@ -228,12 +290,74 @@ public:
         return *this;
     }
 
+    /**
+     * <p>Whether the SDK runs without threads of its own. When set, nothing happens in the background: the host
+     * calls Server::Poll() from its loop, every frame, to run the SDK's network IO, timers, heartbeats and
+     * callbacks on its own thread. Calls that wait for a response drive the same work while they wait.</p>
+     */
+    inline bool GetPollDriven() const { return m_pollDriven; }
+
+    inline void SetPollDriven(bool pollDriven) { m_pollDriven = pollDriven; }
+
+    inline ServerParameters &WithPollDriven(bool pollDriven) {
+        SetPollDriven(pollDriven);
+        return *this;
+    }
+
+    /**
+     * <p>Whether the SDK keeps its per-process overhead to a minimum, for fleets that pack many server processes
+     * onto an instance. When set, the SDK runs its network IO on a single thread. Connection refreshes share that
+     * thread with the connection they replace, so they may take slightly longer.</p>
+     */
+    inline bool GetLowFootprint() const { return m_lowFootprint; }
+
+    inline void SetLowFootprint(bool lowFootprint) { m_lowFootprint = lowFootprint; }
+
+    inline ServerParameters &WithLowFootprint(bool lowFootprint) {
+        SetLowFootprint(lowFootprint);
+        return *this;
+    }
+
+    /**
+     * <p>Whether the SDK keeps a second, standby connection to GameLift open next to the one it sends on. When the
+     * active connection drops, traffic fails over to the standby at once instead of waiting for a new connection
+     * to be set up, and a new standby is opened in the background. Costs one extra idle connection.</p>
+     */
+    inline bool GetWarmStandby() const { return m_warmStandby; }
+
+    inline void SetWarmStandby(bool warmStandby) { m_warmStandby = warmStandby; }
+
+    inline ServerParameters &WithWarmStandby(bool warmStandby) {
+        SetWarmStandby(warmStandby);
+        return *this;
+    }
+
+    /**
+     * <p>Whether InitSDK returns at once instead of waiting for the connection to GameLift. The connection is made
+     * in the background while the game loads, and a ProcessReady called before it opens is sent the moment it
+     * does. Other service calls made before then wait for it too. If the connection can't be made, calls fail
+     * with GAMELIFT_SERVER_NOT_INITIALIZED and GetStartupTimings reports why. When poll driven, the connection
+     * only makes progress in Poll.</p>
+     */
+    inline bool GetAsyncStartup() const { return m_asyncStartup; }
+
+    inline void SetAsyncStartup(bool asyncStartup) { m_asyncStartup = asyncStartup; }
+
+    inline ServerParameters &WithAsyncStartup(bool asyncStartup) {
+        SetAsyncStartup(asyncStartup);
+        return *this;
+    }
+
 private:
     char m_webSocketUrl[MAX_WEBSOCKET_URL_LENGTH];
     char m_fleetId[MAX_FLEET_ID_LENGTH];
     char m_processId[MAX_PROCESS_ID_LENGTH];
     char m_hostId[MAX_HOST_ID_LENGTH];
     char m_authToken[MAX_AUTH_TOKEN_LENGTH];
+    bool m_pollDriven = false;
+    bool m_lowFootprint = false;
+    bool m_warmStandby = false;
+    bool m_asyncStartup = false;
 #endif
 };
 
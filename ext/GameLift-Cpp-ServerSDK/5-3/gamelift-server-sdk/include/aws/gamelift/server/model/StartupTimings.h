@@ -0,0 +1,101 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#pragma once
+
+#include <aws/gamelift/common/GameLift_EXPORTS.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Server {
+namespace Model {
+/**
+ * <p>How long each step of getting the server process onto GameLift took, in milliseconds. A step that hasn't
+ * finished yet is -1.</p>
+ */
+class AWS_GAMELIFT_API StartupTimings {
+public:
+    StartupTimings() : m_connectMillis(-1), m_tlsMillis(-1), m_upgradeMillis(-1), m_activateMillis(-1), m_totalMillis(-1) {}
+
+    /**
+     * <p>Resolving the GameLift endpoint and opening the TCP connection, for the attempt that connected.</p>
+     */
+    inline long GetConnectMillis() const { return m_connectMillis; }
+
+    inline void SetConnectMillis(long connectMillis) { m_connectMillis = connectMillis; }
+
+    inline StartupTimings &WithConnectMillis(long connectMillis) {
+        SetConnectMillis(connectMillis);
+        return *this;
+    }
+
+    /**
+     * <p>The TLS handshake, for the attempt that connected.</p>
+     */
+    inline long GetTlsMillis() const { return m_tlsMillis; }
+
+    inline void SetTlsMillis(long tlsMillis) { m_tlsMillis = tlsMillis; }
+
+    inline StartupTimings &WithTlsMillis(long tlsMillis) {
+        SetTlsMillis(tlsMillis);
+        return *this;
+    }
+
+    /**
+     * <p>The WebSocket upgrade request and its response, for the attempt that connected.</p>
+     */
+    inline long GetUpgradeMillis() const { return m_upgradeMillis; }
+
+    inline void SetUpgradeMillis(long upgradeMillis) { m_upgradeMillis = upgradeMillis; }
+
+    inline StartupTimings &WithUpgradeMillis(long upgradeMillis) {
+        SetUpgradeMillis(upgradeMillis);
+        return *this;
+    }
+
+    /**
+     * <p>GameLift answering ProcessReady, timed from when the request could first be sent: when ProcessReady was
+     * called, or when the connection opened if that came later.</p>
+     */
+    inline long GetActivateMillis() const { return m_activateMillis; }
+
+    inline void SetActivateMillis(long activateMillis) { m_activateMillis = activateMillis; }
+
+    inline StartupTimings &WithActivateMillis(long activateMillis) {
+        SetActivateMillis(activateMillis);
+        return *this;
+    }
+
+    /**
+     * <p>From InitSDK until GameLift answered ProcessReady, including failed connect attempts and whatever the game
+     * did in between.</p>
+     */
+    inline long GetTotalMillis() const { return m_totalMillis; }
+
+    inline void SetTotalMillis(long totalMillis) { m_totalMillis = totalMillis; }
+
+    inline StartupTimings &WithTotalMillis(long totalMillis) {
+        SetTotalMillis(totalMillis);
+        return *this;
+    }
+
+private:
+    long m_connectMillis;
+    long m_tlsMillis;
+    long m_upgradeMillis;
+    long m_activateMillis;
+    long m_totalMillis;
+};
+
+} // namespace Model
+} // namespace Server
+} // namespace GameLift
+} // namespace Aws
@@ -40,6 +40,8 @@ namespace Model {
 class AWS_GAMELIFT_API UpdateGameSession {
 #ifdef GAMELIFT_USE_STD
 public:
+    UpdateGameSession() : m_updateReason(UpdateReason::UNKNOWN) {}
+
     UpdateGameSession(const GameSession &gameSession, UpdateReason updateReason, std::string backfillTicketId)
         : m_backfillTicketId(backfillTicketId), m_gameSession(gameSession), m_updateReason(updateReason) {}
 
@@ -91,6 +93,8 @@ private:
     std::string m_backfillTicketId;
 #else
 public:
+    UpdateGameSession() : m_updateReason(UpdateReason::UNKNOWN) { m_backfillTicketId[0] = '\0'; }
+
     UpdateGameSession(const GameSession &gameSession, UpdateReason updateReason, const char *backfillTicketId)
         : m_gameSession(gameSession), m_updateReason(updateReason) {
         strncpy(m_backfillTicketId, backfillTicketId, MAX_BACKFILL_TICKET_ID_LENGTH - 1);
@@ -38,6 +38,8 @@
 
 #include <aws/gamelift/internal/network/WebSocketppClientWrapper.h>
 #include <aws/gamelift/server/ProcessParameters.h>
+#include <algorithm>
+#include <cstdio>
 #include <cstdlib>
 #include <ctime>
 
@@ -46,7 +48,8 @@ using namespace Aws::GameLift;
 #ifdef GAMELIFT_USE_STD
 Internal::GameLiftServerState::GameLiftServerState()
     : m_onStartGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr), m_processReady(false), m_terminationTime(-1),
-      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckThread(nullptr), m_healthCheckInterrupted(false),
+      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckTimer(TimerScheduler::INVALID_TIMER_ID), m_pollEvents(false),
+      m_pollDriven(false),
       m_createGameSessionCallback(new CreateGameSessionCallback(this)), m_describePlayerSessionsCallback(new DescribePlayerSessionsCallback()),
       m_getComputeCertificateCallback(new GetComputeCertificateCallback()), m_getFleetRoleCredentialsCallback(new GetFleetRoleCredentialsCallback()),
       m_terminateProcessCallback(new TerminateProcessCallback(this)), m_updateGameSessionCallback(new UpdateGameSessionCallback(this)),
@@ -54,16 +57,19 @@ Internal::GameLiftServerState::GameLiftServerState()
 
 Internal::GameLiftServerState::~GameLiftServerState() {
     m_processReady = false;
-    if (m_healthCheckThread && m_healthCheckThread->joinable()) {
-        {
-            std::unique_lock<std::mutex> lock(m_healthCheckMutex);
-            m_healthCheckInterrupted = true;
-            // "Interrupts" the thread's sleep and causes it to evaluate its "wait_for" predicate.
-            // Since "m_healthCheckInterrupted = true" now the predicate will evaluate to "true" and
-            // the thread will continue without waiting the full ~60 second interval.
-            m_healthCheckConditionVariable.notify_all();
-        }
-        m_healthCheckThread->join();
+    // Stop the callbacks and timers first: they all refer to the objects torn down below.
+    // Stop() waits for a callback or timer that is already running, and drops the rest.
+    if (m_callbackExecutor) {
+        m_callbackExecutor->Stop();
+    }
+    if (m_handlerExecutor) {
+        m_handlerExecutor->Stop();
+    }
+    if (m_healthCheckExecutor) {
+        m_healthCheckExecutor->Stop();
+    }
+    if (m_timerScheduler) {
+        m_timerScheduler->Stop();
     }
 
     Internal::GameLiftCommonState::SetInstance(nullptr);
@@ -84,47 +90,61 @@ Internal::GameLiftServerState::~GameLiftServerState() {
 }
 
 GenericOutcome Internal::GameLiftServerState::ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters) {
+    // Set up the queue before any event can be delivered to it
+    StartEventQueue(processParameters);
     m_processReady = true;
 
     m_onStartGameSession = processParameters.getOnStartGameSession();
     m_onUpdateGameSession = processParameters.getOnUpdateGameSession();
     m_onProcessTerminate = processParameters.getOnProcessTerminate();
     m_onHealthCheck = processParameters.getOnHealthCheck();
+    StartCallbackExecutor(processParameters);
 
     if (AssertNetworkInitialized()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
-    Internal::ActivateServerProcessRequest activateServerProcessRequest(Server::GetSdkVersion().GetResult(), Internal::GameLiftServerState::LANGUAGE,
-                                                                        processParameters.getPort(), processParameters.getLogParameters());
-    Internal::Message &request = activateServerProcessRequest;
-
-    GenericOutcome result = m_webSocketClientManager->SendSocketMessage(request);
-
-    m_healthCheckThread = std::unique_ptr<std::thread>(new std::thread([this] { HealthCheck(); }));
-
-    return result;
+    return ActivateServerProcess(processParameters);
 }
 
 void Internal::GameLiftServerState::ReportHealth() {
-    std::future<bool> future(std::async([]() { return true; }));
-    if (m_onHealthCheck) {
-        future = std::async(std::launch::async, m_onHealthCheck);
+    if (!m_onHealthCheck) {
+        SendHeartbeat(true);
+        return;
     }
-
+    // The callback runs on an executor of its own, off the scheduler thread and apart from the session callbacks, so
+    // neither a slow callback nor a long OnStartGameSession holds up the other. Whichever comes first is reported:
+    // the callback's answer, or unhealthy once HEALTHCHECK_TIMEOUT_MILLIS passes without one.
+    if (m_healthCheckInFlight.exchange(true)) {
+        // The last check's callback still hasn't returned, so don't queue another behind it
+        SendHeartbeat(false);
+        return;
+    }
+    std::shared_ptr<std::atomic<bool>> reported = std::make_shared<std::atomic<bool>>(false);
     // Static variable not guaranteed to be defined (location in memory) at this point unless C++
     // 17+. Creating temp int to pass by reference.
-    std::chrono::system_clock::time_point timeoutSeconds = std::chrono::system_clock::now() + std::chrono::milliseconds(int(HEALTHCHECK_TIMEOUT_MILLIS));
-    bool health = false;
-
-    // wait_until blocks until timeoutSeconds has been reached or the result becomes available
-    if (std::future_status::ready == future.wait_until(timeoutSeconds)) {
-        health = future.get();
-    }
+    const TimerScheduler::TimerId timeoutTimer =
+        m_timerScheduler->Schedule(std::chrono::milliseconds(int(HEALTHCHECK_TIMEOUT_MILLIS)), [this, reported] {
+            if (!reported->exchange(true)) {
+                printf("Health check callback did not return within %d ms, reporting unhealthy.\n", int(HEALTHCHECK_TIMEOUT_MILLIS));
+                SendHeartbeat(false);
+            }
+        });
+    m_healthCheckExecutor->Submit("OnHealthCheck", [this, reported, timeoutTimer] {
+        const bool health = m_onHealthCheck();
+        m_healthCheckInFlight = false;
+        m_timerScheduler->Cancel(timeoutTimer);
+        if (!reported->exchange(true)) {
+            SendHeartbeat(health);
+        }
+    });
+}
 
-    Internal::HeartbeatServerProcessRequest request = Internal::HeartbeatServerProcessRequest().WithHealthy(health);
-    if (m_webSocketClientManager || m_webSocketClientWrapper) {
-        m_webSocketClientManager->SendSocketMessage(request);
+void Internal::GameLiftServerState::SendHeartbeat(bool healthy) {
+    Internal::HeartbeatServerProcessRequest request = Internal::HeartbeatServerProcessRequest().WithHealthy(healthy);
+    if (m_webSocketClientManager) {
+        // Nothing waits on the heartbeat's response, so don't hold the calling thread for it
+        m_webSocketClientManager->SendSocketMessageAsync(request, [](const GenericOutcome &) {});
     }
 }
 
@@ -239,9 +259,10 @@ void Internal::GameLiftServerState::OnStartGameSession(Aws::GameLift::Server::Mo
     m_gameSessionId = gameSessionId;
 
     // Invoking OnStartGameSession callback if specified by the developer.
-    if (m_onStartGameSession) {
-        std::thread activateGameSession(std::bind(m_onStartGameSession, gameSession));
-        activateGameSession.detach();
+    if (m_pollEvents) {
+        QueueEvent(ServerEvent::ForStartGameSession(std::move(gameSession)));
+    } else if (m_onStartGameSession) {
+        m_callbackExecutor->Submit("OnStartGameSession", CallbackExecutor::MovePayloadInto(m_onStartGameSession, std::move(gameSession)));
     }
 }
 
@@ -254,9 +275,10 @@ void Internal::GameLiftServerState::OnTerminateProcess(long terminationTime) {
     m_terminationTime = terminationTime;
 
     // Invoking OnProcessTerminate callback if specified by the developer.
-    if (m_onProcessTerminate) {
-        std::thread terminateProcess(std::bind(m_onProcessTerminate));
-        terminateProcess.detach();
+    if (m_pollEvents) {
+        QueueEvent(ServerEvent::ForProcessTerminate(terminationTime));
+    } else if (m_onProcessTerminate) {
+        m_callbackExecutor->Submit("OnProcessTerminate", m_onProcessTerminate);
     }
 }
 
@@ -266,9 +288,10 @@ void Internal::GameLiftServerState::OnUpdateGameSession(Aws::GameLift::Server::M
     }
 
     // Invoking OnUpdateGameSession callback if specified by the developer.
-    if (m_onUpdateGameSession) {
-        std::thread updateGameSessionThread(std::bind(m_onUpdateGameSession, updateGameSession));
-        updateGameSessionThread.detach();
+    if (m_pollEvents) {
+        QueueEvent(ServerEvent::ForUpdateGameSession(std::move(updateGameSession)));
+    } else if (m_onUpdateGameSession) {
+        m_callbackExecutor->Submit("OnUpdateGameSession", CallbackExecutor::MovePayloadInto(m_onUpdateGameSession, std::move(updateGameSession)));
     }
 }
 
@@ -277,16 +300,24 @@ void Internal::GameLiftServerState::OnRefreshConnection(const std::string &refre
         return;
     }
 
-    m_webSocketClientManager->Connect(refreshConnectionEndpoint, authToken, m_processId, m_hostId, m_fleetId);
+    // This arrives on a socket thread, which the old connection still needs while the new one opens
+    m_webSocketClientManager->ConnectAsync(refreshConnectionEndpoint, authToken, m_processId, m_hostId, m_fleetId, [](const GenericOutcome &outcome) {
+        if (!outcome.IsSuccess()) {
+            printf("Refreshing the connection to GameLift websocket server failed.\n");
+        }
+    });
 }
 
-bool Internal::GameLiftServerState::AssertNetworkInitialized() { return !m_webSocketClientManager || !m_webSocketClientManager->IsConnected(); }
+bool Internal::GameLiftServerState::AssertNetworkInitialized() {
+    return !m_webSocketClientManager || (!m_webSocketClientManager->IsConnected() && !m_connecting);
+}
 
 #else
 
 Internal::GameLiftServerState::GameLiftServerState()
     : m_onStartGameSession(nullptr), m_onProcessTerminate(nullptr), m_onHealthCheck(nullptr), m_processReady(false), m_terminationTime(-1),
-      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckThread(nullptr), m_healthCheckInterrupted(false),
+      m_webSocketClientManager(nullptr), m_webSocketClientWrapper(nullptr), m_healthCheckTimer(TimerScheduler::INVALID_TIMER_ID), m_pollEvents(false),
+      m_pollDriven(false),
       m_createGameSessionCallback(new CreateGameSessionCallback(this)), m_describePlayerSessionsCallback(new DescribePlayerSessionsCallback()),
       m_getComputeCertificateCallback(new GetComputeCertificateCallback()), m_getFleetRoleCredentialsCallback(new GetFleetRoleCredentialsCallback()),
       m_terminateProcessCallback(new TerminateProcessCallback(this)), m_updateGameSessionCallback(new UpdateGameSessionCallback(this)),
@@ -294,16 +325,19 @@ Internal::GameLiftServerState::GameLiftServerState()
 
 Internal::GameLiftServerState::~GameLiftServerState() {
     m_processReady = false;
-    if (m_healthCheckThread && m_healthCheckThread->joinable()) {
-        {
-            std::unique_lock<std::mutex> lock(m_healthCheckMutex);
-            m_healthCheckInterrupted = true;
-            // "Interrupts" the thread's sleep and causes it to evaluate its "wait_for" predicate.
-            // Since "m_healthCheckInterrupted = true" now the predicate will evaluate to "true" and
-            // the thread will continue without waiting the full ~60 second interval.
-            m_healthCheckConditionVariable.notify_all();
-        }
-        m_healthCheckThread->join();
+    // Stop the callbacks and timers first: they all refer to the objects torn down below.
+    // Stop() waits for a callback or timer that is already running, and drops the rest.
+    if (m_callbackExecutor) {
+        m_callbackExecutor->Stop();
+    }
+    if (m_handlerExecutor) {
+        m_handlerExecutor->Stop();
+    }
+    if (m_healthCheckExecutor) {
+        m_healthCheckExecutor->Stop();
+    }
+    if (m_timerScheduler) {
+        m_timerScheduler->Stop();
     }
 
     Internal::GameLiftCommonState::SetInstance(nullptr);
@@ -327,6 +361,8 @@ Internal::GameLiftServerState::~GameLiftServerState() {
 }
 
 GenericOutcome Internal::GameLiftServerState::ProcessReady(const Aws::GameLift::Server::ProcessParameters &processParameters) {
+    // Set up the queue before any event can be delivered to it
+    StartEventQueue(processParameters);
     m_processReady = true;
 
     m_onStartGameSession = processParameters.getOnStartGameSession();
@@ -337,38 +373,53 @@ GenericOutcome Internal::GameLiftServerState::ProcessReady(const Aws::GameLift::
     m_processTerminateState = processParameters.getProcessTerminateState();
     m_onHealthCheck = processParameters.getOnHealthCheck();
     m_healthCheckState = processParameters.getHealthCheckState();
+    StartCallbackExecutor(processParameters);
 
     if (AssertNetworkInitialized()) {
         return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
-    Internal::ActivateServerProcessRequest activateServerProcessRequest(Server::GetSdkVersion().GetResult(), Internal::GameLiftServerState::LANGUAGE,
-                                                                        processParameters.getPort(), processParameters.getLogParameters());
-    Internal::Message &request = activateServerProcessRequest;
-
-    GenericOutcome result = m_webSocketClientManager->SendSocketMessage(request);
-    m_healthCheckThread = std::unique_ptr<std::thread>(new std::thread([this] { HealthCheck(); }));
-
-    return result;
+    return ActivateServerProcess(processParameters);
 }
 
 void Internal::GameLiftServerState::ReportHealth() {
-    std::future<bool> future(std::async([]() { return true; }));
-    if (m_onHealthCheck) {
-        future = std::async(std::launch::async, m_onHealthCheck, m_healthCheckState);
+    if (!m_onHealthCheck) {
+        SendHeartbeat(true);
+        return;
     }
-
-    std::chrono::system_clock::time_point timeoutSeconds = std::chrono::system_clock::now() + std::chrono::milliseconds(HEALTHCHECK_TIMEOUT_MILLIS);
-    bool health = false;
-
-    // wait_until blocks until timeoutSeconds has been reached or the result becomes available
-    if (std::future_status::ready == future.wait_until(timeoutSeconds)) {
-        health = future.get();
+    // The callback runs on an executor of its own, off the scheduler thread and apart from the session callbacks, so
+    // neither a slow callback nor a long OnStartGameSession holds up the other. Whichever comes first is reported:
+    // the callback's answer, or unhealthy once HEALTHCHECK_TIMEOUT_MILLIS passes without one.
+    if (m_healthCheckInFlight.exchange(true)) {
+        // The last check's callback still hasn't returned, so don't queue another behind it
+        SendHeartbeat(false);
+        return;
     }
+    std::shared_ptr<std::atomic<bool>> reported = std::make_shared<std::atomic<bool>>(false);
+    // Static variable not guaranteed to be defined (location in memory) at this point unless C++
+    // 17+. Creating temp int to pass by reference.
+    const TimerScheduler::TimerId timeoutTimer =
+        m_timerScheduler->Schedule(std::chrono::milliseconds(int(HEALTHCHECK_TIMEOUT_MILLIS)), [this, reported] {
+            if (!reported->exchange(true)) {
+                printf("Health check callback did not return within %d ms, reporting unhealthy.\n", int(HEALTHCHECK_TIMEOUT_MILLIS));
+                SendHeartbeat(false);
+            }
+        });
+    m_healthCheckExecutor->Submit("OnHealthCheck", [this, reported, timeoutTimer] {
+        const bool health = m_onHealthCheck(m_healthCheckState);
+        m_healthCheckInFlight = false;
+        m_timerScheduler->Cancel(timeoutTimer);
+        if (!reported->exchange(true)) {
+            SendHeartbeat(health);
+        }
+    });
+}
 
-    Internal::HeartbeatServerProcessRequest msg = Internal::HeartbeatServerProcessRequest().WithHealthy(health);
-    if (m_webSocketClientManager || m_webSocketClientWrapper) {
-        m_webSocketClientManager->SendSocketMessage(msg);
+void Internal::GameLiftServerState::SendHeartbeat(bool healthy) {
+    Internal::HeartbeatServerProcessRequest request = Internal::HeartbeatServerProcessRequest().WithHealthy(healthy);
+    if (m_webSocketClientManager) {
+        // Nothing waits on the heartbeat's response, so don't hold the calling thread for it
+        m_webSocketClientManager->SendSocketMessageAsync(request, [](const GenericOutcome &) {});
     }
 }
 
@@ -486,9 +537,12 @@ void Internal::GameLiftServerState::OnStartGameSession(Aws::GameLift::Server::Mo
     m_gameSessionId = gameSessionId;
 
     // Invoking OnStartGameSession callback if specified by the developer.
-    if (m_onStartGameSession) {
-        std::thread activateGameSession(std::bind(m_onStartGameSession, gameSession, m_startGameSessionState));
-        activateGameSession.detach();
+    if (m_pollEvents) {
+        QueueEvent(ServerEvent::ForStartGameSession(std::move(gameSession)));
+    } else if (m_onStartGameSession) {
+        std::function<void(Aws::GameLift::Server::Model::GameSession)> onStartGameSession =
+            std::bind(m_onStartGameSession, std::placeholders::_1, m_startGameSessionState);
+        m_callbackExecutor->Submit("OnStartGameSession", CallbackExecutor::MovePayloadInto(onStartGameSession, std::move(gameSession)));
     }
 }
 
@@ -498,9 +552,12 @@ void Internal::GameLiftServerState::OnUpdateGameSession(Aws::GameLift::Server::M
     }
 
     // Invoking OnUpdateGameSession callback if specified by the developer.
-    if (m_onUpdateGameSession) {
-        std::thread updateGameSessionThread(std::bind(m_onUpdateGameSession, updateGameSession, m_updateGameSessionState));
-        updateGameSessionThread.detach();
+    if (m_pollEvents) {
+        QueueEvent(ServerEvent::ForUpdateGameSession(std::move(updateGameSession)));
+    } else if (m_onUpdateGameSession) {
+        std::function<void(Aws::GameLift::Server::Model::UpdateGameSession)> onUpdateGameSession =
+            std::bind(m_onUpdateGameSession, std::placeholders::_1, m_updateGameSessionState);
+        m_callbackExecutor->Submit("OnUpdateGameSession", CallbackExecutor::MovePayloadInto(onUpdateGameSession, std::move(updateGameSession)));
     }
 }
 
@@ -513,9 +570,10 @@ void Internal::GameLiftServerState::OnTerminateProcess(long terminationTime) {
     m_terminationTime = terminationTime;
 
     // Invoking onProcessTerminate callback if specified by the developer.
-    if (m_onProcessTerminate) {
-        std::thread terminateProcess(std::bind(m_onProcessTerminate, m_processTerminateState));
-        terminateProcess.detach();
+    if (m_pollEvents) {
+        QueueEvent(ServerEvent::ForProcessTerminate(terminationTime));
+    } else if (m_onProcessTerminate) {
+        m_callbackExecutor->Submit("OnProcessTerminate", std::bind(m_onProcessTerminate, m_processTerminateState));
     }
 }
 
@@ -524,15 +582,47 @@ void Internal::GameLiftServerState::OnRefreshConnection(const std::string &refre
         return;
     }
 
-    m_webSocketClientManager->Connect(refreshConnectionEndpoint, authToken, m_processId, m_hostId, m_fleetId);
+    // This arrives on a socket thread, which the old connection still needs while the new one opens
+    m_webSocketClientManager->ConnectAsync(refreshConnectionEndpoint, authToken, m_processId, m_hostId, m_fleetId, [](const GenericOutcome &outcome) {
+        if (!outcome.IsSuccess()) {
+            printf("Refreshing the connection to GameLift websocket server failed.\n");
+        }
+    });
 }
 
-bool Internal::GameLiftServerState::AssertNetworkInitialized() { return !m_webSocketClientManager || !m_webSocketClientManager->IsConnected(); }
+bool Internal::GameLiftServerState::AssertNetworkInitialized() {
+    return !m_webSocketClientManager || (!m_webSocketClientManager->IsConnected() && !m_connecting);
+}
 #endif
 
 GenericOutcome Internal::GameLiftServerState::InitializeNetworking(const Aws::GameLift::Server::Model::ServerParameters &serverParameters) {
-    // Setup
-    m_webSocketClientManager = new Internal::GameLiftWebSocketClientManager(m_webSocketClientWrapper);
+    // Setup. Besides the scheduler thread, the SDK only starts the callback workers, in ProcessReady. When poll
+    // driven it starts neither, and the socket wrapper doesn't start its threads either.
+    m_pollDriven = serverParameters.GetPollDriven();
+    m_timerScheduler = std::make_shared<TimerScheduler>();
+    if (m_pollDriven) {
+        m_webSocketClientWrapper->SetPollDriven();
+    } else {
+        m_timerScheduler->Start();
+    }
+    if (serverParameters.GetLowFootprint()) {
+        m_webSocketClientWrapper->SetLowFootprint();
+    }
+    if (serverParameters.GetWarmStandby()) {
+        m_webSocketClientWrapper->SetWarmStandby();
+    }
+    m_callbackExecutor = std::unique_ptr<CallbackExecutor>(new CallbackExecutor(m_timerScheduler));
+    // Asynchronous service calls can be made before ProcessReady, so their handlers' worker starts now
+    m_handlerExecutor = std::unique_ptr<CallbackExecutor>(new CallbackExecutor(m_timerScheduler));
+    // The health check's worker starts with the first health check
+    m_healthCheckExecutor = std::unique_ptr<CallbackExecutor>(new CallbackExecutor(m_timerScheduler));
+    if (!m_pollDriven) {
+        m_handlerExecutor->Start();
+    }
+    m_webSocketClientManager = new Internal::GameLiftWebSocketClientManager(m_webSocketClientWrapper, m_timerScheduler);
+    if (m_pollDriven) {
+        m_webSocketClientManager->SetPollDriven();
+    }
 
     // Setup CreateGameSession callback
     // Passing callback raw pointers down is fine since m_webSocketClientWrapper won't outlive the
@@ -572,13 +662,90 @@ GenericOutcome Internal::GameLiftServerState::InitializeNetworking(const Aws::Ga
     m_fleetId = std::string(fleetId == nullptr ? serverParameters.GetFleetId() : fleetId);
     m_hostId = std::string(hostId == nullptr ? serverParameters.GetHostId() : hostId);
     m_processId = std::string(processId == nullptr ? serverParameters.GetProcessId() : processId);
-    GenericOutcome outcome =
-        m_webSocketClientManager->Connect(webSocketUrl == nullptr ? serverParameters.GetWebSocketUrl() : webSocketUrl,
-                                          authToken == nullptr ? serverParameters.GetAuthToken() : authToken, m_processId, m_hostId, m_fleetId);
+    const std::string connectUrl = webSocketUrl == nullptr ? serverParameters.GetWebSocketUrl() : webSocketUrl;
+    const std::string connectAuthToken = authToken == nullptr ? serverParameters.GetAuthToken() : authToken;
+    {
+        std::lock_guard<std::mutex> lock(m_startupMutex);
+        m_startupStart = std::chrono::steady_clock::now();
+    }
+    if (serverParameters.GetAsyncStartup()) {
+        // Return at once and let the game load while the connection is made. ProcessReady and the other service
+        // calls wait for it in the meantime.
+        m_connecting = true;
+        m_webSocketClientManager->ConnectAsync(connectUrl, connectAuthToken, m_processId, m_hostId, m_fleetId,
+                                               [this](const GenericOutcome &outcome) { OnStartupConnected(outcome); });
+        return GenericOutcome(nullptr);
+    }
+    GenericOutcome outcome = m_webSocketClientManager->Connect(connectUrl, connectAuthToken, m_processId, m_hostId, m_fleetId);
+    OnStartupConnected(outcome);
 
     return outcome;
 }
 
+void Internal::GameLiftServerState::OnStartupConnected(const GenericOutcome &outcome) {
+    {
+        std::lock_guard<std::mutex> lock(m_startupMutex);
+        if (outcome.IsSuccess()) {
+            m_connectedAt = std::chrono::steady_clock::now();
+            m_webSocketClientWrapper->GetConnectTimings(m_startupTimings);
+        } else {
+            m_startupConnectFailed = true;
+            m_startupConnectError = outcome.GetError();
+        }
+    }
+    if (m_connecting && !outcome.IsSuccess()) {
+        printf("Connection to GameLift websocket server failed during startup. See GetStartupTimings() for details.\n");
+    }
+    m_connecting = false;
+}
+
+GenericOutcome Internal::GameLiftServerState::ActivateServerProcess(const Aws::GameLift::Server::ProcessParameters &processParameters) {
+    Internal::ActivateServerProcessRequest activateServerProcessRequest(Server::GetSdkVersion().GetResult(), Internal::GameLiftServerState::LANGUAGE,
+                                                                        processParameters.getPort(), processParameters.getLogParameters());
+    Internal::Message &request = activateServerProcessRequest;
+    const std::chrono::steady_clock::time_point sentAt = std::chrono::steady_clock::now();
+
+    if (m_connecting) {
+        // The socket wrapper holds the request until the connection opens and sends it then. The heartbeat
+        // starts once GameLift has answered, as it does after a blocking ProcessReady.
+        m_webSocketClientManager->SendSocketMessageAsync(request, [this, sentAt](const GenericOutcome &outcome) {
+            OnServerProcessActivated(sentAt, outcome);
+            if (!outcome.IsSuccess()) {
+                printf("ProcessReady failed once connected: %s\n", std::string(outcome.GetError().GetErrorMessage()).c_str());
+            }
+            StartHealthCheck();
+        });
+        return GenericOutcome(nullptr);
+    }
+
+    GenericOutcome result = m_webSocketClientManager->SendSocketMessage(request);
+    OnServerProcessActivated(sentAt, result);
+    StartHealthCheck();
+
+    return result;
+}
+
+void Internal::GameLiftServerState::OnServerProcessActivated(std::chrono::steady_clock::time_point sentAt, const GenericOutcome &outcome) {
+    std::lock_guard<std::mutex> lock(m_startupMutex);
+    // Only the first activation is part of startup, not a later ProcessReady
+    if (!outcome.IsSuccess() || m_startupTimings.GetTotalMillis() >= 0) {
+        return;
+    }
+    const std::chrono::steady_clock::time_point activated = std::chrono::steady_clock::now();
+    // Waiting for the connection to open is counted under connecting, not activation
+    const std::chrono::steady_clock::time_point activateStart = std::max(sentAt, m_connectedAt);
+    m_startupTimings.SetActivateMillis(static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(activated - activateStart).count()));
+    m_startupTimings.SetTotalMillis(static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(activated - m_startupStart).count()));
+}
+
+StartupTimingsOutcome Internal::GameLiftServerState::GetStartupTimings() {
+    std::lock_guard<std::mutex> lock(m_startupMutex);
+    if (m_startupConnectFailed) {
+        return StartupTimingsOutcome(m_startupConnectError);
+    }
+    return StartupTimingsOutcome(m_startupTimings);
+}
+
 DescribePlayerSessionsOutcome
 Internal::GameLiftServerState::DescribePlayerSessions(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest) {
     if (AssertNetworkInitialized()) {
@@ -586,13 +753,20 @@ Internal::GameLiftServerState::DescribePlayerSessions(const Aws::GameLift::Serve
     }
 
     WebSocketDescribePlayerSessionsRequest request = Internal::DescribePlayerSessionsAdapter::convert(describePlayerSessionsRequest);
-    GenericOutcome rawResponse = m_webSocketClientManager->SendSocketMessage(request);
+    return ToDescribePlayerSessionsOutcome(m_webSocketClientManager->SendSocketMessage(request));
+}
+
+DescribePlayerSessionsOutcome Internal::GameLiftServerState::ToDescribePlayerSessionsOutcome(const GenericOutcome &rawResponse) {
     if (rawResponse.IsSuccess()) {
-        WebSocketDescribePlayerSessionsResponse *webSocketResponse = static_cast<WebSocketDescribePlayerSessionsResponse *>(rawResponse.GetResult());
-        DescribePlayerSessionsResult result = Internal::DescribePlayerSessionsAdapter::convert(webSocketResponse);
-        delete webSocketResponse;
+        DescribePlayerSessionsResult *decodedResult = static_cast<DescribePlayerSessionsResult *>(rawResponse.GetResult());
+#ifdef GAMELIFT_USE_STD
+        DescribePlayerSessionsOutcome outcome(std::move(*decodedResult));
+#else
+        DescribePlayerSessionsOutcome outcome(*decodedResult);
+#endif
+        delete decodedResult;
 
-        return DescribePlayerSessionsOutcome(result);
+        return outcome;
     } else {
         return DescribePlayerSessionsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
     }
@@ -605,7 +779,10 @@ Internal::GameLiftServerState::StartMatchBackfill(const Aws::GameLift::Server::M
     }
 
     WebSocketStartMatchBackfillRequest request = Internal::StartMatchBackfillAdapter::convert(startMatchBackfillRequest);
-    GenericOutcome rawResponse = m_webSocketClientManager->SendSocketMessage(request);
+    return ToStartMatchBackfillOutcome(m_webSocketClientManager->SendSocketMessage(request));
+}
+
+StartMatchBackfillOutcome Internal::GameLiftServerState::ToStartMatchBackfillOutcome(const GenericOutcome &rawResponse) {
     if (rawResponse.IsSuccess()) {
         WebSocketStartMatchBackfillResponse *webSocketResponse = static_cast<WebSocketStartMatchBackfillResponse *>(rawResponse.GetResult());
         StartMatchBackfillResult result = Internal::StartMatchBackfillAdapter::convert(webSocketResponse);
@@ -636,7 +813,10 @@ GetComputeCertificateOutcome Internal::GameLiftServerState::GetComputeCertificat
     }
 
     WebSocketGetComputeCertificateRequest request;
-    GenericOutcome rawResponse = m_webSocketClientManager->SendSocketMessage(request);
+    return ToGetComputeCertificateOutcome(m_webSocketClientManager->SendSocketMessage(request));
+}
+
+GetComputeCertificateOutcome Internal::GameLiftServerState::ToGetComputeCertificateOutcome(const GenericOutcome &rawResponse) {
     if (rawResponse.IsSuccess()) {
         WebSocketGetComputeCertificateResponse *webSocketResponse = static_cast<WebSocketGetComputeCertificateResponse *>(rawResponse.GetResult());
         GetComputeCertificateResult result = GetComputeCertificateResult()
@@ -656,34 +836,49 @@ Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws::GameLift::Serv
         return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED));
     }
 
+    auto webSocketRequest = Internal::GetFleetRoleCredentialsAdapter::convert(request);
+    GetFleetRoleCredentialsOutcome localOutcome;
+    if (TryResolveFleetRoleCredentialsLocally(webSocketRequest, localOutcome)) {
+        return localOutcome;
+    }
+
+    auto rawResponse = m_webSocketClientManager->SendSocketMessage(webSocketRequest);
+    return ToGetFleetRoleCredentialsOutcome(webSocketRequest.GetRoleArn(), rawResponse);
+}
+
+bool Internal::GameLiftServerState::TryResolveFleetRoleCredentialsLocally(WebSocketGetFleetRoleCredentialsRequest &webSocketRequest,
+                                                                          GetFleetRoleCredentialsOutcome &outcome) {
     // If we've decided we're not on managed EC2, fail without making an APIGW call
     if (!m_onManagedEC2) {
-        return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
+        outcome = GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
+        return true;
     }
 
-    auto webSocketRequest = Internal::GetFleetRoleCredentialsAdapter::convert(request);
-
     // Check if we're cached credentials recently that still has at least 15 minutes before
     // expiration
-    if (m_instanceRoleResultCache.find(webSocketRequest.GetRoleArn()) != m_instanceRoleResultCache.end()) {
-        auto previousResult = m_instanceRoleResultCache[webSocketRequest.GetRoleArn()];
+    {
+        std::lock_guard<std::mutex> lock(m_instanceRoleResultCacheMutex);
+        if (m_instanceRoleResultCache.find(webSocketRequest.GetRoleArn()) != m_instanceRoleResultCache.end()) {
+            auto previousResult = m_instanceRoleResultCache[webSocketRequest.GetRoleArn()];
 #ifdef GAMELIFT_USE_STD
-        std::tm expiration = previousResult.GetExpiration();
+            std::tm expiration = previousResult.GetExpiration();
 #ifdef WIN32
-        time_t previousResultExpiration = _mkgmtime(&expiration);
+            time_t previousResultExpiration = _mkgmtime(&expiration);
 #else
-        time_t previousResultExpiration = timegm(&expiration);
+            time_t previousResultExpiration = timegm(&expiration);
 #endif
 #else
-        time_t previousResultExpiration = previousResult.GetExpiration();
+            time_t previousResultExpiration = previousResult.GetExpiration();
 #endif
-        time_t currentTime = time(nullptr);
+            time_t currentTime = time(nullptr);
 
-        if ((previousResultExpiration - INSTANCE_ROLE_CREDENTIAL_TTL_MIN) > currentTime) {
-            return GetFleetRoleCredentialsOutcome(previousResult);
-        }
+            if ((previousResultExpiration - INSTANCE_ROLE_CREDENTIAL_TTL_MIN) > currentTime) {
+                outcome = GetFleetRoleCredentialsOutcome(previousResult);
+                return true;
+            }
 
-        m_instanceRoleResultCache.erase(webSocketRequest.GetRoleArn());
+            m_instanceRoleResultCache.erase(webSocketRequest.GetRoleArn());
+        }
     }
 
     if (webSocketRequest.GetRoleSessionName().empty()) {
@@ -695,10 +890,14 @@ Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws::GameLift::Serv
     }
 
     if (webSocketRequest.GetRoleSessionName().length() > MAX_ROLE_SESSION_NAME_LENGTH) {
-        return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
+        outcome = GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
+        return true;
     }
 
-    auto rawResponse = m_webSocketClientManager->SendSocketMessage(webSocketRequest);
+    return false;
+}
+
+GetFleetRoleCredentialsOutcome Internal::GameLiftServerState::ToGetFleetRoleCredentialsOutcome(const std::string &roleArn, const GenericOutcome &rawResponse) {
     if (!rawResponse.IsSuccess()) {
         return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
     }
@@ -713,10 +912,178 @@ Internal::GameLiftServerState::GetFleetRoleCredentials(const Aws::GameLift::Serv
     }
 
     auto result = Internal::GetFleetRoleCredentialsAdapter::convert(webSocketResponse.get());
-    m_instanceRoleResultCache[webSocketRequest.GetRoleArn()] = result;
+    {
+        std::lock_guard<std::mutex> lock(m_instanceRoleResultCacheMutex);
+        m_instanceRoleResultCache[roleArn] = result;
+    }
     return GetFleetRoleCredentialsOutcome(result);
 }
 
+template <typename OutcomeT>
+std::function<void(const OutcomeT &)> Internal::GameLiftServerState::OnHandlerExecutor(const char *name,
+                                                                                        const std::function<void(const OutcomeT &)> &handler) {
+    // When poll driven, handlers run last in Poll along with the other callbacks, since one may call Destroy()
+    CallbackExecutor *executor = m_pollDriven ? m_callbackExecutor.get() : m_handlerExecutor.get();
+    return [executor, name, handler](const OutcomeT &outcome) { executor->Submit(name, [handler, outcome] { handler(outcome); }); };
+}
+
+void Internal::GameLiftServerState::ProcessEndingAsync(const GenericOutcomeCallback &callback, int timeoutMillis) {
+    m_processReady = false;
+
+    if (AssertNetworkInitialized()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)));
+        return;
+    }
+
+    Internal::TerminateServerProcessRequest request;
+    const GenericOutcomeCallback handler = OnHandlerExecutor<GenericOutcome>("ProcessEndingAsync", callback);
+    m_webSocketClientManager->SendSocketMessageAsync(request, handler, std::chrono::milliseconds(timeoutMillis));
+}
+
+void Internal::GameLiftServerState::ActivateGameSessionAsync(const GenericOutcomeCallback &callback, int timeoutMillis) {
+    if (!m_processReady) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)));
+        return;
+    }
+
+    if (AssertNetworkInitialized()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)));
+        return;
+    }
+
+    Internal::ActivateGameSessionRequest request(m_gameSessionId);
+    const GenericOutcomeCallback handler = OnHandlerExecutor<GenericOutcome>("ActivateGameSessionAsync", callback);
+    m_webSocketClientManager->SendSocketMessageAsync(request, handler, std::chrono::milliseconds(timeoutMillis));
+}
+
+void Internal::GameLiftServerState::UpdatePlayerSessionCreationPolicyAsync(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy,
+                                                                           const GenericOutcomeCallback &callback, int timeoutMillis) {
+    if (AssertNetworkInitialized()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)));
+        return;
+    }
+
+    if (m_gameSessionId.empty()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET)));
+        return;
+    }
+
+    Internal::UpdatePlayerSessionCreationPolicyRequest request(m_gameSessionId,
+                                                               PlayerSessionCreationPolicyMapper::GetNameForPlayerSessionCreationPolicy(newPlayerSessionPolicy));
+    const GenericOutcomeCallback handler = OnHandlerExecutor<GenericOutcome>("UpdatePlayerSessionCreationPolicyAsync", callback);
+    m_webSocketClientManager->SendSocketMessageAsync(request, handler, std::chrono::milliseconds(timeoutMillis));
+}
+
+void Internal::GameLiftServerState::AcceptPlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeCallback &callback, int timeoutMillis) {
+    if (AssertNetworkInitialized()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)));
+        return;
+    }
+
+    if (m_gameSessionId.empty()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET)));
+        return;
+    }
+
+    AcceptPlayerSessionRequest request = AcceptPlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId);
+    const GenericOutcomeCallback handler = OnHandlerExecutor<GenericOutcome>("AcceptPlayerSessionAsync", callback);
+    m_webSocketClientManager->SendSocketMessageAsync(request, handler, std::chrono::milliseconds(timeoutMillis));
+}
+
+void Internal::GameLiftServerState::RemovePlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeCallback &callback, int timeoutMillis) {
+    if (AssertNetworkInitialized()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)));
+        return;
+    }
+
+    if (m_gameSessionId.empty()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAME_SESSION_ID_NOT_SET)));
+        return;
+    }
+
+    RemovePlayerSessionRequest request = RemovePlayerSessionRequest().WithGameSessionId(m_gameSessionId).WithPlayerSessionId(playerSessionId);
+    const GenericOutcomeCallback handler = OnHandlerExecutor<GenericOutcome>("RemovePlayerSessionAsync", callback);
+    m_webSocketClientManager->SendSocketMessageAsync(request, handler, std::chrono::milliseconds(timeoutMillis));
+}
+
+void Internal::GameLiftServerState::DescribePlayerSessionsAsync(
+    const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest, const DescribePlayerSessionsOutcomeCallback &callback,
+    int timeoutMillis) {
+    if (AssertNetworkInitialized()) {
+        callback(DescribePlayerSessionsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)));
+        return;
+    }
+
+    WebSocketDescribePlayerSessionsRequest request = Internal::DescribePlayerSessionsAdapter::convert(describePlayerSessionsRequest);
+    const DescribePlayerSessionsOutcomeCallback handler = OnHandlerExecutor<DescribePlayerSessionsOutcome>("DescribePlayerSessionsAsync", callback);
+    m_webSocketClientManager->SendSocketMessageAsync(
+        request, [handler](const GenericOutcome &rawResponse) { handler(ToDescribePlayerSessionsOutcome(rawResponse)); },
+        std::chrono::milliseconds(timeoutMillis));
+}
+
+void Internal::GameLiftServerState::StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &startMatchBackfillRequest,
+                                                            const StartMatchBackfillOutcomeCallback &callback, int timeoutMillis) {
+    if (AssertNetworkInitialized()) {
+        callback(StartMatchBackfillOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)));
+        return;
+    }
+
+    WebSocketStartMatchBackfillRequest request = Internal::StartMatchBackfillAdapter::convert(startMatchBackfillRequest);
+    const StartMatchBackfillOutcomeCallback handler = OnHandlerExecutor<StartMatchBackfillOutcome>("StartMatchBackfillAsync", callback);
+    m_webSocketClientManager->SendSocketMessageAsync(
+        request, [handler](const GenericOutcome &rawResponse) { handler(ToStartMatchBackfillOutcome(rawResponse)); },
+        std::chrono::milliseconds(timeoutMillis));
+}
+
+void Internal::GameLiftServerState::StopMatchBackfillAsync(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &stopMatchBackfillRequest,
+                                                           const GenericOutcomeCallback &callback, int timeoutMillis) {
+    if (AssertNetworkInitialized()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)));
+        return;
+    }
+
+    Internal::WebSocketStopMatchBackfillRequest request = Internal::WebSocketStopMatchBackfillRequest()
+                                                              .WithTicketId(stopMatchBackfillRequest.GetTicketId())
+                                                              .WithGameSessionArn(stopMatchBackfillRequest.GetGameSessionArn())
+                                                              .WithMatchmakingConfigurationArn(stopMatchBackfillRequest.GetMatchmakingConfigurationArn());
+    const GenericOutcomeCallback handler = OnHandlerExecutor<GenericOutcome>("StopMatchBackfillAsync", callback);
+    m_webSocketClientManager->SendSocketMessageAsync(request, handler, std::chrono::milliseconds(timeoutMillis));
+}
+
+void Internal::GameLiftServerState::GetComputeCertificateAsync(const GetComputeCertificateOutcomeCallback &callback, int timeoutMillis) {
+    if (AssertNetworkInitialized()) {
+        callback(GetComputeCertificateOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)));
+        return;
+    }
+
+    WebSocketGetComputeCertificateRequest request;
+    const GetComputeCertificateOutcomeCallback handler = OnHandlerExecutor<GetComputeCertificateOutcome>("GetComputeCertificateAsync", callback);
+    m_webSocketClientManager->SendSocketMessageAsync(
+        request, [handler](const GenericOutcome &rawResponse) { handler(ToGetComputeCertificateOutcome(rawResponse)); },
+        std::chrono::milliseconds(timeoutMillis));
+}
+
+void Internal::GameLiftServerState::GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                                                 const GetFleetRoleCredentialsOutcomeCallback &callback, int timeoutMillis) {
+    if (AssertNetworkInitialized()) {
+        callback(GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::GAMELIFT_SERVER_NOT_INITIALIZED)));
+        return;
+    }
+
+    auto webSocketRequest = Internal::GetFleetRoleCredentialsAdapter::convert(request);
+    GetFleetRoleCredentialsOutcome localOutcome;
+    if (TryResolveFleetRoleCredentialsLocally(webSocketRequest, localOutcome)) {
+        callback(localOutcome);
+        return;
+    }
+
+    std::string roleArn = webSocketRequest.GetRoleArn();
+    const GetFleetRoleCredentialsOutcomeCallback handler = OnHandlerExecutor<GetFleetRoleCredentialsOutcome>("GetFleetRoleCredentialsAsync", callback);
+    m_webSocketClientManager->SendSocketMessageAsync(webSocketRequest, [this, roleArn, handler](const GenericOutcome &rawResponse) {
+        handler(ToGetFleetRoleCredentialsOutcome(roleArn, rawResponse));
+    }, std::chrono::milliseconds(timeoutMillis));
+}
+
 void Internal::GameLiftServerState::GetOverrideParams(char **webSocketUrl, char **authToken, char **processId, char **hostId, char **fleetId) {
     *webSocketUrl = std::getenv(ENV_VAR_WEBSOCKET_URL);
     *authToken = std::getenv(ENV_VAR_AUTH_TOKEN);
@@ -725,18 +1092,81 @@ void Internal::GameLiftServerState::GetOverrideParams(char **webSocketUrl, char
     *fleetId = std::getenv(ENV_VAR_FLEET_ID);
 }
 
-void Internal::GameLiftServerState::HealthCheck() {
+void Internal::GameLiftServerState::StartCallbackExecutor(const Aws::GameLift::Server::ProcessParameters &processParameters) {
+    // Networking may not be initialized, in which case ProcessReady fails and no callback can arrive. When poll
+    // driven, the callbacks run in Poll instead of on workers.
+    if (m_callbackExecutor && !m_pollDriven) {
+        m_callbackExecutor->Start(processParameters.getMaxConcurrentCallbacks(), std::chrono::milliseconds(processParameters.getSlowCallbackThresholdMillis()));
+    }
+}
+
+void Internal::GameLiftServerState::StartEventQueue(const Aws::GameLift::Server::ProcessParameters &processParameters) {
+    // Calling ProcessReady again keeps the queue, and any events still in it
+    if (processParameters.getPollEvents() && !m_eventQueue) {
+        const int capacity = processParameters.getEventQueueCapacity();
+        m_eventQueue = std::unique_ptr<BoundedMpscQueue<ServerEvent>>(
+            new BoundedMpscQueue<ServerEvent>(capacity > 0 ? capacity : Aws::GameLift::Server::ProcessParameters::DEFAULT_EVENT_QUEUE_CAPACITY));
+    }
+    m_pollEvents = m_eventQueue != nullptr;
+}
+
+void Internal::GameLiftServerState::QueueEvent(ServerEvent &&event) {
+    if (!m_eventQueue->TryPush(std::move(event))) {
+        printf("Event queue is full, dropping event %d. Call PollEvents more often or raise the event queue capacity.\n", static_cast<int>(event.GetType()));
+    }
+}
+
+AwsLongOutcome Internal::GameLiftServerState::PollEvents(const ServerEventCallback &callback, int maxEvents) {
+    if (!m_eventQueue) {
+        return AwsLongOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY));
+    }
+
+    long polledEvents = 0;
+    while ((maxEvents < 0 || polledEvents < maxEvents) && m_eventQueue->TryConsume(callback)) {
+        polledEvents++;
+    }
+    return AwsLongOutcome(polledEvents);
+}
+
+AwsLongOutcome Internal::GameLiftServerState::Poll(std::chrono::microseconds budget) {
+    if (!m_pollDriven) {
+        return AwsLongOutcome(0L);
+    }
+
+    long workRun = static_cast<long>(m_webSocketClientWrapper->Poll(budget));
+    workRun += static_cast<long>(m_timerScheduler->RunDueTimers(std::chrono::steady_clock::now()));
+    workRun += static_cast<long>(m_healthCheckExecutor->RunQueuedCallbacks());
+    // Callbacks run last: one may call Destroy(), after which this state must not be touched
+    workRun += static_cast<long>(m_callbackExecutor->RunQueuedCallbacks());
+    return AwsLongOutcome(workRun);
+}
+
+void Internal::GameLiftServerState::StartHealthCheck() {
     // Seed the random number generator used to generate healthCheck interval jitters
     std::srand(std::time(0));
 
-    while (m_processReady) {
-        std::async(std::launch::async, &Internal::GameLiftServerState::ReportHealth, this);
-        std::chrono::duration<long int, std::ratio<1, 1000>> time = std::chrono::milliseconds(GetNextHealthCheckIntervalMillis());
-        std::unique_lock<std::mutex> lock(m_healthCheckMutex);
-        // If the lambda below returns false, the thread will wait until "time" millis expires. If
-        // it returns true, the thread immediately continues.
-        m_healthCheckConditionVariable.wait_for(lock, time, [&]() { return m_healthCheckInterrupted; });
+    // A single worker, so a callback that hangs only holds up the checks after it, which report unhealthy meanwhile
+    if (!m_pollDriven) {
+        m_healthCheckExecutor->Start();
+    }
+
+    std::lock_guard<std::mutex> lock(m_healthCheckMutex);
+    // Calling ProcessReady again restarts the heartbeat instead of starting a second one
+    m_timerScheduler->Cancel(m_healthCheckTimer);
+    m_healthCheckTimer = m_timerScheduler->Schedule(std::chrono::milliseconds(0), [this] { HealthCheck(); });
+}
+
+void Internal::GameLiftServerState::HealthCheck() {
+    {
+        std::lock_guard<std::mutex> lock(m_healthCheckMutex);
+        if (!m_processReady) {
+            m_healthCheckTimer = TimerScheduler::INVALID_TIMER_ID;
+            return;
+        }
+        // Schedule the next heartbeat before reporting, so a slow health callback doesn't stretch the interval
+        m_healthCheckTimer = m_timerScheduler->Schedule(std::chrono::milliseconds(GetNextHealthCheckIntervalMillis()), [this] { HealthCheck(); });
     }
+    ReportHealth();
 }
 
 int Internal::GameLiftServerState::GetNextHealthCheckIntervalMillis() {
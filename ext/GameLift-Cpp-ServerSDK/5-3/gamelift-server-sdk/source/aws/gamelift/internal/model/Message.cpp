@@ -11,71 +11,130 @@
  */
 
 #include <aws/gamelift/internal/model/Message.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 #include <aws/gamelift/internal/util/JsonHelper.h>
+#include <algorithm>
+#include <atomic>
 #include <random>
-#include <sstream>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+namespace {
+std::string GenerateRequestIdPrefix(size_t length) {
+    static const char alphaNumChars[] = "0123456789"
+                                        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                        "abcdefghijklmnopqrstuvwxyz";
+    std::mt19937 randomNumberGenerator(std::random_device{}());
+    // Distribution has an inclusive upper bound. "alphaNumChars" will end in a null terminator, so
+    // we use "sizeof() - 2" to avoid out of bounds errors, and also to avoid including the null
+    // terminator.
+    std::uniform_int_distribution<int> distribution(0, sizeof(alphaNumChars) - 2);
+
+    std::string prefix(length, '0');
+    for (size_t i = 0; i < length; i++) {
+        prefix[i] = alphaNumChars[distribution(randomNumberGenerator)];
+    }
+    return prefix;
+}
+} // namespace
+
 std::string Message::Serialize() const {
-    // Create the buffer & Writer for the object
-    rapidjson::StringBuffer buffer;
+    rapidjson::StringBuffer &buffer = JsonHelper::GetThreadLocalBuffer();
+    if (SerializeTo(buffer)) {
+        return std::string(buffer.GetString(), buffer.GetSize());
+    }
+    return "";
+}
+
+bool Message::SerializeTo(rapidjson::StringBuffer &buffer) const {
+    buffer.Clear();
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
 
     // Start the object and call Serialize to serialize.
     writer.StartObject();
     if (Serialize(&writer)) {
         writer.EndObject();
-        return buffer.GetString();
+        return true;
     }
-    return "";
+    return false;
 }
 
 bool Message::Deserialize(const std::string &jsonString) {
     // Parse the json into a document
-    rapidjson::Document doc;
-    if (doc.Parse(jsonString.c_str()).HasParseError()) {
+    const rapidjson::Value *doc = JsonHelper::ParseThreadLocal(jsonString);
+    if (doc == nullptr) {
         return false;
     }
 
     // Call Deserialize to populate the object's member variables
-    return Deserialize(doc);
+    return Deserialize(*doc);
 }
 
-bool Message::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    JsonHelper::WriteNonEmptyString(writer, ACTION, m_action);
-    JsonHelper::WriteNonEmptyString(writer, REQUEST_ID, m_requestId);
-    return true;
+const JsonFieldTable<Message> &Message::GetJsonFields() {
+    typedef JsonField<Message> Field;
+    static const Field fields[] = {
+        Field::String<&Message::m_action>(ACTION),
+        Field::String<&Message::m_requestId>(REQUEST_ID),
+    };
+    static const JsonFieldTable<Message> table(fields);
+    return table;
 }
 
-bool Message::Deserialize(const rapidjson::Value &value) {
-    m_action = JsonHelper::SafelyDeserializeString(value, ACTION);
-    m_requestId = JsonHelper::SafelyDeserializeString(value, REQUEST_ID);
-    return true;
-}
+bool Message::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool Message::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const Message &message) {
     os << message.Serialize();
     return os;
 }
 
-std::string Message::GenerateRandomRequestId() {
-    std::stringstream ss;
-    static const char alphaNumChars[] = "0123456789"
-                                        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                        "abcdefghijklmnopqrstuvwxyz";
-    static thread_local std::mt19937 randomNumberGenerator(std::random_device{}());
-    // Distribution has an inclusive upper bound. "alphaNumChars" will end in a null terminator, so
-    // we use "sizeof() - 2" to avoid out of bounds errors, and also to avoid including the null
-    // terminator.
-    std::uniform_int_distribution<int> distribution(0, sizeof(alphaNumChars) - 2);
+std::string Message::GenerateRequestId() {
+    static const char hexChars[] = "0123456789abcdef";
+    // Random per process so that IDs from different processes don't collide, generated only once
+    static const std::string prefix = GenerateRequestIdPrefix(REQUEST_ID_PREFIX_LENGTH);
+    static std::atomic<uint64_t> nextRequestHandle(1);
+
+    char requestId[REQUEST_ID_LENGTH];
+    std::copy(prefix.begin(), prefix.end(), requestId);
+
+    // The remaining characters encode the request handle as fixed-width lowercase hex
+    uint64_t handle = nextRequestHandle.fetch_add(1, std::memory_order_relaxed) & REQUEST_HANDLE_MASK;
+    for (size_t i = REQUEST_ID_LENGTH; i > REQUEST_ID_PREFIX_LENGTH; i--) {
+        requestId[i - 1] = hexChars[handle & 0xF];
+        handle >>= 4;
+    }
+    return std::string(requestId, REQUEST_ID_LENGTH);
+}
+
+uint64_t Message::ToRequestHandle(const std::string &requestId) {
+    if (requestId.length() == REQUEST_ID_LENGTH) {
+        uint64_t handle = 0;
+        bool isHex = true;
+        for (size_t i = REQUEST_ID_LENGTH - REQUEST_HANDLE_HEX_DIGITS; i < REQUEST_ID_LENGTH && isHex; i++) {
+            const char c = requestId[i];
+            if (c >= '0' && c <= '9') {
+                handle = (handle << 4) | static_cast<uint64_t>(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                handle = (handle << 4) | static_cast<uint64_t>(c - 'a' + 10);
+            } else {
+                isHex = false;
+            }
+        }
+        if (isHex && handle <= REQUEST_HANDLE_MASK) {
+            return handle;
+        }
+    }
 
-    for (int i = 0; i < 32; i++) {
-        ss << alphaNumChars[distribution(randomNumberGenerator)];
+    // Request IDs not generated by this process are hashed (FNV-1a) into the handle space
+    uint64_t hash = 14695981039346656037ULL;
+    for (char c : requestId) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
     }
-    return ss.str();
+    return hash & REQUEST_HANDLE_MASK;
 }
 
 } // namespace Internal
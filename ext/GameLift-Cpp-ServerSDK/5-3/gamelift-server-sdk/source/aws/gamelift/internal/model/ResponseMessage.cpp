@@ -11,24 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/ResponseMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool ResponseMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WritePositiveInt(writer, STATUS_CODE, m_statusCode);
-    JsonHelper::WriteNonEmptyString(writer, ERROR_MESSAGE, m_errorMessage);
-    return true;
+const JsonFieldTable<ResponseMessage> &ResponseMessage::GetJsonFields() {
+    typedef JsonField<ResponseMessage> Field;
+    static const Field fields[] = {
+        Field::Int<&ResponseMessage::m_statusCode>(STATUS_CODE),
+        Field::String<&ResponseMessage::m_errorMessage>(ERROR_MESSAGE),
+    };
+    static const JsonFieldTable<ResponseMessage> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool ResponseMessage::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_statusCode = JsonHelper::SafelyDeserializeInt(value, STATUS_CODE);
-    m_errorMessage = JsonHelper::SafelyDeserializeString(value, ERROR_MESSAGE);
-    return true;
-}
+bool ResponseMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool ResponseMessage::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const ResponseMessage &responseMessage) {
     const Message *message = &responseMessage;
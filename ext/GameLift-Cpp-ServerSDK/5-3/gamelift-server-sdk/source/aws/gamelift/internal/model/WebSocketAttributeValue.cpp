@@ -10,34 +10,35 @@
  */
 
 #include <aws/gamelift/internal/model/WebSocketAttributeValue.h>
+#include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
 std::string WebSocketAttributeValue::Serialize() const {
-    // Create the buffer & Writer for the object
-    rapidjson::StringBuffer buffer;
+    // Reuse this thread's buffer, it's copied into the returned string
+    rapidjson::StringBuffer &buffer = JsonHelper::GetThreadLocalBuffer();
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
 
     // Start the object and call Serialize to serialize.
     writer.StartObject();
     if (Serialize(&writer)) {
         writer.EndObject();
-        return buffer.GetString();
+        return std::string(buffer.GetString(), buffer.GetSize());
     }
     return "";
 }
 
 bool WebSocketAttributeValue::Deserialize(const std::string &jsonString) {
     // Parse the json into a document
-    rapidjson::Document doc;
-    if (doc.Parse(jsonString.c_str()).HasParseError()) {
+    const rapidjson::Value *doc = JsonHelper::ParseThreadLocal(jsonString);
+    if (doc == nullptr) {
         return false;
     }
 
     // Call Deserialize to populate the object's member variables
-    return Deserialize(doc);
+    return Deserialize(*doc);
 }
 
 bool WebSocketAttributeValue::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
@@ -11,6 +11,7 @@
  */
 
 #include <aws/gamelift/internal/model/WebSocketGameSession.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 #include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
@@ -33,58 +34,36 @@ std::string WebSocketGameSession::Serialize() const {
 
 bool WebSocketGameSession::Deserialize(const std::string &jsonString) {
     // Parse the json into a document
-    rapidjson::Document doc;
-    if (doc.Parse(jsonString.c_str()).HasParseError()) {
+    const rapidjson::Value *doc = JsonHelper::ParseThreadLocal(jsonString);
+    if (doc == nullptr) {
         return false;
     }
 
     // Call Deserialize to populate the object's member variables
-    return Deserialize(doc);
+    return Deserialize(*doc);
 }
 
-bool WebSocketGameSession::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, NAME, m_name);
-    JsonHelper::WriteNonEmptyString(writer, FLEET_ID, m_fleetId);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_DATA, m_gameSessionData);
-    JsonHelper::WriteNonEmptyString(writer, MATCHMAKER_DATA, m_matchmakerData);
-    JsonHelper::WriteNonEmptyString(writer, DNS_NAME, m_dnsName);
-    JsonHelper::WriteNonEmptyString(writer, IP_ADDRESS, m_ipAddress);
-    JsonHelper::WritePositiveInt(writer, MAXIMUM_PLAYER_SESSION_COUNT, m_maximumPlayerSessionCount);
-    JsonHelper::WritePositiveInt(writer, PORT, m_port);
-
-    writer->String(GAME_PROPERTIES);
-    writer->StartObject();
-    for (auto const &property : m_gameProperties) {
-        writer->String(property.first.c_str());
-        writer->String(property.second.c_str());
-    }
-    writer->EndObject();
-    return true;
+const JsonFieldTable<WebSocketGameSession> &WebSocketGameSession::GetJsonFields() {
+    typedef JsonField<WebSocketGameSession> Field;
+    static const Field fields[] = {
+        Field::String<&WebSocketGameSession::m_gameSessionId>(GAME_SESSION_ID),
+        Field::String<&WebSocketGameSession::m_name>(NAME),
+        Field::String<&WebSocketGameSession::m_fleetId>(FLEET_ID),
+        Field::String<&WebSocketGameSession::m_gameSessionData>(GAME_SESSION_DATA),
+        Field::String<&WebSocketGameSession::m_matchmakerData>(MATCHMAKER_DATA),
+        Field::String<&WebSocketGameSession::m_dnsName>(DNS_NAME),
+        Field::String<&WebSocketGameSession::m_ipAddress>(IP_ADDRESS),
+        Field::Int<&WebSocketGameSession::m_maximumPlayerSessionCount>(MAXIMUM_PLAYER_SESSION_COUNT),
+        Field::Int<&WebSocketGameSession::m_port>(PORT),
+        Field::StringMap<&WebSocketGameSession::m_gameProperties>(GAME_PROPERTIES),
+    };
+    static const JsonFieldTable<WebSocketGameSession> table(fields);
+    return table;
 }
 
-bool WebSocketGameSession::Deserialize(const rapidjson::Value &value) {
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_name = JsonHelper::SafelyDeserializeString(value, NAME);
-    m_fleetId = JsonHelper::SafelyDeserializeString(value, FLEET_ID);
-    m_gameSessionData = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_DATA);
-    m_matchmakerData = JsonHelper::SafelyDeserializeString(value, MATCHMAKER_DATA);
-    m_dnsName = JsonHelper::SafelyDeserializeString(value, DNS_NAME);
-    m_ipAddress = JsonHelper::SafelyDeserializeString(value, IP_ADDRESS);
-
-    m_maximumPlayerSessionCount = JsonHelper::SafelyDeserializeInt(value, MAXIMUM_PLAYER_SESSION_COUNT);
-    m_port = JsonHelper::SafelyDeserializeInt(value, PORT);
+bool WebSocketGameSession::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
 
-    if (value.HasMember(GAME_PROPERTIES) && !value[GAME_PROPERTIES].IsNull()) {
-        for (auto itr = value[GAME_PROPERTIES].MemberBegin(); itr != value[GAME_PROPERTIES].MemberEnd(); ++itr) {
-            if (itr->name.IsString() && itr->value.IsString()) {
-                m_gameProperties[itr->name.GetString()] = itr->value.GetString();
-            }
-        }
-    }
-
-    return true;
-}
+bool WebSocketGameSession::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketGameSession &gameSession) {
     const WebSocketGameSession *message = &gameSession;
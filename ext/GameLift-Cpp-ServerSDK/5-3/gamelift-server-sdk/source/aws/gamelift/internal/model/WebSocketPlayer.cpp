@@ -10,6 +10,7 @@
  */
 
 #include <aws/gamelift/internal/model/WebSocketPlayer.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 #include <aws/gamelift/internal/util/JsonHelper.h>
 #include <iostream>
 
@@ -33,67 +34,30 @@ std::string WebSocketPlayer::Serialize() const {
 
 bool WebSocketPlayer::Deserialize(const std::string &jsonString) {
     // Parse the json into a document
-    rapidjson::Document doc;
-    if (doc.Parse(jsonString.c_str()).HasParseError()) {
+    const rapidjson::Value *doc = JsonHelper::ParseThreadLocal(jsonString);
+    if (doc == nullptr) {
         return false;
     }
 
     // Call Deserialize to populate the object's member variables
-    return Deserialize(doc);
+    return Deserialize(*doc);
 }
 
-bool WebSocketPlayer::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_ID, m_playerId);
-
-    writer->String(PLAYER_ATTRIBUTES);
-    writer->StartObject();
-    for (auto const &playerAttributesIter : m_playerAttributes) {
-        writer->String(playerAttributesIter.first.c_str());
-        writer->StartObject();
-        playerAttributesIter.second.Serialize(writer);
-        writer->EndObject();
-    }
-    writer->EndObject();
-
-    writer->String(LATENCY_IN_MS);
-    writer->StartObject();
-    for (auto const &latencyMsIter : m_latencyInMs) {
-        writer->String(latencyMsIter.first.c_str());
-        writer->Int(latencyMsIter.second);
-    }
-    writer->EndObject();
-
-    JsonHelper::WriteNonEmptyString(writer, TEAM, m_team);
-
-    return true;
+const JsonFieldTable<WebSocketPlayer> &WebSocketPlayer::GetJsonFields() {
+    typedef JsonField<WebSocketPlayer> Field;
+    static const Field fields[] = {
+        Field::String<&WebSocketPlayer::m_playerId>(PLAYER_ID),
+        Field::ObjectMap<WebSocketAttributeValue, &WebSocketPlayer::m_playerAttributes>(PLAYER_ATTRIBUTES),
+        Field::IntMap<&WebSocketPlayer::m_latencyInMs>(LATENCY_IN_MS),
+        Field::String<&WebSocketPlayer::m_team>(TEAM),
+    };
+    static const JsonFieldTable<WebSocketPlayer> table(fields);
+    return table;
 }
 
-bool WebSocketPlayer::Deserialize(const rapidjson::Value &value) {
+bool WebSocketPlayer::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
 
-    m_playerId = JsonHelper::SafelyDeserializeString(value, PLAYER_ID);
-    m_team = JsonHelper::SafelyDeserializeString(value, TEAM);
-
-    if (value.HasMember(PLAYER_ATTRIBUTES) && !value[PLAYER_ATTRIBUTES].IsNull()) {
-        for (auto itr = value[PLAYER_ATTRIBUTES].MemberBegin(); itr != value[PLAYER_ATTRIBUTES].MemberEnd(); ++itr) {
-            if (itr->name.IsString() && !itr->value.IsNull()) {
-                WebSocketAttributeValue value;
-                value.Deserialize(itr->value);
-                m_playerAttributes[itr->name.GetString()] = value;
-            }
-        }
-    }
-
-    if (value.HasMember(LATENCY_IN_MS) && !value[LATENCY_IN_MS].IsNull()) {
-        for (auto itr = value[LATENCY_IN_MS].MemberBegin(); itr != value[LATENCY_IN_MS].MemberEnd(); ++itr) {
-            if (itr->name.IsString() && itr->value.IsInt()) {
-                m_latencyInMs[itr->name.GetString()] = itr->value.GetInt();
-            }
-        }
-    }
-
-    return true;
-}
+bool WebSocketPlayer::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 } // namespace Internal
 } // namespace GameLift
 } // namespace Aws
\ No newline at end of file
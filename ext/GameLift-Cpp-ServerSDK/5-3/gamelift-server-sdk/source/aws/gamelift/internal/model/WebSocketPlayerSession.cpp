@@ -10,40 +10,46 @@
  */
 
 #include <aws/gamelift/internal/model/WebSocketPlayerSession.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 #include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketPlayerSession::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_ID, m_playerSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_ID, m_playerId);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, FLEET_ID, m_fleetId);
-    JsonHelper::WritePositiveLong(writer, CREATION_TIME, m_creationTime);
-    JsonHelper::WritePositiveLong(writer, TERMINATION_TIME, m_terminationTime);
-    JsonHelper::WriteNonEmptyString(writer, STATUS, WebSocketPlayerSessionStatusMapper::GetNameForStatus(m_status));
-    JsonHelper::WriteNonEmptyString(writer, IP_ADDRESS, m_ipAddress);
-    JsonHelper::WritePositiveInt(writer, PORT, m_port);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_DATA, m_playerData);
-    JsonHelper::WriteNonEmptyString(writer, DNS_NAME, m_dnsName);
-    return true;
+namespace {
+// The status is sent by name
+void WriteStatus(const WebSocketPlayerSession &playerSession, const char *key, rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+    JsonHelper::WriteNonEmptyString(writer, key, WebSocketPlayerSessionStatusMapper::GetNameForStatus(playerSession.GetStatus()));
 }
 
-bool WebSocketPlayerSession::Deserialize(const rapidjson::Value &value) {
-    m_playerSessionId = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_ID);
-    m_playerId = JsonHelper::SafelyDeserializeString(value, PLAYER_ID);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_fleetId = JsonHelper::SafelyDeserializeString(value, FLEET_ID);
-    m_creationTime = JsonHelper::SafelyDeserializeLong(value, CREATION_TIME);
-    m_terminationTime = JsonHelper::SafelyDeserializeLong(value, TERMINATION_TIME);
-    m_status = WebSocketPlayerSessionStatusMapper::GetStatusForName(JsonHelper::SafelyDeserializeString(value, STATUS));
-    m_ipAddress = JsonHelper::SafelyDeserializeString(value, IP_ADDRESS);
-    m_port = JsonHelper::SafelyDeserializeInt(value, PORT);
-    m_playerData = JsonHelper::SafelyDeserializeString(value, PLAYER_DATA);
-    m_dnsName = JsonHelper::SafelyDeserializeString(value, DNS_NAME);
-    return true;
+void ReadStatus(WebSocketPlayerSession &playerSession, const rapidjson::Value *value) {
+    playerSession.SetStatus(WebSocketPlayerSessionStatusMapper::GetStatusForName(
+        value != nullptr && value->IsString() ? std::string(value->GetString(), value->GetStringLength()) : std::string()));
 }
+} // namespace
+
+const JsonFieldTable<WebSocketPlayerSession> &WebSocketPlayerSession::GetJsonFields() {
+    typedef JsonField<WebSocketPlayerSession> Field;
+    static const Field fields[] = {
+        Field::String<&WebSocketPlayerSession::m_playerSessionId>(PLAYER_SESSION_ID),
+        Field::String<&WebSocketPlayerSession::m_playerId>(PLAYER_ID),
+        Field::String<&WebSocketPlayerSession::m_gameSessionId>(GAME_SESSION_ID),
+        Field::String<&WebSocketPlayerSession::m_fleetId>(FLEET_ID),
+        Field::Long<&WebSocketPlayerSession::m_creationTime>(CREATION_TIME),
+        Field::Long<&WebSocketPlayerSession::m_terminationTime>(TERMINATION_TIME),
+        Field(STATUS, &WriteStatus, &ReadStatus),
+        Field::String<&WebSocketPlayerSession::m_ipAddress>(IP_ADDRESS),
+        Field::Int<&WebSocketPlayerSession::m_port>(PORT),
+        Field::String<&WebSocketPlayerSession::m_playerData>(PLAYER_DATA),
+        Field::String<&WebSocketPlayerSession::m_dnsName>(DNS_NAME),
+    };
+    static const JsonFieldTable<WebSocketPlayerSession> table(fields);
+    return table;
+}
+
+bool WebSocketPlayerSession::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool WebSocketPlayerSession::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 } // namespace Internal
 } // namespace GameLift
 } // namespace Aws
\ No newline at end of file
@@ -0,0 +1,225 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/model/adapter/DescribePlayerSessionsDecoder.h>
+#include <climits>
+#include <cstring>
+#include <utility>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+DescribePlayerSessionsDecoder::DescribePlayerSessionsDecoder(Server::Model::DescribePlayerSessionsResult &result)
+    : m_result(result), m_playerSession(nullptr), m_depth(0), m_inPlayerSessions(false), m_field(Field::NONE) {}
+
+bool DescribePlayerSessionsDecoder::Null() {
+    m_field = Field::NONE;
+    return true;
+}
+
+bool DescribePlayerSessionsDecoder::Bool(bool) {
+    m_field = Field::NONE;
+    return true;
+}
+
+bool DescribePlayerSessionsDecoder::Int(int value) { return Integer(value); }
+
+bool DescribePlayerSessionsDecoder::Uint(unsigned value) { return Integer(value); }
+
+bool DescribePlayerSessionsDecoder::Int64(int64_t value) { return Integer(value); }
+
+bool DescribePlayerSessionsDecoder::Uint64(uint64_t value) {
+    // Values above INT64_MAX aren't representable, matching JsonHelper::SafelyDeserializeLong
+    if (value > static_cast<uint64_t>(INT64_MAX)) {
+        m_field = Field::NONE;
+        return true;
+    }
+    return Integer(static_cast<int64_t>(value));
+}
+
+bool DescribePlayerSessionsDecoder::Double(double) {
+    m_field = Field::NONE;
+    return true;
+}
+
+bool DescribePlayerSessionsDecoder::Integer(int64_t value) {
+    if (m_playerSession != nullptr && m_depth == PLAYER_SESSION_DEPTH) {
+        switch (m_field) {
+        case Field::CREATION_TIME:
+            m_playerSession->SetCreationTime(static_cast<long>(value));
+            break;
+        case Field::TERMINATION_TIME:
+            m_playerSession->SetTerminationTime(static_cast<long>(value));
+            break;
+        case Field::PORT:
+            if (value >= INT_MIN && value <= INT_MAX) {
+                m_playerSession->SetPort(static_cast<int>(value));
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    m_field = Field::NONE;
+    return true;
+}
+
+bool DescribePlayerSessionsDecoder::String(const char *value, rapidjson::SizeType length, bool) {
+    if (m_depth == RESPONSE_DEPTH && m_field == Field::NEXT_TOKEN) {
+        m_result.SetNextToken(value);
+    } else if (m_playerSession != nullptr && m_depth == PLAYER_SESSION_DEPTH) {
+        switch (m_field) {
+        case Field::PLAYER_SESSION_ID:
+            m_playerSession->SetPlayerSessionId(value);
+            break;
+        case Field::PLAYER_ID:
+            m_playerSession->SetPlayerId(value);
+            break;
+        case Field::GAME_SESSION_ID:
+            m_playerSession->SetGameSessionId(value);
+            break;
+        case Field::FLEET_ID:
+            m_playerSession->SetFleetId(value);
+            break;
+        case Field::STATUS:
+            m_playerSession->SetStatus(StatusForName(value, length));
+            break;
+        case Field::IP_ADDRESS:
+            m_playerSession->SetIpAddress(value);
+            break;
+        case Field::PLAYER_DATA:
+            m_playerSession->SetPlayerData(value);
+            break;
+        case Field::DNS_NAME:
+            m_playerSession->SetDnsName(value);
+            break;
+        default:
+            break;
+        }
+    }
+    m_field = Field::NONE;
+    return true;
+}
+
+bool DescribePlayerSessionsDecoder::StartObject() {
+    if (m_inPlayerSessions && m_depth == PLAYER_SESSIONS_DEPTH) {
+#ifdef GAMELIFT_USE_STD
+        m_playerSessions.emplace_back();
+        m_playerSession = &m_playerSessions.back();
+#else
+        m_currentPlayerSession = Server::Model::PlayerSession();
+        m_playerSession = &m_currentPlayerSession;
+#endif
+        // Missing numbers decode as -1, as they do through WebSocketPlayerSession
+        m_playerSession->SetCreationTime(-1);
+        m_playerSession->SetTerminationTime(-1);
+        m_playerSession->SetPort(-1);
+    }
+    m_field = Field::NONE;
+    m_depth++;
+    return true;
+}
+
+bool DescribePlayerSessionsDecoder::Key(const char *name, rapidjson::SizeType length, bool) {
+    m_field = Field::NONE;
+    if (m_depth == RESPONSE_DEPTH) {
+        if (NameEquals(name, length, NEXT_TOKEN)) {
+            m_field = Field::NEXT_TOKEN;
+        } else if (NameEquals(name, length, PLAYER_SESSIONS)) {
+            m_field = Field::PLAYER_SESSIONS;
+        }
+    } else if (m_playerSession != nullptr && m_depth == PLAYER_SESSION_DEPTH) {
+        if (NameEquals(name, length, PLAYER_SESSION_ID)) {
+            m_field = Field::PLAYER_SESSION_ID;
+        } else if (NameEquals(name, length, PLAYER_ID)) {
+            m_field = Field::PLAYER_ID;
+        } else if (NameEquals(name, length, GAME_SESSION_ID)) {
+            m_field = Field::GAME_SESSION_ID;
+        } else if (NameEquals(name, length, FLEET_ID)) {
+            m_field = Field::FLEET_ID;
+        } else if (NameEquals(name, length, CREATION_TIME)) {
+            m_field = Field::CREATION_TIME;
+        } else if (NameEquals(name, length, TERMINATION_TIME)) {
+            m_field = Field::TERMINATION_TIME;
+        } else if (NameEquals(name, length, STATUS)) {
+            m_field = Field::STATUS;
+        } else if (NameEquals(name, length, IP_ADDRESS)) {
+            m_field = Field::IP_ADDRESS;
+        } else if (NameEquals(name, length, PORT)) {
+            m_field = Field::PORT;
+        } else if (NameEquals(name, length, PLAYER_DATA)) {
+            m_field = Field::PLAYER_DATA;
+        } else if (NameEquals(name, length, DNS_NAME)) {
+            m_field = Field::DNS_NAME;
+        }
+    }
+    return true;
+}
+
+bool DescribePlayerSessionsDecoder::EndObject(rapidjson::SizeType) {
+    m_depth--;
+    if (m_playerSession != nullptr && m_depth == PLAYER_SESSIONS_DEPTH) {
+#ifndef GAMELIFT_USE_STD
+        m_result.AddPlayerSession(m_currentPlayerSession);
+#endif
+        m_playerSession = nullptr;
+    }
+    m_field = Field::NONE;
+    return true;
+}
+
+bool DescribePlayerSessionsDecoder::StartArray() {
+    if (m_depth == RESPONSE_DEPTH && m_field == Field::PLAYER_SESSIONS) {
+        m_inPlayerSessions = true;
+    }
+    m_field = Field::NONE;
+    m_depth++;
+    return true;
+}
+
+bool DescribePlayerSessionsDecoder::EndArray(rapidjson::SizeType) {
+    m_depth--;
+    if (m_inPlayerSessions && m_depth == RESPONSE_DEPTH) {
+        m_inPlayerSessions = false;
+#ifdef GAMELIFT_USE_STD
+        m_result.SetPlayerSessions(std::move(m_playerSessions));
+        m_playerSessions.clear();
+#endif
+    }
+    m_field = Field::NONE;
+    return true;
+}
+
+bool DescribePlayerSessionsDecoder::NameEquals(const char *name, rapidjson::SizeType length, const char *expected) {
+    return strlen(expected) == length && memcmp(name, expected, length) == 0;
+}
+
+Server::Model::PlayerSessionStatus DescribePlayerSessionsDecoder::StatusForName(const char *name, rapidjson::SizeType length) {
+    if (NameEquals(name, length, "RESERVED")) {
+        return Server::Model::PlayerSessionStatus::RESERVED;
+    }
+    if (NameEquals(name, length, "ACTIVE")) {
+        return Server::Model::PlayerSessionStatus::ACTIVE;
+    }
+    if (NameEquals(name, length, "COMPLETED")) {
+        return Server::Model::PlayerSessionStatus::COMPLETED;
+    }
+    if (NameEquals(name, length, "TIMEDOUT")) {
+        return Server::Model::PlayerSessionStatus::TIMEDOUT;
+    }
+    return Server::Model::PlayerSessionStatus::NOT_SET;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
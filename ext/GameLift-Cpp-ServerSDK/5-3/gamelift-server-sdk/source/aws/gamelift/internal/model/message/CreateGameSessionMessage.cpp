@@ -11,54 +11,32 @@
  */
 
 #include <aws/gamelift/internal/model/message/CreateGameSessionMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool CreateGameSessionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_NAME, m_gameSessionName);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_DATA, m_gameSessionData);
-    JsonHelper::WriteNonEmptyString(writer, MATCHMAKER_DATA, m_matchmakerData);
-    JsonHelper::WriteNonEmptyString(writer, DNS_NAME, m_dnsName);
-    JsonHelper::WriteNonEmptyString(writer, IP_ADDRESS, m_ipAddress);
-    JsonHelper::WritePositiveInt(writer, MAXIMUM_PLAYER_SESSION_COUNT, m_maximumPlayerSessionCount);
-    JsonHelper::WritePositiveInt(writer, PORT, m_port);
-
-    writer->String(GAME_PROPERTIES);
-    writer->StartObject();
-    for (auto const &property : m_gameProperties) {
-        writer->String(property.first.c_str());
-        writer->String(property.second.c_str());
-    }
-    writer->EndObject();
-    return true;
+const JsonFieldTable<CreateGameSessionMessage> &CreateGameSessionMessage::GetJsonFields() {
+    typedef JsonField<CreateGameSessionMessage> Field;
+    static const Field fields[] = {
+        Field::String<&CreateGameSessionMessage::m_gameSessionId>(GAME_SESSION_ID),
+        Field::String<&CreateGameSessionMessage::m_gameSessionName>(GAME_SESSION_NAME),
+        Field::String<&CreateGameSessionMessage::m_gameSessionData>(GAME_SESSION_DATA),
+        Field::String<&CreateGameSessionMessage::m_matchmakerData>(MATCHMAKER_DATA),
+        Field::String<&CreateGameSessionMessage::m_dnsName>(DNS_NAME),
+        Field::String<&CreateGameSessionMessage::m_ipAddress>(IP_ADDRESS),
+        Field::Int<&CreateGameSessionMessage::m_maximumPlayerSessionCount>(MAXIMUM_PLAYER_SESSION_COUNT),
+        Field::Int<&CreateGameSessionMessage::m_port>(PORT),
+        Field::StringMap<&CreateGameSessionMessage::m_gameProperties>(GAME_PROPERTIES),
+    };
+    static const JsonFieldTable<CreateGameSessionMessage> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool CreateGameSessionMessage::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_gameSessionName = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_NAME);
-    m_gameSessionData = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_DATA);
-    m_matchmakerData = JsonHelper::SafelyDeserializeString(value, MATCHMAKER_DATA);
-    m_dnsName = JsonHelper::SafelyDeserializeString(value, DNS_NAME);
-    m_ipAddress = JsonHelper::SafelyDeserializeString(value, IP_ADDRESS);
-    m_maximumPlayerSessionCount = JsonHelper::SafelyDeserializeInt(value, MAXIMUM_PLAYER_SESSION_COUNT);
-    m_port = JsonHelper::SafelyDeserializeInt(value, PORT);
-
-    if (value.HasMember(GAME_PROPERTIES) && !value[GAME_PROPERTIES].IsNull()) {
-        for (auto itr = value[GAME_PROPERTIES].MemberBegin(); itr != value[GAME_PROPERTIES].MemberEnd(); ++itr) {
-            if (itr->name.IsString() && itr->value.IsString()) {
-                m_gameProperties[itr->name.GetString()] = itr->value.GetString();
-            }
-        }
-    }
+bool CreateGameSessionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
 
-    return true;
-}
+bool CreateGameSessionMessage::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const CreateGameSessionMessage &createGameSessionMessage) {
     const Message *message = &createGameSessionMessage;
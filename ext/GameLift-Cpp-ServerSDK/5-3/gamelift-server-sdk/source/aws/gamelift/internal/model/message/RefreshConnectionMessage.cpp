@@ -11,24 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/message/RefreshConnectionMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool RefreshConnectionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, REFRESH_CONNECTION_ENDPOINT, m_refreshConnectionEndpoint);
-    JsonHelper::WriteNonEmptyString(writer, AUTH_TOKEN, m_authToken);
-    return true;
+const JsonFieldTable<RefreshConnectionMessage> &RefreshConnectionMessage::GetJsonFields() {
+    typedef JsonField<RefreshConnectionMessage> Field;
+    static const Field fields[] = {
+        Field::String<&RefreshConnectionMessage::m_refreshConnectionEndpoint>(REFRESH_CONNECTION_ENDPOINT),
+        Field::String<&RefreshConnectionMessage::m_authToken>(AUTH_TOKEN),
+    };
+    static const JsonFieldTable<RefreshConnectionMessage> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool RefreshConnectionMessage::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_refreshConnectionEndpoint = JsonHelper::SafelyDeserializeString(value, REFRESH_CONNECTION_ENDPOINT);
-    m_authToken = JsonHelper::SafelyDeserializeString(value, AUTH_TOKEN);
-    return true;
-}
+bool RefreshConnectionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool RefreshConnectionMessage::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const RefreshConnectionMessage &refreshConnectionMessage) {
     const Message *message = &refreshConnectionMessage;
@@ -11,23 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/message/TerminateProcessMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool TerminateProcessMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WritePositiveLong(writer, TERMINATION_TIME, m_terminationTime);
-    return true;
+const JsonFieldTable<TerminateProcessMessage> &TerminateProcessMessage::GetJsonFields() {
+    typedef JsonField<TerminateProcessMessage> Field;
+    static const Field fields[] = {
+        Field::Long<&TerminateProcessMessage::m_terminationTime>(TERMINATION_TIME),
+    };
+    static const JsonFieldTable<TerminateProcessMessage> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool TerminateProcessMessage::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_terminationTime = JsonHelper::SafelyDeserializeLong(value, TERMINATION_TIME);
-    return true;
-}
+bool TerminateProcessMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool TerminateProcessMessage::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const TerminateProcessMessage &terminateProcessMessage) {
     const Message *message = &terminateProcessMessage;
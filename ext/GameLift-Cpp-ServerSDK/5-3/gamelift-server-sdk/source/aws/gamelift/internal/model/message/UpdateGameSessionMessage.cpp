@@ -11,40 +11,26 @@
  */
 
 #include <aws/gamelift/internal/model/message/UpdateGameSessionMessage.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool UpdateGameSessionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    // Serialize game session object
-    writer->String(GAME_SESSION);
-    writer->StartObject();
-    m_gameSession.Serialize(writer);
-    writer->EndObject();
-    // Serialize update game session fields
-    JsonHelper::WriteNonEmptyString(writer, UPDATE_REASON, m_updateReason);
-    JsonHelper::WriteNonEmptyString(writer, BACKFILL_TICKET_ID, m_backfillTicketId);
-
-    return true;
+const JsonFieldTable<UpdateGameSessionMessage> &UpdateGameSessionMessage::GetJsonFields() {
+    typedef JsonField<UpdateGameSessionMessage> Field;
+    static const Field fields[] = {
+        Field::Object<WebSocketGameSession, &UpdateGameSessionMessage::m_gameSession>(GAME_SESSION),
+        Field::String<&UpdateGameSessionMessage::m_updateReason>(UPDATE_REASON),
+        Field::String<&UpdateGameSessionMessage::m_backfillTicketId>(BACKFILL_TICKET_ID),
+    };
+    static const JsonFieldTable<UpdateGameSessionMessage> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool UpdateGameSessionMessage::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    // Deserialize GameSession
-    WebSocketGameSession gameSession;
-    if (value.HasMember(GAME_SESSION) && !value[GAME_SESSION].IsNull()) {
-        gameSession.Deserialize(value[GAME_SESSION]);
-    }
-    m_gameSession = gameSession;
-    // Deserialize rest of fields
-    m_updateReason = JsonHelper::SafelyDeserializeString(value, UPDATE_REASON);
-    m_backfillTicketId = JsonHelper::SafelyDeserializeString(value, BACKFILL_TICKET_ID);
+bool UpdateGameSessionMessage::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
 
-    return true;
-}
+bool UpdateGameSessionMessage::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const UpdateGameSessionMessage &updateGameSessionMessage) {
     const Message *message = &updateGameSessionMessage;
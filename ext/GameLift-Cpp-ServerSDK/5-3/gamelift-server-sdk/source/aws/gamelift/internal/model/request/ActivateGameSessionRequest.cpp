@@ -11,7 +11,7 @@
  */
 
 #include <aws/gamelift/internal/model/request/ActivateGameSessionRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
@@ -21,17 +21,18 @@ ActivateGameSessionRequest::ActivateGameSessionRequest() { SetAction(ACTIVATE_GA
 
 ActivateGameSessionRequest::ActivateGameSessionRequest(std::string gameSessionId) : m_gameSessionId(gameSessionId) { SetAction(ACTIVATE_GAME_SESSION); }
 
-bool ActivateGameSessionRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    return true;
+const JsonFieldTable<ActivateGameSessionRequest> &ActivateGameSessionRequest::GetJsonFields() {
+    typedef JsonField<ActivateGameSessionRequest> Field;
+    static const Field fields[] = {
+        Field::String<&ActivateGameSessionRequest::m_gameSessionId>(GAME_SESSION_ID),
+    };
+    static const JsonFieldTable<ActivateGameSessionRequest> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool ActivateGameSessionRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    return true;
-}
+bool ActivateGameSessionRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool ActivateGameSessionRequest::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const ActivateGameSessionRequest &activateGameSessionRequest) {
     const Message *message = &activateGameSessionRequest;
@@ -11,7 +11,7 @@
  */
 
 #include <aws/gamelift/internal/model/request/ActivateServerProcessRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
@@ -25,23 +25,21 @@ ActivateServerProcessRequest::ActivateServerProcessRequest(std::string sdkVersio
     SetAction(ACTIVATE_SERVER_PROCESS);
 };
 
-bool ActivateServerProcessRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, SDK_VERSION, m_sdkVersion);
-    JsonHelper::WriteNonEmptyString(writer, SDK_LANGUAGE, m_sdkLanguage);
-    JsonHelper::WritePositiveInt(writer, PORT, m_port);
-    JsonHelper::WriteLogParameters(writer, LOG_PATHS, m_logParameters);
-    return true;
+const JsonFieldTable<ActivateServerProcessRequest> &ActivateServerProcessRequest::GetJsonFields() {
+    typedef JsonField<ActivateServerProcessRequest> Field;
+    static const Field fields[] = {
+        Field::String<&ActivateServerProcessRequest::m_sdkVersion>(SDK_VERSION),
+        Field::String<&ActivateServerProcessRequest::m_sdkLanguage>(SDK_LANGUAGE),
+        Field::Int<&ActivateServerProcessRequest::m_port>(PORT),
+        Field::LogPaths<&ActivateServerProcessRequest::m_logParameters>(LOG_PATHS),
+    };
+    static const JsonFieldTable<ActivateServerProcessRequest> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool ActivateServerProcessRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_sdkVersion = JsonHelper::SafelyDeserializeString(value, SDK_VERSION);
-    m_sdkLanguage = JsonHelper::SafelyDeserializeString(value, SDK_LANGUAGE);
-    m_port = JsonHelper::SafelyDeserializeInt(value, PORT);
-    m_logParameters = JsonHelper::SafelyDeserializeLogParameters(value, LOG_PATHS);
-    return true;
-}
+bool ActivateServerProcessRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool ActivateServerProcessRequest::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const ActivateServerProcessRequest &activateServerProcessRequest) {
     const Message *message = &activateServerProcessRequest;
@@ -11,23 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/request/HeartbeatServerProcessRequest.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool HeartbeatServerProcessRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    writer->String(HEALTH_STATUS);
-    writer->Bool(m_healthy);
-    return true;
+const JsonFieldTable<HeartbeatServerProcessRequest> &HeartbeatServerProcessRequest::GetJsonFields() {
+    typedef JsonField<HeartbeatServerProcessRequest> Field;
+    static const Field fields[] = {
+        Field::Bool<&HeartbeatServerProcessRequest::m_healthy>(HEALTH_STATUS),
+    };
+    static const JsonFieldTable<HeartbeatServerProcessRequest> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool HeartbeatServerProcessRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_healthy = value.HasMember(HEALTH_STATUS) && value[HEALTH_STATUS].IsBool() ? value[HEALTH_STATUS].GetBool() : false;
-    return true;
-}
+bool HeartbeatServerProcessRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool HeartbeatServerProcessRequest::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const HeartbeatServerProcessRequest &heartbeatServerProcessRequest) {
     const Message *message = &heartbeatServerProcessRequest;
@@ -11,24 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/request/RemovePlayerSessionRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool RemovePlayerSessionRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_ID, m_playerSessionId);
-    return true;
+const JsonFieldTable<RemovePlayerSessionRequest> &RemovePlayerSessionRequest::GetJsonFields() {
+    typedef JsonField<RemovePlayerSessionRequest> Field;
+    static const Field fields[] = {
+        Field::String<&RemovePlayerSessionRequest::m_gameSessionId>(GAME_SESSION_ID),
+        Field::String<&RemovePlayerSessionRequest::m_playerSessionId>(PLAYER_SESSION_ID),
+    };
+    static const JsonFieldTable<RemovePlayerSessionRequest> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool RemovePlayerSessionRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_playerSessionId = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_ID);
-    return true;
-}
+bool RemovePlayerSessionRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool RemovePlayerSessionRequest::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const RemovePlayerSessionRequest &removePlayerSessionRequest) {
     const Message *message = &removePlayerSessionRequest;
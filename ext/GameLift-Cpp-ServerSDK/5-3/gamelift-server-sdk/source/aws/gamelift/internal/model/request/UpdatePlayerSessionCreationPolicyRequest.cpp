@@ -11,26 +11,38 @@
  */
 
 #include <aws/gamelift/internal/model/request/UpdatePlayerSessionCreationPolicyRequest.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 #include <aws/gamelift/internal/util/JsonHelper.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool UpdatePlayerSessionCreationPolicyRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_POLICY, GetPlayerSessionCreationPolicyAsString());
-    return true;
+namespace {
+// The policy is sent by name
+void WritePlayerSessionPolicy(const UpdatePlayerSessionCreationPolicyRequest &request, const char *key,
+                              rapidjson::Writer<rapidjson::StringBuffer> *writer) {
+    JsonHelper::WriteNonEmptyString(writer, key, request.GetPlayerSessionCreationPolicyAsString());
 }
 
-bool UpdatePlayerSessionCreationPolicyRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    std::string policyAsString = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_POLICY);
-    SetPlayerSessionCreationPolicy(policyAsString);
-    return true;
+void ReadPlayerSessionPolicy(UpdatePlayerSessionCreationPolicyRequest &request, const rapidjson::Value *value) {
+    request.SetPlayerSessionCreationPolicy(value != nullptr && value->IsString() ? std::string(value->GetString(), value->GetStringLength()) : std::string());
 }
+} // namespace
+
+const JsonFieldTable<UpdatePlayerSessionCreationPolicyRequest> &UpdatePlayerSessionCreationPolicyRequest::GetJsonFields() {
+    typedef JsonField<UpdatePlayerSessionCreationPolicyRequest> Field;
+    static const Field fields[] = {
+        Field::String<&UpdatePlayerSessionCreationPolicyRequest::m_gameSessionId>(GAME_SESSION_ID),
+        Field(PLAYER_SESSION_POLICY, &WritePlayerSessionPolicy, &ReadPlayerSessionPolicy),
+    };
+    static const JsonFieldTable<UpdatePlayerSessionCreationPolicyRequest> table(fields, Message::GetJsonFields());
+    return table;
+}
+
+bool UpdatePlayerSessionCreationPolicyRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool UpdatePlayerSessionCreationPolicyRequest::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const UpdatePlayerSessionCreationPolicyRequest &updatePlayerSessionCreationPolicyRequest) {
     const Message *message = &updatePlayerSessionCreationPolicyRequest;
@@ -11,36 +11,28 @@
  */
 
 #include <aws/gamelift/internal/model/request/WebSocketDescribePlayerSessionsRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketDescribePlayerSessionsRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ID, m_gameSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_ID, m_playerId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_ID, m_playerSessionId);
-    JsonHelper::WriteNonEmptyString(writer, PLAYER_SESSION_STATUS_FILTER, m_playerSessionStatusFilter);
-    JsonHelper::WriteNonEmptyString(writer, NEXT_TOKEN, m_nextToken);
-    JsonHelper::WritePositiveInt(writer, LIMIT, m_limit);
-
-    return true;
+const JsonFieldTable<WebSocketDescribePlayerSessionsRequest> &WebSocketDescribePlayerSessionsRequest::GetJsonFields() {
+    typedef JsonField<WebSocketDescribePlayerSessionsRequest> Field;
+    static const Field fields[] = {
+        Field::String<&WebSocketDescribePlayerSessionsRequest::m_gameSessionId>(GAME_SESSION_ID),
+        Field::String<&WebSocketDescribePlayerSessionsRequest::m_playerId>(PLAYER_ID),
+        Field::String<&WebSocketDescribePlayerSessionsRequest::m_playerSessionId>(PLAYER_SESSION_ID),
+        Field::String<&WebSocketDescribePlayerSessionsRequest::m_playerSessionStatusFilter>(PLAYER_SESSION_STATUS_FILTER),
+        Field::String<&WebSocketDescribePlayerSessionsRequest::m_nextToken>(NEXT_TOKEN),
+        Field::Int<&WebSocketDescribePlayerSessionsRequest::m_limit>(LIMIT),
+    };
+    static const JsonFieldTable<WebSocketDescribePlayerSessionsRequest> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool WebSocketDescribePlayerSessionsRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
+bool WebSocketDescribePlayerSessionsRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
 
-    m_gameSessionId = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ID);
-    m_playerId = JsonHelper::SafelyDeserializeString(value, PLAYER_ID);
-    m_playerSessionId = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_ID);
-    m_playerSessionStatusFilter = JsonHelper::SafelyDeserializeString(value, PLAYER_SESSION_STATUS_FILTER);
-    m_nextToken = JsonHelper::SafelyDeserializeString(value, NEXT_TOKEN);
-    m_limit = JsonHelper::SafelyDeserializeInt(value, LIMIT);
-
-    return true;
-}
+bool WebSocketDescribePlayerSessionsRequest::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketDescribePlayerSessionsRequest &describePlayerSessionsRequest) {
     const Message *message = &describePlayerSessionsRequest;
@@ -11,28 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/request/WebSocketGetFleetRoleCredentialsRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketGetFleetRoleCredentialsRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-
-    JsonHelper::WriteNonEmptyString(writer, ROLE_ARN, m_roleArn);
-    JsonHelper::WriteNonEmptyString(writer, ROLE_SESSION_NAME, m_roleSessionName);
-
-    return true;
+const JsonFieldTable<WebSocketGetFleetRoleCredentialsRequest> &WebSocketGetFleetRoleCredentialsRequest::GetJsonFields() {
+    typedef JsonField<WebSocketGetFleetRoleCredentialsRequest> Field;
+    static const Field fields[] = {
+        Field::String<&WebSocketGetFleetRoleCredentialsRequest::m_roleArn>(ROLE_ARN),
+        Field::String<&WebSocketGetFleetRoleCredentialsRequest::m_roleSessionName>(ROLE_SESSION_NAME),
+    };
+    static const JsonFieldTable<WebSocketGetFleetRoleCredentialsRequest> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool WebSocketGetFleetRoleCredentialsRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
+bool WebSocketGetFleetRoleCredentialsRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
 
-    m_roleArn = JsonHelper::SafelyDeserializeString(value, ROLE_ARN);
-    m_roleSessionName = JsonHelper::SafelyDeserializeString(value, ROLE_SESSION_NAME);
-
-    return true;
-}
+bool WebSocketGetFleetRoleCredentialsRequest::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 } // namespace Internal
 } // namespace GameLift
 } // namespace Aws
\ No newline at end of file
@@ -11,7 +11,7 @@
  */
 
 #include <aws/gamelift/internal/model/request/WebSocketStartMatchBackfillRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
@@ -19,47 +19,21 @@ namespace Internal {
 
 WebSocketStartMatchBackfillRequest::WebSocketStartMatchBackfillRequest() { SetAction(ACTION); };
 
-bool WebSocketStartMatchBackfillRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-
-    JsonHelper::WriteNonEmptyString(writer, TICKET_ID, m_ticketId);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ARN, m_gameSessionArn);
-    JsonHelper::WriteNonEmptyString(writer, MATCHMAKING_CONFIGURATION_ARN, m_matchmakingConfigurationArn);
-
-    writer->String(PLAYERS);
-    writer->StartArray();
-    for (const WebSocketPlayer &player : m_players) {
-        writer->StartObject();
-        player.Serialize(writer);
-        writer->EndObject();
-    }
-    writer->EndArray();
-
-    return true;
+const JsonFieldTable<WebSocketStartMatchBackfillRequest> &WebSocketStartMatchBackfillRequest::GetJsonFields() {
+    typedef JsonField<WebSocketStartMatchBackfillRequest> Field;
+    static const Field fields[] = {
+        Field::String<&WebSocketStartMatchBackfillRequest::m_ticketId>(TICKET_ID),
+        Field::String<&WebSocketStartMatchBackfillRequest::m_gameSessionArn>(GAME_SESSION_ARN),
+        Field::String<&WebSocketStartMatchBackfillRequest::m_matchmakingConfigurationArn>(MATCHMAKING_CONFIGURATION_ARN),
+        Field::ObjectList<WebSocketPlayer, &WebSocketStartMatchBackfillRequest::m_players>(PLAYERS),
+    };
+    static const JsonFieldTable<WebSocketStartMatchBackfillRequest> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool WebSocketStartMatchBackfillRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
+bool WebSocketStartMatchBackfillRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
 
-    m_ticketId = JsonHelper::SafelyDeserializeString(value, TICKET_ID);
-    m_gameSessionArn = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ARN);
-    m_matchmakingConfigurationArn = JsonHelper::SafelyDeserializeString(value, MATCHMAKING_CONFIGURATION_ARN);
-
-    m_players.clear();
-    if (value.HasMember(PLAYERS) && !value[PLAYERS].IsNull()) {
-        auto playerList = value[PLAYERS].GetArray();
-        for (rapidjson::SizeType i = 0; i < playerList.Size(); i++) {
-            auto &player = playerList[i];
-            if (!player.IsNull()) {
-                WebSocketPlayer webSocketPlayer;
-                webSocketPlayer.Deserialize(player);
-                m_players.push_back(webSocketPlayer);
-            }
-        }
-    }
-
-    return true;
-}
+bool WebSocketStartMatchBackfillRequest::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketStartMatchBackfillRequest &startMatchBackfillRequest) {
     const Message *message = &startMatchBackfillRequest;
@@ -11,27 +11,26 @@
  */
 
 #include <aws/gamelift/internal/model/request/WebSocketStopMatchBackfillRequest.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-bool WebSocketStopMatchBackfillRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, GAME_SESSION_ARN, m_gameSessionArn);
-    JsonHelper::WriteNonEmptyString(writer, MATCHMAKING_CONFIG_ARN, m_matchmakingConfigurationArn);
-    JsonHelper::WriteNonEmptyString(writer, TICKET_ID, m_ticketId);
-    return true;
+const JsonFieldTable<WebSocketStopMatchBackfillRequest> &WebSocketStopMatchBackfillRequest::GetJsonFields() {
+    typedef JsonField<WebSocketStopMatchBackfillRequest> Field;
+    static const Field fields[] = {
+        Field::String<&WebSocketStopMatchBackfillRequest::m_gameSessionArn>(GAME_SESSION_ARN),
+        Field::String<&WebSocketStopMatchBackfillRequest::m_matchmakingConfigurationArn>(MATCHMAKING_CONFIG_ARN),
+        Field::String<&WebSocketStopMatchBackfillRequest::m_ticketId>(TICKET_ID),
+    };
+    static const JsonFieldTable<WebSocketStopMatchBackfillRequest> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool WebSocketStopMatchBackfillRequest::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_gameSessionArn = JsonHelper::SafelyDeserializeString(value, GAME_SESSION_ARN);
-    m_matchmakingConfigurationArn = JsonHelper::SafelyDeserializeString(value, MATCHMAKING_CONFIG_ARN);
-    m_ticketId = JsonHelper::SafelyDeserializeString(value, TICKET_ID);
-    return true;
-}
+bool WebSocketStopMatchBackfillRequest::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool WebSocketStopMatchBackfillRequest::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketStopMatchBackfillRequest &stopMatchBackfillMessage) {
     const Message *message = &stopMatchBackfillMessage;
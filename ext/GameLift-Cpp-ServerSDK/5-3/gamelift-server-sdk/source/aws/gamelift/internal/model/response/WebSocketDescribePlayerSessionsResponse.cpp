@@ -11,47 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/response/WebSocketDescribePlayerSessionsResponse.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketDescribePlayerSessionsResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-
-    JsonHelper::WriteNonEmptyString(writer, NEXT_TOKEN, m_nextToken);
-
-    writer->String(PLAYER_SESSIONS);
-    writer->StartArray();
-    for (const WebSocketPlayerSession &playerSession : m_playerSessions) {
-        writer->StartObject();
-        playerSession.Serialize(writer);
-        writer->EndObject();
-    }
-    writer->EndArray();
-
-    return true;
+const JsonFieldTable<WebSocketDescribePlayerSessionsResponse> &WebSocketDescribePlayerSessionsResponse::GetJsonFields() {
+    typedef JsonField<WebSocketDescribePlayerSessionsResponse> Field;
+    static const Field fields[] = {
+        Field::String<&WebSocketDescribePlayerSessionsResponse::m_nextToken>(NEXT_TOKEN),
+        Field::ObjectList<WebSocketPlayerSession, &WebSocketDescribePlayerSessionsResponse::m_playerSessions>(PLAYER_SESSIONS),
+    };
+    static const JsonFieldTable<WebSocketDescribePlayerSessionsResponse> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool WebSocketDescribePlayerSessionsResponse::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
+bool WebSocketDescribePlayerSessionsResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
 
-    m_nextToken = JsonHelper::SafelyDeserializeString(value, NEXT_TOKEN);
-    m_playerSessions.clear();
-    if (value.HasMember(PLAYER_SESSIONS) && !value[PLAYER_SESSIONS].IsNull()) {
-        auto playerSessions = value[PLAYER_SESSIONS].GetArray();
-        for (rapidjson::SizeType i = 0; i < playerSessions.Size(); i++) {
-            auto &playerSession = playerSessions[i];
-            if (!playerSession.IsNull()) {
-                WebSocketPlayerSession webSocketPlayerSession;
-                webSocketPlayerSession.Deserialize(playerSession);
-                m_playerSessions.push_back(webSocketPlayerSession);
-            }
-        }
-    }
-
-    return true;
-}
+bool WebSocketDescribePlayerSessionsResponse::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketDescribePlayerSessionsResponse &describePlayerSessionsResponse) {
     const Message *message = &describePlayerSessionsResponse;
@@ -11,28 +11,24 @@
  */
 
 #include <aws/gamelift/internal/model/response/WebSocketGetComputeCertificateResponse.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketGetComputeCertificateResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-
-    JsonHelper::WriteNonEmptyString(writer, COMPUTE_NAME, m_computeName);
-    JsonHelper::WriteNonEmptyString(writer, CERTIFICATE_PATH, m_certificatePath);
-
-    return true;
+const JsonFieldTable<WebSocketGetComputeCertificateResponse> &WebSocketGetComputeCertificateResponse::GetJsonFields() {
+    typedef JsonField<WebSocketGetComputeCertificateResponse> Field;
+    static const Field fields[] = {
+        Field::String<&WebSocketGetComputeCertificateResponse::m_computeName>(COMPUTE_NAME),
+        Field::String<&WebSocketGetComputeCertificateResponse::m_certificatePath>(CERTIFICATE_PATH),
+    };
+    static const JsonFieldTable<WebSocketGetComputeCertificateResponse> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool WebSocketGetComputeCertificateResponse::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
+bool WebSocketGetComputeCertificateResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
 
-    m_computeName = JsonHelper::SafelyDeserializeString(value, COMPUTE_NAME);
-    m_certificatePath = JsonHelper::SafelyDeserializeString(value, CERTIFICATE_PATH);
-
-    return true;
-}
+bool WebSocketGetComputeCertificateResponse::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketGetComputeCertificateResponse &webSocketGetComputeCertificateResponse) {
     const Message *message = &webSocketGetComputeCertificateResponse;
@@ -11,36 +11,28 @@
  */
 
 #include <aws/gamelift/internal/model/response/WebSocketGetFleetRoleCredentialsResponse.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketGetFleetRoleCredentialsResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-
-    JsonHelper::WriteNonEmptyString(writer, ASSUMED_ROLE_USER_ARN, m_assumedRoleUserArn);
-    JsonHelper::WriteNonEmptyString(writer, ASSUMED_ROLE_ID, m_assumedRoleId);
-    JsonHelper::WriteNonEmptyString(writer, ACCESS_KEY_ID, m_accessKeyId);
-    JsonHelper::WriteNonEmptyString(writer, SECRET_ACCESS_KEY, m_secretAccessKey);
-    JsonHelper::WriteNonEmptyString(writer, SESSION_TOKEN, m_sessionToken);
-    JsonHelper::WritePositiveLong(writer, EXPIRATION, m_expiration);
-
-    return true;
+const JsonFieldTable<WebSocketGetFleetRoleCredentialsResponse> &WebSocketGetFleetRoleCredentialsResponse::GetJsonFields() {
+    typedef JsonField<WebSocketGetFleetRoleCredentialsResponse> Field;
+    static const Field fields[] = {
+        Field::String<&WebSocketGetFleetRoleCredentialsResponse::m_assumedRoleUserArn>(ASSUMED_ROLE_USER_ARN),
+        Field::String<&WebSocketGetFleetRoleCredentialsResponse::m_assumedRoleId>(ASSUMED_ROLE_ID),
+        Field::String<&WebSocketGetFleetRoleCredentialsResponse::m_accessKeyId>(ACCESS_KEY_ID),
+        Field::String<&WebSocketGetFleetRoleCredentialsResponse::m_secretAccessKey>(SECRET_ACCESS_KEY),
+        Field::String<&WebSocketGetFleetRoleCredentialsResponse::m_sessionToken>(SESSION_TOKEN),
+        Field::Int64<&WebSocketGetFleetRoleCredentialsResponse::m_expiration>(EXPIRATION),
+    };
+    static const JsonFieldTable<WebSocketGetFleetRoleCredentialsResponse> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool WebSocketGetFleetRoleCredentialsResponse::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
+bool WebSocketGetFleetRoleCredentialsResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
 
-    m_assumedRoleUserArn = JsonHelper::SafelyDeserializeString(value, ASSUMED_ROLE_USER_ARN);
-    m_assumedRoleId = JsonHelper::SafelyDeserializeString(value, ASSUMED_ROLE_ID);
-    m_accessKeyId = JsonHelper::SafelyDeserializeString(value, ACCESS_KEY_ID);
-    m_secretAccessKey = JsonHelper::SafelyDeserializeString(value, SECRET_ACCESS_KEY);
-    m_sessionToken = JsonHelper::SafelyDeserializeString(value, SESSION_TOKEN);
-    m_expiration = JsonHelper::SafelyDeserializeLong(value, EXPIRATION);
-
-    return true;
-}
+bool WebSocketGetFleetRoleCredentialsResponse::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 } // namespace Internal
 } // namespace GameLift
 } // namespace Aws
\ No newline at end of file
@@ -11,22 +11,23 @@
  */
 
 #include <aws/gamelift/internal/model/response/WebSocketStartMatchBackfillResponse.h>
-#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <aws/gamelift/internal/util/JsonFieldTable.h>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-bool WebSocketStartMatchBackfillResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const {
-    Message::Serialize(writer);
-    JsonHelper::WriteNonEmptyString(writer, TICKET_ID, m_ticketId);
-    return true;
+const JsonFieldTable<WebSocketStartMatchBackfillResponse> &WebSocketStartMatchBackfillResponse::GetJsonFields() {
+    typedef JsonField<WebSocketStartMatchBackfillResponse> Field;
+    static const Field fields[] = {
+        Field::String<&WebSocketStartMatchBackfillResponse::m_ticketId>(TICKET_ID),
+    };
+    static const JsonFieldTable<WebSocketStartMatchBackfillResponse> table(fields, Message::GetJsonFields());
+    return table;
 }
 
-bool WebSocketStartMatchBackfillResponse::Deserialize(const rapidjson::Value &value) {
-    Message::Deserialize(value);
-    m_ticketId = JsonHelper::SafelyDeserializeString(value, TICKET_ID);
-    return true;
-}
+bool WebSocketStartMatchBackfillResponse::Serialize(rapidjson::Writer<rapidjson::StringBuffer> *writer) const { return GetJsonFields().Serialize(*this, writer); }
+
+bool WebSocketStartMatchBackfillResponse::Deserialize(const rapidjson::Value &value) { return GetJsonFields().Deserialize(*this, value); }
 
 std::ostream &operator<<(std::ostream &os, const WebSocketStartMatchBackfillResponse &startMatchBackfillResponse) {
     const Message *message = &startMatchBackfillResponse;
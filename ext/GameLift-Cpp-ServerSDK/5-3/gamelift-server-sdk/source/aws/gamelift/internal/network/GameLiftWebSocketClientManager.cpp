@@ -14,18 +14,86 @@
 #include <aws/gamelift/internal/network/GameLiftWebSocketClientManager.h>
 
 #include <aws/gamelift/internal/retry/JitteredGeometricBackoffRetryStrategy.h>
-#include <aws/gamelift/internal/retry/RetryingCallable.h>
+#include <aws/gamelift/internal/util/JsonHelper.h>
 
 #include <aws/gamelift/internal/model/response/WebSocketDescribePlayerSessionsResponse.h>
 
+#include <algorithm>
+#include <atomic>
+
 using namespace Aws::GameLift;
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
+constexpr const int GameLiftWebSocketClientManager::POLL_BUDGET_MICROS;
+constexpr const int GameLiftWebSocketClientManager::POLL_WAIT_MILLIS;
+constexpr const int GameLiftWebSocketClientManager::OFFLINE_QUEUE_MAX_WAIT_MILLIS;
+
+GameLiftWebSocketClientManager::GameLiftWebSocketClientManager(std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper,
+                                                               std::shared_ptr<TimerScheduler> timerScheduler)
+    : m_webSocketClientWrapper(webSocketClientWrapper), m_timerScheduler(timerScheduler), m_offlineQueue(std::make_shared<OfflineQueue>()) {
+    if (!m_timerScheduler) {
+        m_timerScheduler = std::make_shared<TimerScheduler>();
+        m_timerScheduler->Start();
+    }
+    m_webSocketClientWrapper->SetTimerScheduler(m_timerScheduler);
+    m_outboundScheduler = std::make_shared<OutboundScheduler>(m_timerScheduler);
+    // The scheduler's timers can outlive the manager, so they only hold on to the wrapper weakly
+    std::weak_ptr<IWebSocketClientWrapper> bufferedWebSocketClientWrapper = m_webSocketClientWrapper;
+    m_outboundScheduler->SetBufferedAmount([bufferedWebSocketClientWrapper] {
+        std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper = bufferedWebSocketClientWrapper.lock();
+        return webSocketClientWrapper ? webSocketClientWrapper->GetBufferedAmount() : static_cast<std::size_t>(0);
+    });
+    m_retryBudget = std::make_shared<RetryBudget>();
+    m_circuitBreaker = std::make_shared<CircuitBreaker>();
+    m_latencyEstimator = std::make_shared<LatencyEstimator>();
+    m_webSocketClientWrapper->SetLatencyEstimator(m_latencyEstimator);
+
+    // The wrapper owns this handler, so it only holds on to the wrapper and the messages it writes weakly
+    std::shared_ptr<OfflineQueue> offlineQueue = m_offlineQueue;
+    std::weak_ptr<IWebSocketClientWrapper> weakWebSocketClientWrapper = m_webSocketClientWrapper;
+    std::weak_ptr<OutboundScheduler> weakOutboundScheduler = m_outboundScheduler;
+    SendContext sendContext = GetSendContext();
+    sendContext.outboundScheduler = nullptr;
+    m_webSocketClientWrapper->SetConnectedHandler([offlineQueue, weakWebSocketClientWrapper, weakOutboundScheduler, sendContext] {
+        std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper = weakWebSocketClientWrapper.lock();
+        SendContext connectedSendContext = sendContext;
+        connectedSendContext.outboundScheduler = weakOutboundScheduler.lock();
+        if (webSocketClientWrapper && connectedSendContext.outboundScheduler) {
+            FlushOfflineQueue(offlineQueue, webSocketClientWrapper, connectedSendContext);
+        }
+    });
+}
+
+GameLiftWebSocketClientManager::~GameLiftWebSocketClientManager() {
+    std::deque<QueuedMessage> messages;
+    {
+        std::lock_guard<std::mutex> lock(m_offlineQueue->lock);
+        messages.swap(m_offlineQueue->messages);
+        m_offlineQueue->bytes = 0;
+    }
+    for (const QueuedMessage &message : messages) {
+        m_timerScheduler->Cancel(message.expiryTimer);
+        message.callback(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+    }
+}
+
 GenericOutcome GameLiftWebSocketClientManager::Connect(std::string websocketUrl, const std::string &authToken, const std::string &processId,
                                                        const std::string &hostId, const std::string &fleetId) {
+    // delegate to the websocket client wrapper to connect
+    return m_webSocketClientWrapper->Connect(BuildUri(websocketUrl, authToken, processId, hostId, fleetId));
+}
+
+void GameLiftWebSocketClientManager::ConnectAsync(std::string websocketUrl, const std::string &authToken, const std::string &processId,
+                                                  const std::string &hostId, const std::string &fleetId,
+                                                  const std::function<void(const GenericOutcome &)> &callback) {
+    m_webSocketClientWrapper->ConnectAsync(BuildUri(websocketUrl, authToken, processId, hostId, fleetId), callback);
+}
+
+Uri GameLiftWebSocketClientManager::BuildUri(std::string websocketUrl, const std::string &authToken, const std::string &processId,
+                                             const std::string &hostId, const std::string &fleetId) {
     printf("Connecting to GameLift WebSocket server. websocketUrl: %s, processId: %s, hostId: %s, fleetId: %s\n",
            websocketUrl.c_str(), processId.c_str(), hostId.c_str(), fleetId.c_str());
 
@@ -37,43 +105,405 @@ GenericOutcome GameLiftWebSocketClientManager::Connect(std::string websocketUrl,
 
     // Build the WebSocket URI
     std::string sdkVersion = Server::GetSdkVersion().GetResult();
-    Uri uri = Uri::UriBuilder()
-                  .WithBaseUri(websocketUrl)
-                  .AddQueryParam(PID_KEY, processId)
-                  .AddQueryParam(SDK_VERSION_KEY, sdkVersion)
-                  .AddQueryParam(FLAVOR_KEY, GameLiftServerState::LANGUAGE)
-                  .AddQueryParam(AUTH_TOKEN_KEY, authToken)
-                  .AddQueryParam(COMPUTE_ID_KEY, hostId)
-                  .AddQueryParam(FLEET_ID_KEY, fleetId)
-                  .Build();
+    return Uri::UriBuilder()
+        .WithBaseUri(websocketUrl)
+        .AddQueryParam(PID_KEY, processId)
+        .AddQueryParam(SDK_VERSION_KEY, sdkVersion)
+        .AddQueryParam(FLAVOR_KEY, GameLiftServerState::LANGUAGE)
+        .AddQueryParam(AUTH_TOKEN_KEY, authToken)
+        .AddQueryParam(COMPUTE_ID_KEY, hostId)
+        .AddQueryParam(FLEET_ID_KEY, fleetId)
+        .Build();
+}
 
-    // delegate to the websocket client wrapper to connect
-    return m_webSocketClientWrapper->Connect(uri);
+GenericOutcome GameLiftWebSocketClientManager::SendSocketMessage(Message &message, std::chrono::milliseconds timeout) {
+    // Block on the asynchronous path, so backoff between retries is a timer rather than a sleeping caller
+    std::shared_ptr<std::promise<GenericOutcome>> responsePromise = std::make_shared<std::promise<GenericOutcome>>();
+    std::future<GenericOutcome> responseFuture = responsePromise->get_future();
+    SendSocketMessageAsync(message, [responsePromise](const GenericOutcome &outcome) { responsePromise->set_value(outcome); }, timeout);
+    if (!m_pollDriven) {
+        return responseFuture.get();
+    }
+
+    // Nothing else runs the socket or the retry and deadline timers the response depends on, so run them from the
+    // waiting thread. A Poll on another thread may complete it too, in which case the wait returns early.
+    while (responseFuture.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready) {
+        m_webSocketClientWrapper->Poll(std::chrono::microseconds(POLL_BUDGET_MICROS));
+        m_timerScheduler->RunDueTimers(std::chrono::steady_clock::now());
+        responseFuture.wait_for(std::chrono::milliseconds(POLL_WAIT_MILLIS));
+    }
+    return responseFuture.get();
 }
 
-GenericOutcome GameLiftWebSocketClientManager::SendSocketMessage(Message &message) {
-    // Serialize the message
-    std::string jsonMessage = message.Serialize();
+void GameLiftWebSocketClientManager::SendSocketMessageAsync(Message &message, const SocketMessageCallback &callback, std::chrono::milliseconds timeout) {
+    // Serialize the message into this thread's buffer. Retries can outlive this call, so they send a copy.
+    rapidjson::StringBuffer &jsonBuffer = JsonHelper::GetThreadLocalBuffer();
+    message.SerializeTo(jsonBuffer);
+    std::shared_ptr<const std::string> jsonMessage = std::make_shared<const std::string>(jsonBuffer.GetString(), jsonBuffer.GetSize());
+    const std::string requestId = message.GetRequestId();
 
-    GenericOutcome outcome;
-    // Delegate to the websocketClientWrapper to send the request and retry if possible
-    const std::function<bool(void)> &retriable = [&] {
-        outcome = m_webSocketClientWrapper->SendSocketMessage(message.GetRequestId(), jsonMessage);
-        return outcome.IsSuccess() || outcome.GetError().GetErrorType() != GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE;
-    };
+    const ReplayPolicy replayPolicy = GetReplayPolicy(message.GetAction());
+    if (replayPolicy != ReplayPolicy::NONE) {
+        // Anything still queued, or still being flushed, goes out first, so messages are never reordered. A queued
+        // message is completed once: by its response, by being dropped, or by its deadline passing.
+        std::shared_ptr<std::atomic<bool>> completed = std::make_shared<std::atomic<bool>>(false);
+        const SocketMessageCallback complete = [completed, callback](const GenericOutcome &outcome) {
+            if (!completed->exchange(true)) {
+                callback(outcome);
+            }
+        };
+        const std::chrono::milliseconds maxWait =
+            timeout > std::chrono::milliseconds::zero() ? timeout : std::chrono::milliseconds(OFFLINE_QUEUE_MAX_WAIT_MILLIS);
+        bool connected = false;
+        bool queued = false;
+        bool accepted = false;
+        QueuedMessage replacedMessage{};
+        {
+            std::lock_guard<std::mutex> lock(m_offlineQueue->lock);
+            connected = m_webSocketClientWrapper->IsConnected();
+            if (!connected || m_offlineQueue->flushing || !m_offlineQueue->messages.empty()) {
+                queued = true;
+                QueuedMessage queuedMessage{requestId, message.GetAction(), jsonMessage, complete, std::chrono::steady_clock::now() + maxWait,
+                                            TimerScheduler::INVALID_TIMER_ID};
+                queuedMessage.expiryTimer = ScheduleExpiry(*m_timerScheduler, m_offlineQueue, queuedMessage);
+                const TimerScheduler::TimerId expiryTimer = queuedMessage.expiryTimer;
+                accepted = Enqueue(*m_offlineQueue, std::move(queuedMessage), replayPolicy == ReplayPolicy::REPLAY_LATEST, replacedMessage);
+                if (!accepted) {
+                    m_timerScheduler->Cancel(expiryTimer);
+                }
+            }
+        }
+        if (queued) {
+            if (replacedMessage.callback) {
+                m_timerScheduler->Cancel(replacedMessage.expiryTimer);
+                replacedMessage.callback(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+            }
+            if (!accepted) {
+                printf("Offline message queue is full, %s request not sent.\n", message.GetAction().c_str());
+                complete(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+            }
+            if (connected) {
+                FlushOfflineQueue(m_offlineQueue, m_webSocketClientWrapper, GetSendContext());
+            }
+            return;
+        }
+    }
+
+    // A hedge is a copy of the request under its own request ID, so both responses can be told apart
+    std::string hedgeRequestId;
+    std::shared_ptr<const std::string> hedgeJsonMessage;
+    if (IsHedged(message.GetAction())) {
+        hedgeRequestId = Message::GenerateRequestId();
+        message.SetRequestId(hedgeRequestId);
+        message.SerializeTo(jsonBuffer);
+        hedgeJsonMessage = std::make_shared<const std::string>(jsonBuffer.GetString(), jsonBuffer.GetSize());
+        message.SetRequestId(requestId);
+    }
+
+    const std::chrono::steady_clock::time_point deadline =
+        timeout > std::chrono::milliseconds::zero() ? std::chrono::steady_clock::now() + timeout : std::chrono::steady_clock::time_point::max();
+    SendWithRetries(m_webSocketClientWrapper, GetSendContext(), message.GetAction(), requestId, jsonMessage, deadline, callback, hedgeRequestId,
+                    hedgeJsonMessage);
+}
+
+GameLiftWebSocketClientManager::ReplayPolicy GameLiftWebSocketClientManager::GetReplayPolicy(const std::string &action) {
+    // Each of these either carries the full state it reports, or is idempotent, so sending it late is harmless
+    if (action == HEARTBEAT_SERVER_PROCESS) {
+        return ReplayPolicy::REPLAY_LATEST;
+    }
+    if (action == REMOVE_PLAYER_SESSION || action == UPDATE_PLAYER_SESSION_CREATION_POLICY) {
+        return ReplayPolicy::REPLAY;
+    }
+    return ReplayPolicy::NONE;
+}
+
+OutboundScheduler::Priority GameLiftWebSocketClientManager::GetPriority(const std::string &action) {
+    // Keeping the process and its game session alive comes first, then letting players in and out
+    if (action == HEARTBEAT_SERVER_PROCESS || action == ACTIVATE_SERVER_PROCESS || action == TERMINATE_SERVER_PROCESS || action == ACTIVATE_GAME_SESSION) {
+        return OutboundScheduler::Priority::CONTROL;
+    }
+    if (action == DESCRIBE_PLAYER_SESSIONS || action == START_MATCH_BACKFILL || action == STOP_MATCH_BACKFILL) {
+        return OutboundScheduler::Priority::BULK;
+    }
+    // Player admission, and the occasional certificate or credentials request
+    return OutboundScheduler::Priority::PLAYER_ADMISSION;
+}
 
-    // Jittered retry required because many requests can cause buffer to fill.
-    // If retries all happpen in sync, it can cause potential delays in recovery.
-    JitteredGeometricBackoffRetryStrategy retryStrategy;
-    RetryingCallable callable = RetryingCallable::Builder().WithRetryStrategy(&retryStrategy).WithCallable(retriable).Build();
+bool GameLiftWebSocketClientManager::IsHedged(const std::string &action) {
+    // Reads that change nothing on the service, so sending one twice costs only the extra load
+    return action == DESCRIBE_PLAYER_SESSIONS || action == GET_COMPUTE_CERTIFICATE || action == GET_FLEET_ROLE_CREDENTIALS;
+}
 
-    callable.call();
+RetryStrategy::AttemptResult GameLiftWebSocketClientManager::ToAttemptResult(const GenericOutcome &outcome) {
+    if (outcome.IsSuccess()) {
+        return RetryStrategy::AttemptResult::ANSWERED;
+    }
+    switch (outcome.GetError().GetErrorType()) {
+    case GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE:
+        // No response in time, or no room to send it yet
+        return RetryStrategy::AttemptResult::FAILED_RETRIABLE;
+    case GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION:
+        // A 5xx response
+        return RetryStrategy::AttemptResult::FAILED;
+    case GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE:
+    case GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_TIMEOUT:
+        // Shed or refused by the outbound scheduler, not written to the socket, or out of time before it went out
+        return RetryStrategy::AttemptResult::NOT_SENT;
+    default:
+        // The service turned the request down, which is still an answer
+        return RetryStrategy::AttemptResult::ANSWERED;
+    }
+}
 
-    if (outcome.GetError() == GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE) {
-        outcome = GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE);
+GameLiftWebSocketClientManager::RequestPolicy GameLiftWebSocketClientManager::GetRequestPolicy(const std::string &action) {
+    if (action == ACCEPT_PLAYER_SESSION || action == REMOVE_PLAYER_SESSION || action == UPDATE_PLAYER_SESSION_CREATION_POLICY) {
+        return RequestPolicy{PLAYER_ADMISSION_TIMEOUT_MILLIS, PLAYER_ADMISSION_MAX_RETRIES};
     }
+    if (action == HEARTBEAT_SERVER_PROCESS) {
+        return RequestPolicy{HEARTBEAT_TIMEOUT_MILLIS, HEARTBEAT_MAX_RETRIES};
+    }
+    if (action == DESCRIBE_PLAYER_SESSIONS || action == START_MATCH_BACKFILL || action == STOP_MATCH_BACKFILL) {
+        return RequestPolicy{BULK_TIMEOUT_MILLIS, BULK_MAX_RETRIES};
+    }
+    // Process and game session lifecycle, certificates and credentials: rare, and worth waiting for
+    return RequestPolicy{DEFAULT_TIMEOUT_MILLIS, DEFAULT_MAX_RETRIES};
+}
+
+bool GameLiftWebSocketClientManager::Enqueue(OfflineQueue &offlineQueue, QueuedMessage &&message, bool replaceQueued,
+                                             QueuedMessage &replacedMessage) {
+    const std::size_t messageBytes = message.requestId.size() + message.action.size() + message.jsonMessage->size();
+    if (replaceQueued) {
+        for (QueuedMessage &queuedMessage : offlineQueue.messages) {
+            if (queuedMessage.action == message.action) {
+                const std::size_t queuedBytes = queuedMessage.requestId.size() + queuedMessage.action.size() + queuedMessage.jsonMessage->size();
+                offlineQueue.bytes = offlineQueue.bytes - queuedBytes + messageBytes;
+                replacedMessage = std::move(queuedMessage);
+                queuedMessage = std::move(message);
+                return true;
+            }
+        }
+    }
+    if (offlineQueue.bytes + messageBytes > OFFLINE_QUEUE_MAX_BYTES) {
+        return false;
+    }
+    offlineQueue.bytes += messageBytes;
+    offlineQueue.messages.push_back(std::move(message));
+    return true;
+}
+
+bool GameLiftWebSocketClientManager::Dequeue(OfflineQueue &offlineQueue, const std::string &requestId) {
+    std::lock_guard<std::mutex> lock(offlineQueue.lock);
+    for (std::deque<QueuedMessage>::iterator queuedMessage = offlineQueue.messages.begin(); queuedMessage != offlineQueue.messages.end(); ++queuedMessage) {
+        if (queuedMessage->requestId == requestId) {
+            offlineQueue.bytes -= queuedMessage->requestId.size() + queuedMessage->action.size() + queuedMessage->jsonMessage->size();
+            offlineQueue.messages.erase(queuedMessage);
+            return true;
+        }
+    }
+    return false;
+}
+
+TimerScheduler::TimerId GameLiftWebSocketClientManager::ScheduleExpiry(TimerScheduler &timerScheduler, const std::shared_ptr<OfflineQueue> &offlineQueue,
+                                                                       const QueuedMessage &message) {
+    const std::chrono::milliseconds remaining =
+        std::chrono::duration_cast<std::chrono::milliseconds>(message.deadline - std::chrono::steady_clock::now());
+    const std::string requestId = message.requestId;
+    const SocketMessageCallback callback = message.callback;
+    return timerScheduler.Schedule(std::max(remaining, std::chrono::milliseconds::zero()), [offlineQueue, requestId, callback] {
+        if (Dequeue(*offlineQueue, requestId)) {
+            callback(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_TIMEOUT));
+        }
+    });
+}
+
+void GameLiftWebSocketClientManager::FlushOfflineQueue(const std::shared_ptr<OfflineQueue> &offlineQueue,
+                                                       const std::shared_ptr<IWebSocketClientWrapper> &webSocketClientWrapper,
+                                                       const SendContext &sendContext) {
+    {
+        std::lock_guard<std::mutex> lock(offlineQueue->lock);
+        // Whoever is flushing already sends anything queued meanwhile
+        if (offlineQueue->flushing) {
+            return;
+        }
+        offlineQueue->flushing = true;
+    }
+
+    std::weak_ptr<IWebSocketClientWrapper> weakWebSocketClientWrapper = webSocketClientWrapper;
+    for (;;) {
+        std::deque<QueuedMessage> messages;
+        {
+            std::lock_guard<std::mutex> lock(offlineQueue->lock);
+            // If the connection has dropped again, what is left waits for the flush once it is back
+            if (offlineQueue->messages.empty() || !webSocketClientWrapper->IsConnected()) {
+                offlineQueue->flushing = false;
+                return;
+            }
+            messages.swap(offlineQueue->messages);
+            offlineQueue->bytes = 0;
+        }
+
+        for (const QueuedMessage &message : messages) {
+            // Taken off the queue, so its deadline now bounds the send instead
+            sendContext.timerScheduler->Cancel(message.expiryTimer);
+            const bool replaceQueued = GetReplayPolicy(message.action) == ReplayPolicy::REPLAY_LATEST;
+            const std::shared_ptr<TimerScheduler> timerScheduler = sendContext.timerScheduler;
+            SendWithRetries(webSocketClientWrapper, sendContext, message.action, message.requestId, message.jsonMessage, message.deadline,
+                            [offlineQueue, weakWebSocketClientWrapper, timerScheduler, message, replaceQueued](const GenericOutcome &outcome) {
+                if (outcome.IsSuccess() || outcome.GetError().GetErrorType() != GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE) {
+                    message.callback(outcome);
+                    return;
+                }
+                // Disconnected again before it went out, so queue it for the next flush. A heartbeat is left to the
+                // next one instead.
+                bool requeued = false;
+                if (!replaceQueued) {
+                    std::shared_ptr<IWebSocketClientWrapper> webSocketClientWrapper = weakWebSocketClientWrapper.lock();
+                    QueuedMessage replacedMessage{};
+                    std::lock_guard<std::mutex> lock(offlineQueue->lock);
+                    if (webSocketClientWrapper && !webSocketClientWrapper->IsConnected() && std::chrono::steady_clock::now() < message.deadline) {
+                        QueuedMessage requeuedMessage(message);
+                        requeuedMessage.expiryTimer = ScheduleExpiry(*timerScheduler, offlineQueue, requeuedMessage);
+                        const TimerScheduler::TimerId expiryTimer = requeuedMessage.expiryTimer;
+                        requeued = Enqueue(*offlineQueue, std::move(requeuedMessage), false, replacedMessage);
+                        if (!requeued) {
+                            timerScheduler->Cancel(expiryTimer);
+                        }
+                    }
+                }
+                if (!requeued) {
+                    printf("Queued %s request could not be sent.\n", message.action.c_str());
+                    message.callback(outcome);
+                }
+            });
+        }
+    }
+}
+
+void GameLiftWebSocketClientManager::SendWithRetries(const std::shared_ptr<IWebSocketClientWrapper> &webSocketClientWrapper,
+                                                     const SendContext &sendContext, const std::string &action, const std::string &requestId,
+                                                     const std::shared_ptr<const std::string> &jsonMessage, std::chrono::steady_clock::time_point deadline,
+                                                     const SocketMessageCallback &callback, const std::string &hedgeRequestId,
+                                                     const std::shared_ptr<const std::string> &hedgeJsonMessage) {
+    TimerScheduler &timerScheduler = *sendContext.timerScheduler;
+    const std::shared_ptr<OutboundScheduler> outboundScheduler = sendContext.outboundScheduler;
+    const std::shared_ptr<RetryBudget> retryBudget = sendContext.retryBudget;
+    const std::shared_ptr<LatencyEstimator> latencyEstimator = sendContext.latencyEstimator;
+    const RequestPolicy policy = GetRequestPolicy(action);
+    const bool hasDeadline = deadline != std::chrono::steady_clock::time_point::max();
+
+    // The caller is completed exactly once: by the last attempt, or by the deadline timer if that fires first
+    std::shared_ptr<std::atomic<bool>> completed = std::make_shared<std::atomic<bool>>(false);
+    const SocketMessageCallback complete = [completed, callback](const GenericOutcome &outcome) {
+        if (!completed->exchange(true)) {
+            callback(outcome);
+        }
+    };
+    TimerScheduler::TimerId deadlineTimer = TimerScheduler::INVALID_TIMER_ID;
+    if (hasDeadline) {
+        // An attempt still waiting for a reconnect is withdrawn, so a request the caller was told timed out isn't sent later
+        deadlineTimer = timerScheduler.Schedule(std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()),
+                                                [complete, webSocketClientWrapper, requestId, hedgeRequestId] {
+                                                    complete(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_TIMEOUT));
+                                                    webSocketClientWrapper->CancelSend(requestId);
+                                                    if (!hedgeRequestId.empty()) {
+                                                        webSocketClientWrapper->CancelSend(hedgeRequestId);
+                                                    }
+                                                });
+    }
+
+    // Every attempt waits its turn in the outbound scheduler, which also holds it back while the socket's buffers are full.
+    // An attempt waits for its response only as long as the action's responses have been taking, and never past the deadline,
+    // so a late one frees its slot as the caller gives up. One that times out is recorded at its timeout, so a service that
+    // has slowed past it lifts the timeouts of the attempts after it.
+    const OutboundScheduler::Priority priority = GetPriority(action);
+    const auto writeOf = [webSocketClientWrapper, latencyEstimator, action, policy, deadline,
+                          hasDeadline](const std::string &attemptRequestId, const std::shared_ptr<const std::string> &attemptJsonMessage) {
+        return OutboundScheduler::Write([webSocketClientWrapper, latencyEstimator, action, policy, deadline, hasDeadline, attemptRequestId,
+                                         attemptJsonMessage](const OutboundScheduler::WriteCallback &writeComplete) {
+            std::chrono::milliseconds timeout = latencyEstimator->GetTimeout(action, std::chrono::milliseconds(policy.attemptTimeoutMillis));
+            if (hasDeadline) {
+                const std::chrono::steady_clock::duration remaining = deadline - std::chrono::steady_clock::now();
+                if (remaining <= std::chrono::steady_clock::duration::zero()) {
+                    writeComplete(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_TIMEOUT));
+                    return;
+                }
+                timeout = std::min(timeout, std::chrono::duration_cast<std::chrono::milliseconds>(remaining) + std::chrono::milliseconds(1));
+            }
+            const std::chrono::steady_clock::time_point sentAt = std::chrono::steady_clock::now();
+            webSocketClientWrapper->SendSocketMessageAsync(
+                attemptRequestId, attemptJsonMessage->c_str(), attemptJsonMessage->length(), timeout,
+                [latencyEstimator, action, timeout, sentAt, writeComplete](const GenericOutcome &outcome) {
+                    if (!outcome.IsSuccess() && outcome.GetError().GetErrorType() == GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE &&
+                        std::chrono::steady_clock::now() - sentAt >= timeout) {
+                        latencyEstimator->Record(action, timeout);
+                    }
+                    writeComplete(outcome);
+                });
+        });
+    };
+    const OutboundScheduler::Write write = writeOf(requestId, jsonMessage);
+    const OutboundScheduler::Write hedgeWrite = hedgeJsonMessage ? writeOf(hedgeRequestId, hedgeJsonMessage) : OutboundScheduler::Write();
+    const std::size_t hedgeLength = hedgeJsonMessage ? hedgeJsonMessage->length() : 0;
+
+    // Stands if the circuit breaker turns away the first attempt
+    std::shared_ptr<GenericOutcome> lastOutcome = std::make_shared<GenericOutcome>(
+        GameLiftError(GAMELIFT_ERROR_TYPE::SERVICE_CALL_FAILED, "GameLift service calls are failing, request not sent until they recover."));
+    TimerScheduler *scheduler = &timerScheduler;
+    const RetryStrategy::AsyncCallable sendAttempt = [outboundScheduler, retryBudget, latencyEstimator, action, priority, write, hedgeWrite, hedgeLength,
+                                                      jsonMessage, lastOutcome, deadline,
+                                                      scheduler](const std::function<void(RetryStrategy::AttemptResult)> &attemptComplete) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            *lastOutcome = GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_TIMEOUT);
+            attemptComplete(RetryStrategy::AttemptResult::NOT_SENT);
+            return;
+        }
+        std::shared_ptr<HedgedAttempt> attempt = std::make_shared<HedgedAttempt>();
+        const OutboundScheduler::WriteCallback onOutcome = [attempt, lastOutcome, attemptComplete](const GenericOutcome &outcome) {
+            const RetryStrategy::AttemptResult result = ToAttemptResult(outcome);
+            {
+                std::lock_guard<std::mutex> lock(attempt->lock);
+                if (attempt->done || (result == RetryStrategy::AttemptResult::FAILED_RETRIABLE && --attempt->outstanding > 0)) {
+                    return;
+                }
+                attempt->done = true;
+            }
+            *lastOutcome = outcome;
+            attemptComplete(result);
+        };
+
+        // Once the attempt has taken longer than nearly all responses to the action do, send the copy. Hedges are paid
+        // for from the retry budget, so they stop when the service is struggling rather than add to its load.
+        LatencyEstimator::LatencyStats stats;
+        if (hedgeWrite && latencyEstimator->TryGetStats(action, stats)) {
+            scheduler->Schedule(stats.p95, [attempt, outboundScheduler, retryBudget, priority, hedgeWrite, hedgeLength, onOutcome] {
+                {
+                    std::lock_guard<std::mutex> lock(attempt->lock);
+                    if (attempt->done || !retryBudget->TryAcquireRetry()) {
+                        return;
+                    }
+                    attempt->outstanding++;
+                }
+                outboundScheduler->Submit(priority, hedgeLength, hedgeWrite, onOutcome);
+            });
+        }
+        outboundScheduler->Submit(priority, jsonMessage->length(), write, onOutcome);
+    };
 
-    return outcome;
+    // Jittered retry, so requests that timed out together aren't all sent again at once.
+    // Retries draw on the process-wide budget and breaker, so they ease off together when the service is struggling.
+    std::shared_ptr<RetryStrategy> retryStrategy = std::make_shared<JitteredGeometricBackoffRetryStrategy>(policy.maxRetries);
+    retryStrategy->SetRetryBudget(retryBudget);
+    retryStrategy->SetCircuitBreaker(sendContext.circuitBreaker);
+    RetryStrategy::applyAsync(retryStrategy, timerScheduler, sendAttempt,
+                              [lastOutcome, complete, scheduler, deadlineTimer](RetryStrategy::AttemptResult) {
+                                  scheduler->Cancel(deadlineTimer);
+                                  if (!lastOutcome->IsSuccess() &&
+                                      lastOutcome->GetError().GetErrorType() == GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE) {
+                                      complete(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+                                  } else {
+                                      complete(*lastOutcome);
+                                  }
+                              });
 }
 
 void GameLiftWebSocketClientManager::Disconnect() { m_webSocketClientWrapper->Disconnect(); }
@@ -0,0 +1,41 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/network/InboundFrameParser.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+InboundFrameParser::InboundFrameParser()
+    : m_arena(new char[ARENA_SIZE]), m_allocator(m_arena.get(), ARENA_SIZE), m_document(&m_allocator, PARSE_STACK_CAPACITY, &m_allocator) {}
+
+const rapidjson::Value *InboundFrameParser::Parse(std::string &frame) {
+    // Nothing from the previous frame is referenced anymore. Clearing keeps the arena's own buffer
+    // and frees any chunks that spilled over.
+    m_document.SetNull();
+    m_allocator.Clear();
+
+    if (frame.empty()) {
+        return nullptr;
+    }
+
+    // std::string guarantees a null terminator after the contents, which in situ parsing stops at
+    if (m_document.ParseInsitu(&frame[0]).HasParseError() || !m_document.IsObject()) {
+        return nullptr;
+    }
+    return &m_document;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
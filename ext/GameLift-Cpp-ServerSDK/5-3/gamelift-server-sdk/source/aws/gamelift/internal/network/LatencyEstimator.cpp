@@ -0,0 +1,94 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include <aws/gamelift/internal/network/LatencyEstimator.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+constexpr const int LatencyEstimator::MIN_SAMPLES;
+constexpr const int LatencyEstimator::TIMEOUT_P99_MULTIPLIER;
+constexpr const int LatencyEstimator::MIN_TIMEOUT_MILLIS;
+constexpr const int LatencyEstimator::BUCKET_COUNT;
+constexpr const double LatencyEstimator::BUCKET_GROWTH;
+constexpr const double LatencyEstimator::SMOOTHING;
+constexpr const double LatencyEstimator::DECAY_WEIGHT;
+
+void LatencyEstimator::Record(const std::string &action, std::chrono::steady_clock::duration roundTrip) {
+    const double roundTripMillis = std::chrono::duration<double, std::milli>(roundTrip).count();
+    // Round trips under a millisecond share the first bucket
+    const int bucket = roundTripMillis < 1.0 ? 0 : std::min(BUCKET_COUNT - 1, static_cast<int>(std::log(roundTripMillis) / std::log(BUCKET_GROWTH)));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::map<std::string, ActionLatency>::iterator it = m_actions.find(action);
+    if (it == m_actions.end()) {
+        ActionLatency actionLatency;
+        actionLatency.samples = 0;
+        actionLatency.smoothedMillis = roundTripMillis;
+        actionLatency.weight = 0.0;
+        actionLatency.buckets.fill(0.0);
+        it = m_actions.insert(std::make_pair(action, actionLatency)).first;
+    }
+    ActionLatency &actionLatency = it->second;
+    actionLatency.samples++;
+    actionLatency.smoothedMillis += SMOOTHING * (roundTripMillis - actionLatency.smoothedMillis);
+    if (actionLatency.weight >= DECAY_WEIGHT) {
+        for (double &count : actionLatency.buckets) {
+            count /= 2;
+        }
+        actionLatency.weight /= 2;
+    }
+    actionLatency.buckets[bucket] += 1.0;
+    actionLatency.weight += 1.0;
+}
+
+bool LatencyEstimator::TryGetStats(const std::string &action, LatencyStats &stats) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::map<std::string, ActionLatency>::const_iterator it = m_actions.find(action);
+    if (it == m_actions.end() || it->second.samples < static_cast<std::size_t>(MIN_SAMPLES)) {
+        return false;
+    }
+    stats.samples = it->second.samples;
+    stats.smoothed = std::chrono::milliseconds(static_cast<std::chrono::milliseconds::rep>(std::ceil(it->second.smoothedMillis)));
+    stats.p95 = GetPercentile(it->second, 0.95);
+    stats.p99 = GetPercentile(it->second, 0.99);
+    return true;
+}
+
+std::chrono::milliseconds LatencyEstimator::GetTimeout(const std::string &action, std::chrono::milliseconds ceiling) const {
+    LatencyStats stats;
+    if (!TryGetStats(action, stats)) {
+        return ceiling;
+    }
+    const std::chrono::milliseconds timeout = std::max(stats.p99 * TIMEOUT_P99_MULTIPLIER, std::chrono::milliseconds(MIN_TIMEOUT_MILLIS));
+    return std::min(timeout, ceiling);
+}
+
+std::chrono::milliseconds LatencyEstimator::GetPercentile(const ActionLatency &actionLatency, double percentile) {
+    // Report the top of the bucket the percentile falls in, erring on the slow side
+    const double target = percentile * actionLatency.weight;
+    double cumulative = 0.0;
+    int bucket = 0;
+    for (; bucket < BUCKET_COUNT - 1; bucket++) {
+        cumulative += actionLatency.buckets[bucket];
+        if (cumulative >= target) {
+            break;
+        }
+    }
+    return std::chrono::milliseconds(static_cast<std::chrono::milliseconds::rep>(std::ceil(std::pow(BUCKET_GROWTH, bucket + 1))));
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,232 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include <aws/gamelift/internal/network/OutboundScheduler.h>
+#include <atomic>
+#include <vector>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+constexpr const std::size_t OutboundScheduler::DEFAULT_MAX_QUEUED_BYTES;
+constexpr const std::size_t OutboundScheduler::DEFAULT_MAX_QUEUED_BULK_BYTES;
+constexpr const std::size_t OutboundScheduler::DEFAULT_HIGH_WATER_BYTES;
+constexpr const int OutboundScheduler::BACKPRESSURE_RETRY_MILLIS;
+constexpr const int OutboundScheduler::MAX_WRITE_REFUSALS;
+constexpr const int OutboundScheduler::PRIORITY_COUNT;
+
+namespace {
+// Where a write is, as seen by its callback and by the thread that made it
+enum WritePhase { WRITING, RETURNED, REFUSED };
+
+bool IsRefusal(const GenericOutcome &outcome) {
+    return !outcome.IsSuccess() && outcome.GetError().GetErrorType() == GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE;
+}
+} // namespace
+
+OutboundScheduler::OutboundScheduler(std::shared_ptr<TimerScheduler> timerScheduler, std::size_t maxQueuedBytes, std::size_t maxQueuedBulkBytes)
+    : m_state(std::make_shared<SharedState>()) {
+    m_state->timerScheduler = timerScheduler;
+    m_state->maxQueuedBytes = maxQueuedBytes;
+    m_state->maxQueuedBulkBytes = maxQueuedBulkBytes;
+    m_state->highWaterBytes = DEFAULT_HIGH_WATER_BYTES;
+    for (int lane = 0; lane < PRIORITY_COUNT; lane++) {
+        m_state->laneBytes[lane] = 0;
+    }
+    m_state->dispatching = false;
+    m_state->blocked = false;
+    m_state->stopping = false;
+    m_state->rejectedMessages = 0;
+    m_state->shedMessages = 0;
+}
+
+OutboundScheduler::~OutboundScheduler() {
+    // Fail whatever is still queued, so no caller waits on a message that will never be written
+    std::vector<WriteCallback> unwritten;
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->stopping = true;
+        for (int lane = 0; lane < PRIORITY_COUNT; lane++) {
+            for (QueuedWrite &queuedWrite : m_state->lanes[lane]) {
+                unwritten.push_back(std::move(queuedWrite.callback));
+            }
+            m_state->lanes[lane].clear();
+            m_state->laneBytes[lane] = 0;
+        }
+    }
+    for (WriteCallback &callback : unwritten) {
+        callback(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+    }
+}
+
+void OutboundScheduler::Submit(Priority priority, std::size_t bytes, Write write, WriteCallback callback) {
+    const int bulkLane = static_cast<int>(Priority::BULK);
+    std::vector<WriteCallback> shed;
+    bool rejected = false;
+    bool dispatch = false;
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        const std::size_t queuedBytes = GetQueuedBytes(*m_state);
+        if (priority == Priority::BULK) {
+            rejected = m_state->laneBytes[bulkLane] + bytes > m_state->maxQueuedBulkBytes || queuedBytes + bytes > m_state->maxQueuedBytes;
+        } else {
+            // Make room by shedding the bulk messages queued last, which have waited the least
+            std::size_t freedBytes = 0;
+            while (queuedBytes - freedBytes + bytes > m_state->maxQueuedBytes && !m_state->lanes[bulkLane].empty()) {
+                QueuedWrite &shedWrite = m_state->lanes[bulkLane].back();
+                freedBytes += shedWrite.bytes;
+                m_state->laneBytes[bulkLane] -= shedWrite.bytes;
+                shed.push_back(std::move(shedWrite.callback));
+                m_state->lanes[bulkLane].pop_back();
+            }
+            m_state->shedMessages += shed.size();
+            rejected = priority == Priority::PLAYER_ADMISSION && queuedBytes - freedBytes + bytes > m_state->maxQueuedBytes;
+        }
+
+        if (rejected) {
+            m_state->rejectedMessages++;
+        } else {
+            const int lane = static_cast<int>(priority);
+            m_state->lanes[lane].push_back(QueuedWrite{bytes, 0, std::move(write), callback});
+            m_state->laneBytes[lane] += bytes;
+            dispatch = !m_state->dispatching && !m_state->blocked && !m_state->stopping;
+            m_state->dispatching = m_state->dispatching || dispatch;
+        }
+    }
+
+    for (WriteCallback &shedCallback : shed) {
+        shedCallback(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+    }
+    if (rejected) {
+        callback(GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+    } else if (dispatch) {
+        Dispatch(m_state);
+    }
+}
+
+void OutboundScheduler::SetBufferedAmount(BufferedAmount bufferedAmount, std::size_t highWaterBytes) {
+    m_state->bufferedAmount = std::move(bufferedAmount);
+    m_state->highWaterBytes = highWaterBytes;
+}
+
+OutboundScheduler::OutboundStats OutboundScheduler::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    OutboundStats stats;
+    stats.queuedMessages = 0;
+    for (int lane = 0; lane < PRIORITY_COUNT; lane++) {
+        stats.queuedMessages += m_state->lanes[lane].size();
+    }
+    stats.queuedBytes = GetQueuedBytes(*m_state);
+    stats.rejectedMessages = m_state->rejectedMessages;
+    stats.shedMessages = m_state->shedMessages;
+    return stats;
+}
+
+void OutboundScheduler::Dispatch(const std::shared_ptr<SharedState> &state) {
+    while (true) {
+        QueuedWrite queuedWrite;
+        int lane = 0;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            while (lane < PRIORITY_COUNT && state->lanes[lane].empty()) {
+                lane++;
+            }
+            if (lane == PRIORITY_COUNT || state->blocked || state->stopping) {
+                state->dispatching = false;
+                return;
+            }
+            queuedWrite = std::move(state->lanes[lane].front());
+            state->lanes[lane].pop_front();
+            state->laneBytes[lane] -= queuedWrite.bytes;
+        }
+
+        // The callback may run on another thread before the write returns, so the two settle which of them saw a
+        // refusal through the write's phase
+        std::shared_ptr<std::atomic<int>> phase = std::make_shared<std::atomic<int>>(WRITING);
+        const WriteCallback callback = queuedWrite.callback;
+        const bool requeueIfRefused = queuedWrite.refusals < MAX_WRITE_REFUSALS;
+        queuedWrite.write([phase, callback, requeueIfRefused](const GenericOutcome &outcome) {
+            int writing = WRITING;
+            if (requeueIfRefused && IsRefusal(outcome) && phase->compare_exchange_strong(writing, REFUSED)) {
+                return;
+            }
+            callback(outcome);
+        });
+        int writing = WRITING;
+        if (phase->compare_exchange_strong(writing, RETURNED)) {
+            if (!IsAboveHighWater(*state)) {
+                continue;
+            }
+            // The socket has fallen behind. Whatever is submitted meanwhile queues by priority until it catches up.
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->blocked = true;
+                state->dispatching = false;
+            }
+            ScheduleResume(state);
+            return;
+        }
+
+        // Refused: the socket's buffers are full. Put the message back at the head of its lane, and write nothing
+        // more until they have drained.
+        queuedWrite.refusals++;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->lanes[lane].push_front(std::move(queuedWrite));
+            state->laneBytes[lane] += state->lanes[lane].front().bytes;
+            state->blocked = true;
+            state->dispatching = false;
+        }
+        ScheduleResume(state);
+        return;
+    }
+}
+
+bool OutboundScheduler::IsAboveHighWater(const SharedState &state) {
+    return state.bufferedAmount && state.bufferedAmount() >= state.highWaterBytes;
+}
+
+void OutboundScheduler::ScheduleResume(const std::shared_ptr<SharedState> &state) {
+    state->timerScheduler->Schedule(std::chrono::milliseconds(BACKPRESSURE_RETRY_MILLIS), [state] {
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->stopping) {
+                return;
+            }
+        }
+        if (IsAboveHighWater(*state)) {
+            ScheduleResume(state);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->blocked = false;
+            if (state->dispatching || state->stopping) {
+                return;
+            }
+            state->dispatching = true;
+        }
+        Dispatch(state);
+    });
+}
+
+std::size_t OutboundScheduler::GetQueuedBytes(const SharedState &state) {
+    std::size_t queuedBytes = 0;
+    for (int lane = 0; lane < PRIORITY_COUNT; lane++) {
+        queuedBytes += state.laneBytes[lane];
+    }
+    return queuedBytes;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,116 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include <aws/gamelift/internal/network/ResolvedEndpointCache.h>
+#include <algorithm>
+#include <utility>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+constexpr const int ResolvedEndpointCache::DEFAULT_TTL_SECONDS;
+constexpr const int ResolvedEndpointCache::DEFAULT_MAX_HOSTS;
+
+namespace {
+// Only IPv6 addresses are written with colons
+bool IsIpv6(const std::string &address) { return address.find(':') != std::string::npos; }
+} // namespace
+
+ResolvedEndpointCache::ResolvedEndpointCache(std::chrono::seconds ttl, int maxHosts) : m_ttl(ttl), m_maxHosts(maxHosts > 0 ? maxHosts : DEFAULT_MAX_HOSTS) {}
+
+bool ResolvedEndpointCache::Lookup(const std::string &hostAndPort, std::vector<std::string> &addresses, std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<HostAddresses>::iterator hostAddresses = FindHost(hostAndPort);
+    if (hostAddresses == m_hosts.end()) {
+        return false;
+    }
+    if (now >= hostAddresses->expiresAt) {
+        m_hosts.erase(hostAddresses);
+        return false;
+    }
+    addresses = hostAddresses->addresses;
+    return true;
+}
+
+std::vector<std::string> ResolvedEndpointCache::Store(const std::string &hostAndPort, const std::vector<std::string> &addresses,
+                                                      std::chrono::steady_clock::time_point now) {
+    std::vector<std::string> ordered = InterleaveFamilies(addresses);
+    if (ordered.empty()) {
+        return ordered;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<HostAddresses>::iterator hostAddresses = FindHost(hostAndPort);
+    if (hostAddresses != m_hosts.end()) {
+        m_hosts.erase(hostAddresses);
+    } else if (m_hosts.size() >= m_maxHosts) {
+        m_hosts.erase(m_hosts.begin());
+    }
+    m_hosts.push_back(HostAddresses{hostAndPort, ordered, now + m_ttl});
+    return ordered;
+}
+
+void ResolvedEndpointCache::Prefer(const std::string &hostAndPort, const std::string &address) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<HostAddresses>::iterator hostAddresses = FindHost(hostAndPort);
+    if (hostAddresses == m_hosts.end()) {
+        return;
+    }
+    std::vector<std::string> &addresses = hostAddresses->addresses;
+    std::vector<std::string>::iterator preferred = std::find(addresses.begin(), addresses.end(), address);
+    if (preferred != addresses.end()) {
+        std::rotate(addresses.begin(), preferred, preferred + 1);
+    }
+}
+
+void ResolvedEndpointCache::Invalidate(const std::string &hostAndPort) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<HostAddresses>::iterator hostAddresses = FindHost(hostAndPort);
+    if (hostAddresses != m_hosts.end()) {
+        m_hosts.erase(hostAddresses);
+    }
+}
+
+std::vector<std::string> ResolvedEndpointCache::InterleaveFamilies(const std::vector<std::string> &addresses) {
+    if (addresses.empty()) {
+        return addresses;
+    }
+    const bool firstIsIpv6 = IsIpv6(addresses.front());
+    std::vector<std::string> first;
+    std::vector<std::string> second;
+    for (const std::string &address : addresses) {
+        (IsIpv6(address) == firstIsIpv6 ? first : second).push_back(address);
+    }
+    std::vector<std::string> interleaved;
+    interleaved.reserve(addresses.size());
+    for (std::size_t i = 0; i < first.size() || i < second.size(); i++) {
+        if (i < first.size()) {
+            interleaved.push_back(first[i]);
+        }
+        if (i < second.size()) {
+            interleaved.push_back(second[i]);
+        }
+    }
+    return interleaved;
+}
+
+std::vector<ResolvedEndpointCache::HostAddresses>::iterator ResolvedEndpointCache::FindHost(const std::string &hostAndPort) {
+    for (std::vector<HostAddresses>::iterator hostAddresses = m_hosts.begin(); hostAddresses != m_hosts.end(); ++hostAddresses) {
+        if (hostAddresses->hostAndPort == hostAndPort) {
+            return hostAddresses;
+        }
+    }
+    return m_hosts.end();
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
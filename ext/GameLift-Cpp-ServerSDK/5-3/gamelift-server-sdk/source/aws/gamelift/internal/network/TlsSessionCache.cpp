@@ -0,0 +1,173 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include <aws/gamelift/internal/network/TlsSessionCache.h>
+#include <ctime>
+#include <utility>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+constexpr const int TlsSessionCache::DEFAULT_MAX_HOSTS;
+constexpr const int TlsSessionCache::MAX_SESSIONS_PER_HOST;
+
+TlsSessionCache::TlsSessionCache(int maxHosts) : m_maxHosts(maxHosts > 0 ? maxHosts : DEFAULT_MAX_HOSTS), m_stats{0, 0} {}
+
+TlsSessionCache::~TlsSessionCache() {
+    for (HostSessions &hostSessions : m_hosts) {
+        for (SSL_SESSION *session : hostSessions.sessions) {
+            SSL_SESSION_free(session);
+        }
+    }
+}
+
+void TlsSessionCache::Attach(SSL_CTX *context) {
+    // A client never looks sessions up in OpenSSL's own store, so they only go to OnNewSession
+    SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(context, &TlsSessionCache::OnNewSession);
+    SSL_CTX_set_ex_data(context, GetContextIndex(), new std::shared_ptr<TlsSessionCache>(shared_from_this()));
+}
+
+bool TlsSessionCache::Resume(SSL *connection) {
+    const char *host = SSL_get_servername(connection, TLSEXT_NAMETYPE_host_name);
+    if (host == nullptr) {
+        return false;
+    }
+
+    SSL_SESSION *session = nullptr;
+    std::vector<SSL_SESSION *> expiredSessions;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<HostSessions>::iterator hostSessions = FindHost(host);
+        if (hostSessions == m_hosts.end()) {
+            return false;
+        }
+        std::deque<SSL_SESSION *> &sessions = hostSessions->sessions;
+        while (session == nullptr && !sessions.empty()) {
+            SSL_SESSION *newest = sessions.back();
+            if (IsExpired(newest)) {
+                expiredSessions.push_back(newest);
+                sessions.pop_back();
+            } else if (SSL_SESSION_get_protocol_version(newest) >= TLS1_3_VERSION) {
+                // A ticket is single use, so the cache hands its reference over
+                session = newest;
+                sessions.pop_back();
+            } else {
+                // The connection gets a copy. OpenSSL marks the session it was given unusable if it drops without a
+                // TLS shutdown, and the cached one has to stay usable for the connections after it.
+                session = SSL_SESSION_dup(newest);
+                break;
+            }
+        }
+    }
+    for (SSL_SESSION *expiredSession : expiredSessions) {
+        SSL_SESSION_free(expiredSession);
+    }
+    if (session == nullptr) {
+        return false;
+    }
+
+    // The connection takes a reference of its own
+    const bool offered = SSL_set_session(connection, session) == 1;
+    SSL_SESSION_free(session);
+    return offered;
+}
+
+void TlsSessionCache::RecordHandshake(SSL *connection) {
+    const bool resumed = SSL_session_reused(connection) == 1;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (resumed) {
+        m_stats.resumedHandshakes++;
+    } else {
+        m_stats.fullHandshakes++;
+    }
+}
+
+TlsSessionCache::TlsSessionStats TlsSessionCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+int TlsSessionCache::OnNewSession(SSL *connection, SSL_SESSION *session) {
+    void *cache = SSL_CTX_get_ex_data(SSL_get_SSL_CTX(connection), GetContextIndex());
+    if (cache == nullptr) {
+        return 0;
+    }
+    // The cache keeps a copy, for the same reason Resume hands out copies: the connection's own session is marked
+    // unusable if the connection drops without a TLS shutdown, which is just when it is needed.
+    SSL_SESSION *copy = SSL_SESSION_dup(session);
+    if (copy != nullptr && !(*static_cast<std::shared_ptr<TlsSessionCache> *>(cache))->Store(connection, copy)) {
+        SSL_SESSION_free(copy);
+    }
+    return 0;
+}
+
+int TlsSessionCache::GetContextIndex() {
+    // Allocated once per process. A context drops its reference to the cache when it is freed.
+    static const int contextIndex =
+        SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, [](void *, void *cache, CRYPTO_EX_DATA *, int, long, void *) {
+            delete static_cast<std::shared_ptr<TlsSessionCache> *>(cache);
+        });
+    return contextIndex;
+}
+
+bool TlsSessionCache::IsExpired(SSL_SESSION *session) {
+    return SSL_SESSION_get_time(session) + SSL_SESSION_get_timeout(session) <= static_cast<long>(std::time(nullptr));
+}
+
+bool TlsSessionCache::Store(SSL *connection, SSL_SESSION *session) {
+    const char *host = SSL_get_servername(connection, TLSEXT_NAMETYPE_host_name);
+    if (host == nullptr) {
+        return false;
+    }
+
+    std::vector<SSL_SESSION *> evictedSessions;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<HostSessions>::iterator hostSessions = FindHost(host);
+        if (hostSessions != m_hosts.end()) {
+            // Most recently stored last
+            HostSessions moved = std::move(*hostSessions);
+            m_hosts.erase(hostSessions);
+            m_hosts.push_back(std::move(moved));
+        } else {
+            if (m_hosts.size() >= m_maxHosts) {
+                evictedSessions.insert(evictedSessions.end(), m_hosts.front().sessions.begin(), m_hosts.front().sessions.end());
+                m_hosts.erase(m_hosts.begin());
+            }
+            m_hosts.push_back(HostSessions{host, std::deque<SSL_SESSION *>()});
+        }
+        std::deque<SSL_SESSION *> &sessions = m_hosts.back().sessions;
+        sessions.push_back(session);
+        while (sessions.size() > static_cast<std::size_t>(MAX_SESSIONS_PER_HOST)) {
+            evictedSessions.push_back(sessions.front());
+            sessions.pop_front();
+        }
+    }
+    for (SSL_SESSION *evictedSession : evictedSessions) {
+        SSL_SESSION_free(evictedSession);
+    }
+    return true;
+}
+
+std::vector<TlsSessionCache::HostSessions>::iterator TlsSessionCache::FindHost(const std::string &host) {
+    for (std::vector<HostSessions>::iterator hostSessions = m_hosts.begin(); hostSessions != m_hosts.end(); ++hostSessions) {
+        if (hostSessions->host == host) {
+            return hostSessions;
+        }
+    }
+    return m_hosts.end();
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
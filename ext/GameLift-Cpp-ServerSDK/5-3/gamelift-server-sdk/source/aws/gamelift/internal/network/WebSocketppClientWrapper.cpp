@@ -11,9 +11,12 @@
  */
 #include <aws/gamelift/internal/model/Message.h>
 #include <aws/gamelift/internal/model/ResponseMessage.h>
+#include <aws/gamelift/internal/network/InboundFrameParser.h>
 #include <aws/gamelift/internal/network/WebSocketppClientWrapper.h>
 #include <aws/gamelift/internal/retry/GeometricBackoffRetryStrategy.h>
-#include <aws/gamelift/internal/retry/RetryingCallable.h>
+#include <aws/gamelift/internal/util/JsonHelper.h>
+#include <algorithm>
+#include <future>
 #include <memory>
 #include <websocketpp/error.hpp>
 
@@ -22,7 +25,13 @@ namespace GameLift {
 namespace Internal {
 
 WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppClientType> webSocketClient)
-    : m_webSocketClient(webSocketClient), m_connectionStateChanged(false) {
+    : m_webSocketClient(webSocketClient), m_pollDriven(false), m_lowFootprint(false), m_warmStandby(false), m_ownsTimerScheduler(false),
+      m_connectionState(ConnectionState::DISCONNECTED), m_drainTimer(TimerScheduler::INVALID_TIMER_ID), m_drainingRequestCount(0), m_refreshing(false),
+      m_standbyConnecting(false) {
+    m_refreshStats = ConnectionRefreshStats{0, 0, 0, std::chrono::milliseconds(0)};
+    m_tlsSessionCache = std::make_shared<TlsSessionCache>();
+    m_sharedTlsContext = CreateTlsContext();
+
     // configure logging. comment these out to get websocket logs on stdout for debugging
     m_webSocketClient->clear_access_channels(websocketpp::log::alevel::all);
     m_webSocketClient->clear_error_channels(websocketpp::log::elevel::all);
@@ -33,30 +42,6 @@ WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppCl
     // start in perpetual mode (do not exit processing loop when there are no connections)
     m_webSocketClient->start_perpetual();
 
-    // Kick off two threads that will own up to two parallel connections. These threads will live
-    // until the SDK is shutdown and alternate handling connections. If a connection fails to open,
-    // the thread will not hang. Instead, the thread will simply wait for another connection to
-    // appear in queue.
-    //
-    // Flow of logic in the two threads:
-    // --- SDK initialized ---
-    // socket_thread_1: waiting for connection...
-    // socket_thread_2: waiting for connection...
-    // --- Initial connection happens ---
-    // socket_thread_1: handling 1st connection
-    // socket_thread_2: waiting for connection...
-    // --- Connection refresh begins ---
-    // socket_thread_1: finish handling 1st connection messages
-    // socket_thread_2: handling 2nd connection
-    // --- Connection 1 closes ---
-    // socket_thread_1: waiting for connection...
-    // socket_thread_2: handling 2nd connection
-    // --- SDK shut down, and WebSocket client "->stop_perpetual()" is invoked ---
-    // socket_thread_1: No longer waits for a connection, thread ends
-    // socket_thread_2: Finishes handling 2nd connection, then thread ends
-    m_socket_thread_1 = std::unique_ptr<std::thread>(new std::thread([this] { m_webSocketClient->run(); }));
-    m_socket_thread_2 = std::unique_ptr<std::thread>(new std::thread([this] { m_webSocketClient->run(); }));
-
     // Set callbacks
     using std::placeholders::_1;
     using std::placeholders::_2;
@@ -65,23 +50,38 @@ WebSocketppClientWrapper::WebSocketppClientWrapper(std::shared_ptr<WebSocketppCl
     // See: https://github.com/zaphoyd/websocketpp/blob/master/websocketpp/connection.hpp#L501
     m_webSocketClient->set_open_handshake_timeout(WEBSOCKET_OPEN_HANDSHAKE_TIMEOUT_MILLIS);
 
+    // Open and fail handlers are set per connection in AttemptConnect, so each attempt reports its own result
     m_webSocketClient->set_tls_init_handler(std::bind(&WebSocketppClientWrapper::OnTlsInit, this, _1));
-    m_webSocketClient->set_open_handler(std::bind(&WebSocketppClientWrapper::OnConnected, this, _1));
     m_webSocketClient->set_message_handler(std::bind(&WebSocketppClientWrapper::OnMessage, this, _1, _2));
-    m_webSocketClient->set_fail_handler(std::bind(&WebSocketppClientWrapper::OnError, this, _1));
     m_webSocketClient->set_close_handler(std::bind(&WebSocketppClientWrapper::OnClose, this, _1));
 }
 
 WebSocketppClientWrapper::~WebSocketppClientWrapper() {
+    // A scheduler created by this wrapper only runs this wrapper's timers, stop it before tearing down
+    if (m_ownsTimerScheduler) {
+        m_timerScheduler->Stop();
+    }
+
     // stop perpetual mode, allowing the websocketClient to destroy itself
     if (m_webSocketClient) {
         m_webSocketClient->stop_perpetual();
     }
 
     // close connections and join the thread
-    if (m_connection && m_connection->get_state() == websocketpp::session::state::open) {
+    if ((m_connection && m_connection->get_state() == websocketpp::session::state::open) || m_standbyConnection) {
         Disconnect();
     }
+    // Complete anything still waiting, so no caller blocks on a wrapper that is going away. Nothing
+    // can be waiting if Connect was never called.
+    if (m_timerScheduler) {
+        FinishDrain();
+        ResumeSendsAwaitingReconnect(false);
+        FailPendingRequests();
+    }
+    if (m_pollDriven) {
+        // Without socket threads to join, finish closing the connections on this thread instead
+        m_webSocketClient->run();
+    }
     if (m_socket_thread_1 && m_socket_thread_1->joinable()) {
         m_socket_thread_1->join();
     }
@@ -90,165 +90,677 @@ WebSocketppClientWrapper::~WebSocketppClientWrapper() {
     }
 }
 
+void WebSocketppClientWrapper::StartSocketThreads() {
+    // Connect runs again for every connection refresh, the threads are only started the first time
+    if (m_pollDriven || m_socket_thread_1) {
+        return;
+    }
+
+    // Kick off two threads that will own up to two parallel connections. These threads will live
+    // until the SDK is shutdown and alternate handling connections. If a connection fails to open,
+    // the thread will not hang. Instead, the thread will simply wait for another connection to
+    // appear in queue.
+    //
+    // Flow of logic in the two threads:
+    // --- SDK connects for the first time ---
+    // socket_thread_1: waiting for connection...
+    // socket_thread_2: waiting for connection...
+    // --- Initial connection happens ---
+    // socket_thread_1: handling 1st connection
+    // socket_thread_2: waiting for connection...
+    // --- Connection refresh begins ---
+    // socket_thread_1: finish handling 1st connection messages
+    // socket_thread_2: handling 2nd connection
+    // --- Connection 1 closes ---
+    // socket_thread_1: waiting for connection...
+    // socket_thread_2: handling 2nd connection
+    // --- SDK shut down, and WebSocket client "->stop_perpetual()" is invoked ---
+    // socket_thread_1: No longer waits for a connection, thread ends
+    // socket_thread_2: Finishes handling 2nd connection, then thread ends
+    //
+    // Connections are asynchronous, so in low footprint mode one thread handles both, at the cost of
+    // a busy connection delaying the other.
+    m_socket_thread_1 = std::unique_ptr<std::thread>(new std::thread([this] { m_webSocketClient->run(); }));
+    if (!m_lowFootprint) {
+        m_socket_thread_2 = std::unique_ptr<std::thread>(new std::thread([this] { m_webSocketClient->run(); }));
+    }
+}
+
 GenericOutcome WebSocketppClientWrapper::Connect(const Uri &uri) {
-    // Perform connection with retries.
-    // This attempts to start up a new websocket connection / thread
+    // Block on the asynchronous path. Attempts are queued on the socket threads and the backoff between
+    // them is a timer, so the only thread waiting is the caller's.
+    std::shared_ptr<std::promise<GenericOutcome>> connectPromise = std::make_shared<std::promise<GenericOutcome>>();
+    std::future<GenericOutcome> connectFuture = connectPromise->get_future();
+    ConnectAsync(uri, [connectPromise](const GenericOutcome &outcome) { connectPromise->set_value(outcome); });
+    GenericOutcome outcome = AwaitOutcome(connectFuture);
+    if (!outcome.IsSuccess()) {
+        printf("Connection to GameLift websocket server failed. See error message in InitSDK() outcome for details.\n");
+    }
+    return outcome;
+}
+
+void WebSocketppClientWrapper::ConnectAsync(const Uri &uri, const std::function<void(const GenericOutcome &)> &callback) {
     m_uri = uri;
+    if (!m_timerScheduler) {
+        m_timerScheduler = std::make_shared<TimerScheduler>();
+        // A poll driven wrapper runs its own scheduler's timers in Poll
+        if (!m_pollDriven) {
+            m_timerScheduler->Start();
+        }
+        m_ownsTimerScheduler = true;
+    }
+    StartSocketThreads();
+
+    // Connecting while connected is a refresh, timed from here until the old connection is drained
+    const bool connected = IsConnected();
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        if (connected) {
+            m_refreshing = true;
+            m_refreshStart = std::chrono::steady_clock::now();
+        } else if (m_connectionState == ConnectionState::DISCONNECTED) {
+            m_connectionState = ConnectionState::CONNECTING;
+        }
+    }
+    ConnectWithRetries(uri, callback);
+}
+
+void WebSocketppClientWrapper::ConnectWithRetries(const Uri &uri, const std::function<void(const GenericOutcome &)> &onComplete) {
+    // Perform connection with retries.
+    // This attempts to start up a new websocket connection / thread. Failures another attempt can't fix end the
+    // retries at once, and how each attempt went is reported with the outcome.
+    //
+    // Attempts run one after another, each started from the timer the last one scheduled, so their shared state
+    // needs no lock.
+    std::shared_ptr<std::string> attemptSummary = std::make_shared<std::string>();
+    std::shared_ptr<bool> connected = std::make_shared<bool>(false);
+    RetryStrategy::applyAsync(
+        std::make_shared<GeometricBackoffRetryStrategy>(), *m_timerScheduler,
+        [this, uri, attemptSummary, connected](const std::function<void(RetryStrategy::AttemptResult)> &attemptComplete) {
+            const std::chrono::steady_clock::time_point attemptStart = std::chrono::steady_clock::now();
+            AttemptConnect(uri, [this, attemptSummary, connected, attemptStart, attemptComplete](bool opened) {
+                const long long attemptMillis =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - attemptStart).count();
+                bool retriable = false;
+                std::string result = "connected";
+                if (!opened) {
+                    std::lock_guard<std::mutex> lk(m_lock);
+                    retriable = IsRetriableConnectFailure(m_fail_error_code, m_fail_response_code);
+                    result = DescribeConnectFailure(m_fail_error_code, m_fail_response_code);
+                }
+                if (!attemptSummary->empty()) {
+                    attemptSummary->append("; ");
+                }
+                attemptSummary->append(std::to_string(attemptMillis) + " ms, " + result);
+                if (!opened && !retriable) {
+                    printf("Connection to GameLift websocket server failed with an error retrying can't fix (%s).\n", result.c_str());
+                }
+                *connected = opened;
+                if (opened) {
+                    attemptComplete(RetryStrategy::AttemptResult::ANSWERED);
+                } else {
+                    attemptComplete(retriable ? RetryStrategy::AttemptResult::FAILED_RETRIABLE : RetryStrategy::AttemptResult::FAILED);
+                }
+            });
+        },
+        [this, onComplete, attemptSummary, connected](RetryStrategy::AttemptResult) {
+            if (*connected) {
+                printf("Connected to GameLift websocket server. Connect attempts: %s.\n", attemptSummary->c_str());
+                // OnConnected has already moved to CONNECTED, so release the sends that waited for it
+                ResumeSendsAwaitingReconnect(true);
+                OpenStandby();
+                if (m_connectedHandler) {
+                    m_connectedHandler();
+                }
+                onComplete(GenericOutcome(nullptr));
+                return;
+            }
+            GenericOutcome outcome;
+            {
+                std::lock_guard<std::mutex> lk(m_lock);
+                m_connection = nullptr;
+                m_connectionState = ConnectionState::DISCONNECTED;
+                outcome = ToConnectFailureOutcome(m_fail_error_code, m_fail_response_code);
+            }
+            // Reported through InitSDK, so a process that can't connect shows why and how long it spent trying
+            GameLiftError error = outcome.GetError();
+            const std::string errorMessage = std::string(error.GetErrorMessage()) + " Connect attempts: " + *attemptSummary + ".";
+            error.SetErrorMessage(errorMessage.c_str());
+            ResumeSendsAwaitingReconnect(false);
+            onComplete(GenericOutcome(error));
+        });
+}
+
+void WebSocketppClientWrapper::AttemptConnect(const Uri &uri, const std::function<void(bool)> &attemptComplete) {
+    // Create connection request
     websocketpp::lib::error_code errorCode;
-    GeometricBackoffRetryStrategy retryStrategy;
-    RetryingCallable callable = RetryingCallable::Builder()
-                                    .WithRetryStrategy(&retryStrategy)
-                                    .WithCallable([this, &uri, &errorCode] {
-                                        WebSocketppClientType::connection_ptr newConnection = PerformConnect(uri, errorCode);
-                                        if (newConnection && newConnection->get_state() == websocketpp::session::state::open) {
-                                            // "Flip" traffic from our old websocket to our new websocket. Close the old one
-                                            // if necessary
-                                            WebSocketppClientType::connection_ptr oldConnection = m_connection;
-                                            m_connection = newConnection;
-                                            if (oldConnection && oldConnection->get_state() == websocketpp::session::state::open) {
-                                                websocketpp::lib::error_code closeErrorCode;
-                                                m_webSocketClient->close(oldConnection->get_handle(), websocketpp::close::status::going_away,
-                                                                         "Websocket client reconnecting", closeErrorCode);
-                                            }
-                                            return true;
-                                        } else {
-                                            printf("Connection to GameLift websocket server failed. Retrying connection if possible.\n");
-                                            return false;
-                                        }
-                                    })
-                                    .Build();
-    callable.call();
-
-    if (IsConnected()) {
-        return GenericOutcome(nullptr);
-    } else {
-        printf("Connection to GameLift websocket server failed. See error message in InitSDK() outcome for details.\n");
-        m_connection = nullptr;
+    WebSocketppClientType::connection_ptr newConnection = m_webSocketClient->get_connection(uri.GetUriString(), errorCode);
+    if (errorCode.value()) {
+        {
+            std::lock_guard<std::mutex> lk(m_lock);
+            m_fail_error_code = errorCode;
+            m_fail_response_code = websocketpp::http::status_code::uninitialized;
+        }
+        printf("Connection to GameLift websocket server failed. Retrying connection if possible.\n");
+        attemptComplete(false);
+        return;
+    }
+
+    // Time each phase of the handshake: name resolution and TCP, then TLS, then the WebSocket upgrade
+    std::shared_ptr<ConnectAttemptTimes> attemptTimes = std::make_shared<ConnectAttemptTimes>();
+    newConnection->set_tcp_pre_init_handler([this, attemptTimes](websocketpp::connection_hdl connection) {
+        attemptTimes->tcpConnected = std::chrono::steady_clock::now();
+        ResumeTlsSession(connection);
+    });
+    newConnection->set_tcp_post_init_handler([this, attemptTimes](websocketpp::connection_hdl connection) {
+        attemptTimes->tlsConnected = std::chrono::steady_clock::now();
+        RecordTlsHandshake(connection);
+    });
+
+    // Exactly one of these runs, on a socket thread, once the attempt opens or fails
+    newConnection->set_open_handler([this, attemptComplete, attemptTimes](websocketpp::connection_hdl connection) {
+        const std::chrono::steady_clock::time_point opened = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lk(m_lock);
+            m_connectTimings.SetConnectMillis(
+                static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(attemptTimes->tcpConnected - attemptTimes->started).count()));
+            m_connectTimings.SetTlsMillis(
+                static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(attemptTimes->tlsConnected - attemptTimes->tcpConnected).count()));
+            m_connectTimings.SetUpgradeMillis(
+                static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(opened - attemptTimes->tlsConnected).count()));
+        }
+        OnConnected(connection);
+        attemptComplete(true);
+    });
+    newConnection->set_fail_handler([this, attemptComplete](websocketpp::connection_hdl connection) {
+        OnError(connection);
+        printf("Connection to GameLift websocket server failed. Retrying connection if possible.\n");
+        attemptComplete(false);
+    });
+
+    // Queue a new connection request (the socket thread will act on it and attempt to connect)
+    attemptTimes->started = std::chrono::steady_clock::now();
+    m_webSocketClient->connect(newConnection);
+}
+
+bool WebSocketppClientWrapper::IsRetriableConnectFailure(const websocketpp::lib::error_code &errorCode, websocketpp::http::status_code::value responseCode) {
+    // The service answered and turned the handshake down, e.g. for a bad auth token. Only a busy or slow service is worth trying again.
+    if (responseCode >= websocketpp::http::status_code::bad_request && responseCode < websocketpp::http::status_code::internal_server_error) {
+        return responseCode == websocketpp::http::status_code::request_timeout || responseCode == websocketpp::http::status_code::too_many_requests;
+    }
+    // The request itself is malformed, so every attempt would fail the same way
+    if (errorCode.category() == websocketpp::error::get_category()) {
         switch (errorCode.value()) {
-        case websocketpp::error::server_only:
-            switch (m_fail_response_code) {
-            case websocketpp::http::status_code::value::forbidden:
-                return GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE_FORBIDDEN);
-            default:
-                return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE, errorCode.category().message(errorCode.value()).c_str(),
-                                                    errorCode.message().c_str()));
-            }
-        case 11001: // Host not found
         case websocketpp::error::invalid_uri:
-            return GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE_INVALID_URL);
-        // case websocketpp::error::timeout:
-        case 0: // No Response after multiple retries, i.e. timeout
-        case websocketpp::error::open_handshake_timeout:
-        case websocketpp::error::close_handshake_timeout:
-            return GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE_TIMEOUT);
-        case websocketpp::error::endpoint_not_secure:
-        case websocketpp::error::no_outgoing_buffers:
-        case websocketpp::error::no_incoming_buffers:
-        case websocketpp::error::invalid_state:
-        case websocketpp::error::bad_close_code:
-        case websocketpp::error::reserved_close_code:
-        case websocketpp::error::invalid_close_code:
-        case websocketpp::error::invalid_utf8:
-        case websocketpp::error::invalid_subprotocol:
-        case websocketpp::error::bad_connection:
-        case websocketpp::error::con_creation_failed:
-        case websocketpp::error::unrequested_subprotocol:
-        case websocketpp::error::client_only:
-        case websocketpp::error::http_connection_ended:
         case websocketpp::error::invalid_port:
-        case websocketpp::error::async_accept_not_listening:
-        case websocketpp::error::upgrade_required:
+        case websocketpp::error::endpoint_not_secure:
         case websocketpp::error::invalid_version:
         case websocketpp::error::unsupported_version:
-        case websocketpp::error::http_parse_error:
-        case websocketpp::error::extension_neg_failed:
+        case websocketpp::error::upgrade_required:
+            return false;
+        default:
+            break;
+        }
+    }
+    // Timeouts, refused or dropped connections, name lookups and server errors can all clear up
+    return true;
+}
+
+std::string WebSocketppClientWrapper::DescribeConnectFailure(const websocketpp::lib::error_code &errorCode,
+                                                             websocketpp::http::status_code::value responseCode) {
+    if (responseCode != websocketpp::http::status_code::uninitialized) {
+        return "HTTP " + std::to_string(static_cast<int>(responseCode));
+    }
+    return errorCode.message();
+}
+
+GenericOutcome WebSocketppClientWrapper::ToConnectFailureOutcome(const websocketpp::lib::error_code &errorCode, websocketpp::http::status_code::value responseCode) {
+    switch (errorCode.value()) {
+    case websocketpp::error::server_only:
+        switch (responseCode) {
+        case websocketpp::http::status_code::value::forbidden:
+            return GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE_FORBIDDEN);
         default:
             return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE, errorCode.category().message(errorCode.value()).c_str(),
                                                 errorCode.message().c_str()));
         }
+    case 11001: // Host not found
+    case websocketpp::error::invalid_uri:
+        return GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE_INVALID_URL);
+    // case websocketpp::error::timeout:
+    case 0: // No Response after multiple retries, i.e. timeout
+    case websocketpp::error::open_handshake_timeout:
+    case websocketpp::error::close_handshake_timeout:
+        return GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE_TIMEOUT);
+    case websocketpp::error::endpoint_not_secure:
+    case websocketpp::error::no_outgoing_buffers:
+    case websocketpp::error::no_incoming_buffers:
+    case websocketpp::error::invalid_state:
+    case websocketpp::error::bad_close_code:
+    case websocketpp::error::reserved_close_code:
+    case websocketpp::error::invalid_close_code:
+    case websocketpp::error::invalid_utf8:
+    case websocketpp::error::invalid_subprotocol:
+    case websocketpp::error::bad_connection:
+    case websocketpp::error::con_creation_failed:
+    case websocketpp::error::unrequested_subprotocol:
+    case websocketpp::error::client_only:
+    case websocketpp::error::http_connection_ended:
+    case websocketpp::error::invalid_port:
+    case websocketpp::error::async_accept_not_listening:
+    case websocketpp::error::upgrade_required:
+    case websocketpp::error::invalid_version:
+    case websocketpp::error::unsupported_version:
+    case websocketpp::error::http_parse_error:
+    case websocketpp::error::extension_neg_failed:
+    default:
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_CONNECT_FAILURE, errorCode.category().message(errorCode.value()).c_str(),
+                                            errorCode.message().c_str()));
     }
 }
 
-WebSocketppClientType::connection_ptr WebSocketppClientWrapper::PerformConnect(const Uri &uri, websocketpp::lib::error_code &errorCode) {
-    errorCode.clear();
-    // Create connection request
-    WebSocketppClientType::connection_ptr newConnection = m_webSocketClient->get_connection(uri.GetUriString(), errorCode);
-    if (errorCode.value()) {
-        return newConnection;
+GenericOutcome WebSocketppClientWrapper::SendSocketMessage(const std::string &requestId, const std::string &message) {
+    return SendSocketMessage(requestId, message.c_str(), message.length());
+}
+
+GenericOutcome WebSocketppClientWrapper::SendSocketMessage(const std::string &requestId, const char *message, std::size_t length) {
+    if (requestId.empty()) {
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
     }
 
-    // Queue a new connection request (the socket thread will act on it and attempt to connect)
-    m_webSocketClient->connect(newConnection);
+    // Block on the asynchronous path. A message sent during a reconnect waits for it there, and the
+    // request's deadline timer fails it with a retriable error once SERVICE_CALL_TIMEOUT_MILLIS passes
+    // without a response.
+    std::shared_ptr<std::promise<GenericOutcome>> responsePromise = std::make_shared<std::promise<GenericOutcome>>();
+    std::future<GenericOutcome> responseFuture = responsePromise->get_future();
+    SendSocketMessageAsync(requestId, message, length, [responsePromise](const GenericOutcome &outcome) { responsePromise->set_value(outcome); });
+    return AwaitOutcome(responseFuture);
+}
 
-    // Wait for connection to succeed or fail (this makes connection synchronous)
-    {
-        std::unique_lock<std::mutex> lk(m_lock);
-        m_cond.wait(lk, [this] { return m_connectionStateChanged; });
-        errorCode = m_fail_error_code;
-        // Reset
-        m_connectionStateChanged = false;
-        m_fail_error_code.clear();
+void WebSocketppClientWrapper::SendSocketMessageAsync(const std::string &requestId, const std::string &message, const SocketMessageCallback &callback) {
+    SendSocketMessageAsync(requestId, message.c_str(), message.length(), callback);
+}
+
+void WebSocketppClientWrapper::SendSocketMessageAsync(const std::string &requestId, const char *message, std::size_t length,
+                                                      const SocketMessageCallback &callback) {
+    SendSocketMessageAsync(requestId, message, length, std::chrono::milliseconds(SERVICE_CALL_TIMEOUT_MILLIS), callback);
+}
+
+void WebSocketppClientWrapper::SendSocketMessageAsync(const std::string &requestId, const char *message, std::size_t length,
+                                                      std::chrono::milliseconds timeout, const SocketMessageCallback &callback) {
+    if (requestId.empty()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION)));
+        return;
+    }
+
+    if (!IsConnected()) {
+        WaitForReconnect(requestId, message, length, timeout, callback);
+        return;
+    }
+
+    const uint64_t requestHandle = Message::ToRequestHandle(requestId);
+    PendingRequest pendingRequest;
+    pendingRequest.callback = callback;
+    pendingRequest.sentAt = std::chrono::steady_clock::now();
+    const std::chrono::steady_clock::time_point expiresAt = pendingRequest.sentAt + timeout;
+    pendingRequest.timeoutTimer = m_timerScheduler->Schedule(timeout, [this, requestId] {
+        CompletePendingRequest(requestId, GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)));
+    });
+    const TimerScheduler::TimerId timeoutTimer = pendingRequest.timeoutTimer;
+
+    switch (m_pendingRequests.TryInsert(requestHandle, std::move(pendingRequest))) {
+    case RequestCorrelationTable<PendingRequest>::InsertResult::INSERTED:
+        TrackRequest(requestHandle);
+        // With a timeout near zero, the timer may have fired before the request was in the table and found nothing
+        // to time out. It never fires before expiresAt, so if that has passed the timeout is applied here instead.
+        if (std::chrono::steady_clock::now() >= expiresAt) {
+            CompletePendingRequest(requestId, GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)));
+            return;
+        }
+        break;
+    case RequestCorrelationTable<PendingRequest>::InsertResult::DUPLICATE:
+        // This indicates we've already sent this message, and it's still in flight
+        m_timerScheduler->Cancel(timeoutTimer);
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION)));
+        return;
+    case RequestCorrelationTable<PendingRequest>::InsertResult::FULL:
+        // Too many requests in flight near this handle, the caller may retry once some complete
+        printf("Too many requests in flight to track request %s.\n", requestId.c_str());
+        m_timerScheduler->Cancel(timeoutTimer);
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)));
+        return;
     }
 
-    return newConnection;
+    GenericOutcome immediateResponse = WriteSocketMessage(message, length);
+    if (!immediateResponse.IsSuccess()) {
+        CompletePendingRequest(requestId, immediateResponse);
+    }
 }
 
-GenericOutcome WebSocketppClientWrapper::SendSocketMessage(const std::string &requestId, const std::string &message) {
+bool WebSocketppClientWrapper::CompletePendingRequest(const std::string &requestId, const GenericOutcome &outcome, const std::string &respondingAction) {
+    // Messages that aren't responses to a request carry no request ID
     if (requestId.empty()) {
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::INTERNAL_SERVICE_EXCEPTION));
+        return false;
+    }
+
+    const uint64_t requestHandle = Message::ToRequestHandle(requestId);
+    PendingRequest pendingRequest;
+    if (!m_pendingRequests.TryTake(requestHandle, pendingRequest)) {
+        return false;
+    }
+    UntrackRequest(requestHandle);
+    if (m_latencyEstimator && !respondingAction.empty()) {
+        m_latencyEstimator->Record(respondingAction, std::chrono::steady_clock::now() - pendingRequest.sentAt);
+    }
+
+    // Invoke the callback outside the table, it may send further messages
+    m_timerScheduler->Cancel(pendingRequest.timeoutTimer);
+    pendingRequest.callback(outcome);
+    return true;
+}
+
+void WebSocketppClientWrapper::FailPendingRequests() {
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        m_requestHandles.clear();
+        m_drainingRequestHandles.clear();
+    }
+    m_pendingRequests.TakeAll([this](PendingRequest &pendingRequest) {
+        m_timerScheduler->Cancel(pendingRequest.timeoutTimer);
+        pendingRequest.callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE)));
+    });
+}
+
+void WebSocketppClientWrapper::WaitForReconnect(const std::string &requestId, const char *message, std::size_t length, std::chrono::milliseconds timeout,
+                                                const SocketMessageCallback &callback) {
+    bool reconnected = false;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        // The connection may have come back since the caller found it down, and the sends awaiting it been
+        // resumed already. The new connection is in place before they are, so it is seen here.
+        reconnected = m_connection != nullptr && m_connection->get_state() == websocketpp::session::state::open;
+        // Still CONNECTED means the socket has dropped but its close handler, which starts the reconnect, hasn't run yet
+        if (!reconnected && m_connectionState != ConnectionState::DISCONNECTED) {
+            // Hold on to the message instead of waiting on the caller's thread. It is sent as soon as the connection
+            // is back, or fails as if its response were late once its timeout passes, so the caller may retry.
+            TimerScheduler::TimerId timeoutTimer = m_timerScheduler->Schedule(timeout, [this, requestId] {
+                SocketMessageCallback expiredCallback = TakeSendAwaitingReconnect(requestId);
+                if (expiredCallback) {
+                    expiredCallback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)));
+                }
+            });
+            m_sendsAwaitingReconnect.push_back({requestId, std::string(message, length), std::chrono::steady_clock::now() + timeout, callback, timeoutTimer});
+            return;
+        }
+    }
+
+    if (reconnected) {
+        SendSocketMessageAsync(requestId, message, length, timeout, callback);
+        return;
+    }
+    // Never connected, closed, or out of reconnect retries: nothing is going to bring the connection back
+    callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE)));
+}
+
+void WebSocketppClientWrapper::CancelSend(const std::string &requestId) {
+    SocketMessageCallback cancelledCallback = TakeSendAwaitingReconnect(requestId);
+    if (cancelledCallback) {
+        cancelledCallback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_TIMEOUT)));
     }
+}
+
+std::size_t WebSocketppClientWrapper::GetBufferedAmount() {
+    WebSocketppClientType::connection_ptr connection = GetConnection();
+    return connection == nullptr ? 0 : connection->get_buffered_amount();
+}
 
-    auto waitForReconnectRetryCount = 0;
-    while(!IsConnected()) {
-        // m_connection will be null if reconnect failed after max reties
-        if(m_connection == nullptr || ++waitForReconnectRetryCount >= WAIT_FOR_RECONNECT_MAX_RETRIES) {
-            return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+SocketMessageCallback WebSocketppClientWrapper::TakeSendAwaitingReconnect(const std::string &requestId) {
+    TimerScheduler::TimerId timeoutTimer = TimerScheduler::INVALID_TIMER_ID;
+    SocketMessageCallback callback;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        for (std::vector<SendAwaitingReconnect>::iterator send = m_sendsAwaitingReconnect.begin(); send != m_sendsAwaitingReconnect.end(); ++send) {
+            if (send->requestId == requestId) {
+                timeoutTimer = send->timeoutTimer;
+                callback = std::move(send->callback);
+                m_sendsAwaitingReconnect.erase(send);
+                break;
+            }
         }
-        std::this_thread::sleep_for(std::chrono::seconds(WAIT_FOR_RECONNECT_RETRY_DELAY_SECONDS));
     }
+    m_timerScheduler->Cancel(timeoutTimer);
+    return callback;
+}
 
-    std::future<GenericOutcome> responseFuture;
-    // Lock whenever we make use of 'm_requestIdToPromise' to avoid concurrent writes/reads
+void WebSocketppClientWrapper::ResumeSendsAwaitingReconnect(bool connected) {
+    std::vector<SendAwaitingReconnect> sendsAwaitingReconnect;
     {
-        std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-        // This indicates we've already sent this message, and it's still in flight
-        if (m_requestIdToPromise.count(requestId) > 0) {
-            return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::BAD_REQUEST_EXCEPTION));
+        std::lock_guard<std::mutex> lk(m_lock);
+        sendsAwaitingReconnect.swap(m_sendsAwaitingReconnect);
+    }
+    // Sends taken off the list here are no longer visible to their timeout timers or to CancelSend
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    for (SendAwaitingReconnect &send : sendsAwaitingReconnect) {
+        m_timerScheduler->Cancel(send.timeoutTimer);
+        if (connected) {
+            // Whatever is left of the timeout after the wait, which the timer just cancelled would have ended
+            const std::chrono::milliseconds remaining =
+                std::max(std::chrono::duration_cast<std::chrono::milliseconds>(send.deadline - now), std::chrono::milliseconds(1));
+            SendSocketMessageAsync(send.requestId, send.message.c_str(), send.message.length(), remaining, send.callback);
+        } else {
+            send.callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE)));
         }
+    }
+}
 
-        std::promise<GenericOutcome> responsePromise;
-        responseFuture = responsePromise.get_future();
-        m_requestIdToPromise[requestId] = std::move(responsePromise);
+void WebSocketppClientWrapper::FailRequestsInFlight() {
+    std::vector<uint64_t> requestHandles;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        requestHandles.swap(m_requestHandles);
     }
+    // Their responses went down with the connection. Failed as retriable, they are resent as soon as the reconnect
+    // finishes instead of waiting out their deadlines.
+    for (uint64_t requestHandle : requestHandles) {
+        PendingRequest pendingRequest;
+        if (m_pendingRequests.TryTake(requestHandle, pendingRequest)) {
+            m_timerScheduler->Cancel(pendingRequest.timeoutTimer);
+            pendingRequest.callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)));
+        }
+    }
+}
 
-    GenericOutcome immediateResponse = SendSocketMessageAsync(message);
+void WebSocketppClientWrapper::TrackRequest(uint64_t requestHandle) {
+    std::lock_guard<std::mutex> lk(m_lock);
+    m_requestHandles.push_back(requestHandle);
+}
 
-    if (!immediateResponse.IsSuccess()) {
-        std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-        m_requestIdToPromise.erase(requestId);
-        return immediateResponse;
+void WebSocketppClientWrapper::UntrackRequest(uint64_t requestHandle) {
+    bool drained = false;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        std::vector<uint64_t>::iterator it = std::find(m_requestHandles.begin(), m_requestHandles.end(), requestHandle);
+        if (it != m_requestHandles.end()) {
+            *it = m_requestHandles.back();
+            m_requestHandles.pop_back();
+            return;
+        }
+        it = std::find(m_drainingRequestHandles.begin(), m_drainingRequestHandles.end(), requestHandle);
+        if (it != m_drainingRequestHandles.end()) {
+            *it = m_drainingRequestHandles.back();
+            m_drainingRequestHandles.pop_back();
+            drained = m_drainingRequestHandles.empty() && m_drainingConnection != nullptr;
+        }
+    }
+    // That was the last request the old connection owed an answer to
+    if (drained) {
+        FinishDrain();
+    }
+}
+
+void WebSocketppClientWrapper::StartDrain(const WebSocketppClientType::connection_ptr &oldConnection) {
+    // A refresh that arrives while the previous one is still draining cuts that drain short
+    FinishDrain();
+
+    bool drained;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        if (!m_refreshing) {
+            m_refreshStart = std::chrono::steady_clock::now();
+        }
+        m_drainingConnection = oldConnection;
+        // Every request in flight so far went out on the old connection, new ones go out on the new one
+        m_drainingRequestHandles.swap(m_requestHandles);
+        m_drainingRequestCount = m_drainingRequestHandles.size();
+        drained = m_drainingRequestHandles.empty();
+        if (!drained) {
+            m_drainTimer = m_timerScheduler->Schedule(std::chrono::milliseconds(DRAIN_DEADLINE_MILLIS), [this] { FinishDrain(); });
+        }
+    }
+    if (drained) {
+        FinishDrain();
+    }
+}
+
+void WebSocketppClientWrapper::FinishDrain() {
+    WebSocketppClientType::connection_ptr drainingConnection;
+    std::vector<uint64_t> undrainedRequestHandles;
+    TimerScheduler::TimerId drainTimer;
+    std::size_t drainingRequestCount;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        if (m_drainingConnection == nullptr) {
+            return;
+        }
+        drainingConnection.swap(m_drainingConnection);
+        undrainedRequestHandles.swap(m_drainingRequestHandles);
+        drainTimer = m_drainTimer;
+        m_drainTimer = TimerScheduler::INVALID_TIMER_ID;
+        drainingRequestCount = m_drainingRequestCount;
+    }
+    m_timerScheduler->Cancel(drainTimer);
+
+    // Whatever is still unanswered won't be once the old connection closes. Fail it as retriable, so it is resent
+    // on the new connection now rather than after its deadline.
+    std::size_t droppedRequests = 0;
+    for (uint64_t requestHandle : undrainedRequestHandles) {
+        PendingRequest pendingRequest;
+        if (m_pendingRequests.TryTake(requestHandle, pendingRequest)) {
+            m_timerScheduler->Cancel(pendingRequest.timeoutTimer);
+            pendingRequest.callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE)));
+            droppedRequests++;
+        }
+    }
+
+    if (drainingConnection->get_state() == websocketpp::session::state::open) {
+        websocketpp::lib::error_code closeErrorCode;
+        m_webSocketClient->close(drainingConnection->get_handle(), websocketpp::close::status::going_away, "Websocket client reconnecting", closeErrorCode);
     }
 
-    std::future_status promiseStatus = responseFuture.wait_for(std::chrono::milliseconds(SERVICE_CALL_TIMEOUT_MILLIS));
+    std::chrono::milliseconds refreshDuration;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        refreshDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_refreshStart);
+        m_refreshing = false;
+        m_refreshStats.refreshes++;
+        m_refreshStats.drainedRequests += drainingRequestCount - droppedRequests;
+        m_refreshStats.droppedRequests += droppedRequests;
+        m_refreshStats.lastRefreshDuration = refreshDuration;
+    }
+    printf("Connection refresh finished in %lld ms, %lu in-flight requests answered on the old connection, %lu dropped.\n",
+           static_cast<long long>(refreshDuration.count()), static_cast<unsigned long>(drainingRequestCount - droppedRequests),
+           static_cast<unsigned long>(droppedRequests));
+}
 
-    if (promiseStatus == std::future_status::timeout) {
-        std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-        m_requestIdToPromise.erase(requestId);
-        // If a call times out, retry
-        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE));
+void WebSocketppClientWrapper::OpenStandby() {
+    Uri uri;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        if (!m_warmStandby || m_standbyConnecting || m_standbyConnection != nullptr || m_connectionState != ConnectionState::CONNECTED) {
+            return;
+        }
+        m_standbyConnecting = true;
+        uri = m_uri;
     }
 
-    return responseFuture.get();
+    websocketpp::lib::error_code errorCode;
+    WebSocketppClientType::connection_ptr standbyConnection = m_webSocketClient->get_connection(uri.GetUriString(), errorCode);
+    if (errorCode.value()) {
+        OnStandbyFailed();
+        return;
+    }
+    standbyConnection->set_tcp_pre_init_handler([this](websocketpp::connection_hdl connection) { ResumeTlsSession(connection); });
+    standbyConnection->set_tcp_post_init_handler([this](websocketpp::connection_hdl connection) { RecordTlsHandshake(connection); });
+    standbyConnection->set_open_handler([this](websocketpp::connection_hdl connection) { OnStandbyConnected(connection); });
+    standbyConnection->set_fail_handler([this](websocketpp::connection_hdl) { OnStandbyFailed(); });
+    m_webSocketClient->connect(standbyConnection);
+}
+
+void WebSocketppClientWrapper::OnStandbyConnected(websocketpp::connection_hdl connection) {
+    WebSocketppClientType::connection_ptr standbyConnection = m_webSocketClient->get_con_from_hdl(connection);
+    bool unneeded;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        m_standbyConnecting = false;
+        // Disconnected, or failed over to another standby, while this one was opening
+        unneeded = m_connectionState != ConnectionState::CONNECTED || m_standbyConnection != nullptr;
+        if (!unneeded) {
+            m_standbyConnection = standbyConnection;
+        }
+    }
+    if (unneeded) {
+        websocketpp::lib::error_code closeErrorCode;
+        m_webSocketClient->close(connection, websocketpp::close::status::going_away, "Standby connection not needed", closeErrorCode);
+    }
+}
+
+void WebSocketppClientWrapper::OnStandbyFailed() {
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        m_standbyConnecting = false;
+    }
+    // The active connection is unaffected, so try again later rather than retrying right away
+    printf("Opening standby connection to GameLift websocket server failed. Retrying in %d ms.\n", STANDBY_RETRY_MILLIS);
+    m_timerScheduler->Schedule(std::chrono::milliseconds(STANDBY_RETRY_MILLIS), [this] { OpenStandby(); });
+}
+
+bool WebSocketppClientWrapper::FailOverToStandby(const WebSocketppClientType::connection_ptr &droppedConnection) {
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        if (droppedConnection != m_connection || m_standbyConnection == nullptr
+            || m_standbyConnection->get_state() != websocketpp::session::state::open) {
+            return false;
+        }
+        m_connection = m_standbyConnection;
+        m_standbyConnection = nullptr;
+        m_connectionState = ConnectionState::CONNECTED;
+    }
+    printf("Abnormal Connection Closure, failed over to the standby connection.\n");
+    // Requests the dropped connection owed answers to are resent on the standby, along with anything
+    // held since the socket dropped
+    FailRequestsInFlight();
+    ResumeSendsAwaitingReconnect(true);
+    OpenStandby();
+    if (m_connectedHandler) {
+        m_connectedHandler();
+    }
+    return true;
 }
 
-GenericOutcome WebSocketppClientWrapper::SendSocketMessageAsync(const std::string &message) {
+GenericOutcome WebSocketppClientWrapper::WriteSocketMessage(const char *message, std::size_t length) {
     websocketpp::lib::error_code errorCode;
-    m_webSocketClient->send(m_connection->get_handle(), message.c_str(), websocketpp::frame::opcode::text, errorCode);
+    // Copied straight into the outgoing frame, without an intermediate string
+    WebSocketppClientType::connection_ptr connection = GetConnection();
+    if (connection == nullptr) {
+        return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE));
+    }
+    m_webSocketClient->send(connection->get_handle(), message, length, websocketpp::frame::opcode::text, errorCode);
     if (errorCode.value()) {
         switch (errorCode.value()) {
         case websocketpp::error::no_outgoing_buffers:
-            // If buffers are full, send will fail. Retryable since buffers can free up as messages
-            // send.
+            // Only a transport that bounds its buffers refuses a send. The outbound scheduler normally holds
+            // messages back well before that, from GetBufferedAmount(). Retryable since buffers can free up as
+            // messages send.
             return GenericOutcome(GAMELIFT_ERROR_TYPE::WEBSOCKET_RETRIABLE_SEND_MESSAGE_FAILURE);
         default:
             return GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::WEBSOCKET_SEND_MESSAGE_FAILURE, errorCode.category().message(errorCode.value()).c_str(),
@@ -259,59 +771,193 @@ GenericOutcome WebSocketppClientWrapper::SendSocketMessageAsync(const std::strin
 }
 
 void WebSocketppClientWrapper::Disconnect() {
-    if (m_connection != nullptr) {
+    FinishDrain();
+    WebSocketppClientType::connection_ptr connection;
+    WebSocketppClientType::connection_ptr standbyConnection;
+    {
+        std::lock_guard<std::mutex> lk(m_lock);
+        connection.swap(m_connection);
+        standbyConnection.swap(m_standbyConnection);
+        m_connectionState = ConnectionState::DISCONNECTED;
+    }
+    if (connection != nullptr) {
         websocketpp::lib::error_code ec;
-        m_webSocketClient->close(m_connection->get_handle(), websocketpp::close::status::going_away, "Websocket client closing", ec);
-        m_connection = nullptr;
+        m_webSocketClient->close(connection->get_handle(), websocketpp::close::status::going_away, "Websocket client closing", ec);
+    }
+    if (standbyConnection != nullptr) {
+        websocketpp::lib::error_code ec;
+        m_webSocketClient->close(standbyConnection->get_handle(), websocketpp::close::status::going_away, "Websocket client closing", ec);
+    }
+}
+
+void WebSocketppClientWrapper::RegisterGameLiftCallback(const std::string &gameLiftEvent, const GameLiftEventHandler &callback) {
+    std::size_t actionHash = HashAction(gameLiftEvent.c_str(), gameLiftEvent.length());
+    for (EventHandlerEntry &entry : m_eventHandlers) {
+        if (entry.actionHash == actionHash && entry.action == gameLiftEvent) {
+            entry.handler = callback;
+            return;
+        }
+    }
+    m_eventHandlers.push_back({actionHash, gameLiftEvent, callback});
+}
+
+const GameLiftEventHandler *WebSocketppClientWrapper::FindEventHandler(const char *action, std::size_t actionLength) const {
+    std::size_t actionHash = HashAction(action, actionLength);
+    for (const EventHandlerEntry &entry : m_eventHandlers) {
+        if (entry.actionHash == actionHash && entry.action.compare(0, std::string::npos, action, actionLength) == 0) {
+            return &entry.handler;
+        }
     }
+    return nullptr;
 }
 
-void WebSocketppClientWrapper::RegisterGameLiftCallback(const std::string &gameLiftEvent, const std::function<GenericOutcome(std::string)> &callback) {
-    m_eventHandlers[gameLiftEvent] = callback;
+std::size_t WebSocketppClientWrapper::HashAction(const char *action, std::size_t actionLength) {
+    // FNV-1a
+    std::size_t hash = static_cast<std::size_t>(2166136261u);
+    for (std::size_t i = 0; i < actionLength; i++) {
+        hash ^= static_cast<unsigned char>(action[i]);
+        hash *= static_cast<std::size_t>(16777619u);
+    }
+    return hash;
 }
 
 bool WebSocketppClientWrapper::IsConnected() {
     // m_connection is nullptr if 'm_webSocketClient->get_connection()' fails
-    return m_connection != nullptr && m_connection->get_state() == websocketpp::session::state::open;
+    WebSocketppClientType::connection_ptr connection = GetConnection();
+    return connection != nullptr && connection->get_state() == websocketpp::session::state::open;
+}
+
+void WebSocketppClientWrapper::SetTimerScheduler(const std::shared_ptr<TimerScheduler> &timerScheduler) {
+    m_timerScheduler = timerScheduler;
+    m_ownsTimerScheduler = false;
+}
+
+void WebSocketppClientWrapper::SetPollDriven() { m_pollDriven = true; }
+
+void WebSocketppClientWrapper::SetLowFootprint() { m_lowFootprint = true; }
+
+void WebSocketppClientWrapper::SetWarmStandby() { m_warmStandby = true; }
+
+void WebSocketppClientWrapper::SetConnectedHandler(const std::function<void()> &handler) { m_connectedHandler = handler; }
+
+void WebSocketppClientWrapper::SetLatencyEstimator(const std::shared_ptr<LatencyEstimator> &latencyEstimator) { m_latencyEstimator = latencyEstimator; }
+
+void WebSocketppClientWrapper::GetConnectTimings(Aws::GameLift::Server::Model::StartupTimings &timings) {
+    std::lock_guard<std::mutex> lk(m_lock);
+    timings.SetConnectMillis(m_connectTimings.GetConnectMillis());
+    timings.SetTlsMillis(m_connectTimings.GetTlsMillis());
+    timings.SetUpgradeMillis(m_connectTimings.GetUpgradeMillis());
+}
+
+std::size_t WebSocketppClientWrapper::Poll(std::chrono::microseconds budget) {
+    if (!m_pollDriven) {
+        return 0;
+    }
+
+    const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + budget;
+    std::size_t handlersRun = 0;
+    do {
+        // poll_one never waits: it runs one ready handler, or returns 0 if there is none
+        const std::size_t ran = m_webSocketClient->poll_one();
+        if (ran == 0) {
+            break;
+        }
+        handlersRun += ran;
+    } while (std::chrono::steady_clock::now() < deadline);
+
+    if (m_ownsTimerScheduler) {
+        handlersRun += m_timerScheduler->RunDueTimers(std::chrono::steady_clock::now());
+    }
+    return handlersRun;
+}
+
+GenericOutcome WebSocketppClientWrapper::AwaitOutcome(std::future<GenericOutcome> &future) {
+    if (!m_pollDriven) {
+        return future.get();
+    }
+
+    // Nothing else runs the socket or the timers the outcome depends on, so drive them from the waiting thread.
+    // A Poll on another thread may complete it too, in which case the wait returns early.
+    while (future.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready) {
+        m_webSocketClient->poll();
+        if (m_timerScheduler) {
+            m_timerScheduler->RunDueTimers(std::chrono::steady_clock::now());
+        }
+        future.wait_for(std::chrono::milliseconds(POLL_WAIT_MILLIS));
+    }
+    return future.get();
+}
+
+WebSocketppClientWrapper::ConnectionRefreshStats WebSocketppClientWrapper::GetRefreshStats() {
+    std::lock_guard<std::mutex> lk(m_lock);
+    return m_refreshStats;
+}
+
+WebSocketppClientWrapper::ConnectionState WebSocketppClientWrapper::GetConnectionState() {
+    std::lock_guard<std::mutex> lk(m_lock);
+    return m_connectionState;
+}
+
+WebSocketppClientType::connection_ptr WebSocketppClientWrapper::GetConnection() {
+    std::lock_guard<std::mutex> lk(m_lock);
+    return m_connection;
 }
 
 void WebSocketppClientWrapper::OnConnected(websocketpp::connection_hdl connection) {
-    // aquire lock and set condition variables (let main thread know connection is successful)
+    // "Flip" traffic from our old websocket to our new websocket. The old one is closed once it has drained.
+    WebSocketppClientType::connection_ptr newConnection = m_webSocketClient->get_con_from_hdl(connection);
+    WebSocketppClientType::connection_ptr oldConnection;
+    WebSocketppClientType::connection_ptr oldStandbyConnection;
     {
         std::lock_guard<std::mutex> lk(m_lock);
-        // set the state change variables and notify the thread that is connecting
-        m_connectionStateChanged = true;
+        oldConnection = m_connection;
+        m_connection = newConnection;
+        m_connectionState = ConnectionState::CONNECTED;
+        m_fail_error_code.clear();
+        // A standby opened before a refresh was authenticated with the old token, a new one is opened once connected
+        oldStandbyConnection.swap(m_standbyConnection);
+    }
+    if (oldStandbyConnection != nullptr) {
+        websocketpp::lib::error_code closeErrorCode;
+        m_webSocketClient->close(oldStandbyConnection->get_handle(), websocketpp::close::status::going_away, "Standby connection replaced", closeErrorCode);
+    }
+    if (oldConnection && oldConnection->get_state() == websocketpp::session::state::open) {
+        StartDrain(oldConnection);
+    } else {
+        std::lock_guard<std::mutex> lk(m_lock);
+        m_refreshing = false;
     }
-    m_cond.notify_one();
 }
 
 void WebSocketppClientWrapper::OnError(websocketpp::connection_hdl connection) {
     auto con = m_webSocketClient->get_con_from_hdl(connection);
 
-    // aquire lock and set condition variables (let main thread know an error has occurred)
-    {
-        std::lock_guard<std::mutex> lk(m_lock);
-        // set the state change variables and notify the thread that is connecting
-        m_connectionStateChanged = true;
-        m_fail_error_code = con->get_ec();
-        m_fail_response_code = con->get_response_code();
-    }
-    m_cond.notify_one();
+    // Record why the attempt failed, for the outcome reported once the retries run out
+    std::lock_guard<std::mutex> lk(m_lock);
+    m_fail_error_code = con->get_ec();
+    m_fail_response_code = con->get_response_code();
 }
 
 void WebSocketppClientWrapper::OnMessage(websocketpp::connection_hdl connection, websocketpp::config::asio_client::message_type::ptr msg) {
-    std::string message = msg->get_payload();
-
-    ResponseMessage responseMessage;
-    Message &gameLiftMessage = responseMessage;
-    if (!gameLiftMessage.Deserialize(message)) {
+    // Parse the frame once, in place. The handlers below receive the parsed document instead of
+    // re-parsing the payload. Every socket thread serves every open connection, and a refresh or a
+    // warm standby keeps two open, so frames from different connections do share this parser. That
+    // is safe only because a frame is parsed and done with inside this one call, and nothing here
+    // runs the socket's event loop, so the next frame on this thread can't start before then.
+    static thread_local InboundFrameParser frameParser;
+    const rapidjson::Value *parsedMessage = frameParser.Parse(msg->get_raw_payload());
+    if (parsedMessage == nullptr) {
         return;
     }
+    const rapidjson::Value &document = *parsedMessage;
+
+    ResponseMessage responseMessage(INBOUND_MESSAGE);
+    Message &gameLiftMessage = responseMessage;
+    gameLiftMessage.Deserialize(document);
 
     const std::string &action = responseMessage.GetAction();
     const std::string &requestId = responseMessage.GetRequestId();
     const int statusCode = responseMessage.GetStatusCode();
-    const std::string &errorMessage = responseMessage.GetErrorMessage();
 
     // Default to a success response with no result pointer
     GenericOutcome response(nullptr);
@@ -319,30 +965,69 @@ void WebSocketppClientWrapper::OnMessage(websocketpp::connection_hdl connection,
     // RequestId will be empty when we get a message not associated with a request, in which case we
     // don't expect a 200 status code either.
     if (statusCode != OK_STATUS_CODE && !requestId.empty()) {
-        response = GenericOutcome(GameLiftError(statusCode, message.c_str()));
+        // The payload was overwritten by the in situ parse, so write the error response back out
+        rapidjson::StringBuffer &errorMessage = JsonHelper::GetThreadLocalBuffer();
+        rapidjson::Writer<rapidjson::StringBuffer> writer(errorMessage);
+        document.Accept(writer);
+        response = GenericOutcome(GameLiftError(statusCode, errorMessage.GetString()));
     } else {
         // If we got a success response, and we have a special event handler for this action, invoke
         // it to get the real parsed result
-        if (m_eventHandlers.count(action)) {
-            response = m_eventHandlers[action](message);
+        const GameLiftEventHandler *eventHandler = FindEventHandler(action.c_str(), action.length());
+        if (eventHandler != nullptr) {
+            response = (*eventHandler)(document);
         }
     }
 
-    // Lock whenever we make use of 'm_requestIdToPromise' to avoid concurrent writes/reads
-    std::lock_guard<std::mutex> lock(m_requestToPromiseLock);
-    if (m_requestIdToPromise.count(requestId) > 0) {
-        m_requestIdToPromise[requestId].set_value(response);
-        m_requestIdToPromise.erase(requestId);
-    }
+    CompletePendingRequest(requestId, response, action);
 }
 
-websocketpp::lib::shared_ptr<asio::ssl::context> WebSocketppClientWrapper::OnTlsInit(websocketpp::connection_hdl hdl) {
-    websocketpp::lib::shared_ptr<asio::ssl::context> contextPtr(new asio::ssl::context(asio::ssl::context::tlsv12));
+websocketpp::lib::shared_ptr<asio::ssl::context> WebSocketppClientWrapper::OnTlsInit(websocketpp::connection_hdl hdl) { return m_sharedTlsContext; }
+
+websocketpp::lib::shared_ptr<asio::ssl::context> WebSocketppClientWrapper::CreateTlsContext() {
+    // TLS 1.3 where the endpoint and OpenSSL support it, and TLS 1.2 otherwise
+    websocketpp::lib::shared_ptr<asio::ssl::context> contextPtr(new asio::ssl::context(asio::ssl::context::tls_client));
+    contextPtr->set_options(asio::ssl::context::default_workarounds | asio::ssl::context::no_sslv2 | asio::ssl::context::no_sslv3 |
+                            asio::ssl::context::no_tlsv1 | asio::ssl::context::no_tlsv1_1);
+    m_tlsSessionCache->Attach(contextPtr->native_handle());
     return contextPtr;
 }
 
+void WebSocketppClientWrapper::ResumeTlsSession(websocketpp::connection_hdl connection) {
+    websocketpp::lib::error_code errorCode;
+    WebSocketppClientType::connection_ptr connectionPointer = m_webSocketClient->get_con_from_hdl(connection, errorCode);
+    if (!errorCode) {
+        m_tlsSessionCache->Resume(connectionPointer->get_socket().native_handle());
+    }
+}
+
+void WebSocketppClientWrapper::RecordTlsHandshake(websocketpp::connection_hdl connection) {
+    websocketpp::lib::error_code errorCode;
+    WebSocketppClientType::connection_ptr connectionPointer = m_webSocketClient->get_con_from_hdl(connection, errorCode);
+    if (!errorCode) {
+        m_tlsSessionCache->RecordHandshake(connectionPointer->get_socket().native_handle());
+    }
+}
+
 void WebSocketppClientWrapper::OnClose(websocketpp::connection_hdl connection) {
     auto connectionPointer = m_webSocketClient->get_con_from_hdl(connection);
+    {
+        std::unique_lock<std::mutex> lk(m_lock);
+        if (connectionPointer == m_drainingConnection) {
+            // A connection a refresh replaced, closed before it drained. Traffic has already moved to its replacement.
+            lk.unlock();
+            FinishDrain();
+            return;
+        }
+        if (connectionPointer == m_standbyConnection) {
+            // Nothing was sent on it, so only the standby needs replacing
+            m_standbyConnection = nullptr;
+            lk.unlock();
+            printf("Standby connection to GameLift websocket server lost. Reopening in %d ms.\n", STANDBY_RETRY_MILLIS);
+            m_timerScheduler->Schedule(std::chrono::milliseconds(STANDBY_RETRY_MILLIS), [this] { OpenStandby(); });
+            return;
+        }
+    }
     auto localCloseCode = connectionPointer->get_local_close_code();
     auto remoteCloseCode = connectionPointer->get_remote_close_code();
     bool isNormalClosure = localCloseCode == websocketpp::close::status::normal
@@ -354,10 +1039,39 @@ void WebSocketppClientWrapper::OnClose(websocketpp::connection_hdl connection) {
            websocketpp::close::status::get_string(remoteCloseCode).c_str());
     if(isNormalClosure) {
         printf("Normal Connection Closure, skipping reconnect.\n");
+        bool disconnected;
+        {
+            std::lock_guard<std::mutex> lk(m_lock);
+            // A refresh already underway still brings up a replacement, so sends keep waiting for that
+            if (m_connectionState == ConnectionState::CONNECTED && connectionPointer == m_connection) {
+                m_connectionState = m_refreshing ? ConnectionState::CONNECTING : ConnectionState::DISCONNECTED;
+            }
+            disconnected = m_connectionState == ConnectionState::DISCONNECTED;
+        }
+        if (disconnected) {
+            ResumeSendsAwaitingReconnect(false);
+        }
         return;
     } else {
+        if (FailOverToStandby(connectionPointer)) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lk(m_lock);
+            if (m_connectionState == ConnectionState::RECONNECTING) {
+                return;
+            }
+            m_connectionState = ConnectionState::RECONNECTING;
+        }
         printf("Abnormal Connection Closure, reconnecting.\n");
-        WebSocketppClientWrapper::Connect(m_uri);
+        FailRequestsInFlight();
+        // Reconnect in the background rather than blocking this socket thread through the retries. Sends made
+        // meanwhile are held and go out the moment it succeeds.
+        ConnectWithRetries(m_uri, [](const GenericOutcome &outcome) {
+            if (!outcome.IsSuccess()) {
+                printf("Reconnecting to GameLift websocket server failed.\n");
+            }
+        });
     }
 }
 
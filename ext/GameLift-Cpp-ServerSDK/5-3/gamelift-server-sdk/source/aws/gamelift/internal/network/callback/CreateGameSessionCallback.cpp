@@ -19,8 +19,8 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-GenericOutcome CreateGameSessionCallback::OnStartGameSession(const std::string &data) {
-    CreateGameSessionMessage createGameSessionMessage;
+GenericOutcome CreateGameSessionCallback::OnStartGameSession(const rapidjson::Value &data) {
+    CreateGameSessionMessage createGameSessionMessage(INBOUND_MESSAGE);
     Message &message = createGameSessionMessage;
     message.Deserialize(data);
 
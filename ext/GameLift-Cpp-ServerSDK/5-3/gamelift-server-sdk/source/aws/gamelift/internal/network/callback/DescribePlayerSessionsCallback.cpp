@@ -10,20 +10,22 @@
  *
  */
 
-#include <aws/gamelift/internal/model/response/WebSocketDescribePlayerSessionsResponse.h>
+#include <aws/gamelift/internal/model/adapter/DescribePlayerSessionsDecoder.h>
 #include <aws/gamelift/internal/network/callback/DescribePlayerSessionsCallback.h>
+#include <aws/gamelift/server/model/DescribePlayerSessionsResult.h>
 
 using namespace Aws::GameLift;
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome DescribePlayerSessionsCallback::OnDescribePlayerSessions(const std::string &data) {
-    WebSocketDescribePlayerSessionsResponse *describePlayerSessionsResponse = new WebSocketDescribePlayerSessionsResponse();
-    Message *message = describePlayerSessionsResponse;
-    message->Deserialize(data);
+GenericOutcome DescribePlayerSessionsCallback::OnDescribePlayerSessions(const rapidjson::Value &data) {
+    // Decodes straight into the public result rather than going through WebSocketPlayerSession
+    Server::Model::DescribePlayerSessionsResult *describePlayerSessionsResult = new Server::Model::DescribePlayerSessionsResult();
+    DescribePlayerSessionsDecoder decoder(*describePlayerSessionsResult);
+    data.Accept(decoder);
 
-    return GenericOutcome(describePlayerSessionsResponse);
+    return GenericOutcome(describePlayerSessionsResult);
 }
 } // namespace Internal
 } // namespace GameLift
@@ -18,8 +18,8 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome GetComputeCertificateCallback::OnGetComputeCertificateCallback(const std::string &data) {
-    auto *response = new WebSocketGetComputeCertificateResponse();
+GenericOutcome GetComputeCertificateCallback::OnGetComputeCertificateCallback(const rapidjson::Value &data) {
+    auto *response = new WebSocketGetComputeCertificateResponse(INBOUND_MESSAGE);
     Message *message = response;
     message->Deserialize(data);
 
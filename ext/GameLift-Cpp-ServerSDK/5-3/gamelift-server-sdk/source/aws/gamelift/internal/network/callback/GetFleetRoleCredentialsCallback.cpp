@@ -18,8 +18,8 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome GetFleetRoleCredentialsCallback::OnGetFleetRoleCredentials(const std::string &data) {
-    auto *getFleetRoleCredentialsResponse = new WebSocketGetFleetRoleCredentialsResponse();
+GenericOutcome GetFleetRoleCredentialsCallback::OnGetFleetRoleCredentials(const rapidjson::Value &data) {
+    auto *getFleetRoleCredentialsResponse = new WebSocketGetFleetRoleCredentialsResponse(INBOUND_MESSAGE);
     Message *message = getFleetRoleCredentialsResponse;
     message->Deserialize(data);
 
@@ -18,8 +18,8 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome RefreshConnectionCallback::OnRefreshConnection(const std::string &data) {
-    RefreshConnectionMessage refreshConnectionMessage;
+GenericOutcome RefreshConnectionCallback::OnRefreshConnection(const rapidjson::Value &data) {
+    RefreshConnectionMessage refreshConnectionMessage(INBOUND_MESSAGE);
     Message &message = refreshConnectionMessage;
     message.Deserialize(data);
 
@@ -18,8 +18,8 @@ using namespace Aws::GameLift;
 namespace Aws {
 namespace GameLift {
 namespace Internal {
-GenericOutcome StartMatchBackfillCallback::OnStartMatchBackfill(const std::string &data) {
-    WebSocketStartMatchBackfillResponse *startMatchBackfillResponse = new WebSocketStartMatchBackfillResponse();
+GenericOutcome StartMatchBackfillCallback::OnStartMatchBackfill(const rapidjson::Value &data) {
+    WebSocketStartMatchBackfillResponse *startMatchBackfillResponse = new WebSocketStartMatchBackfillResponse(INBOUND_MESSAGE);
     Message *message = startMatchBackfillResponse;
     message->Deserialize(data);
 
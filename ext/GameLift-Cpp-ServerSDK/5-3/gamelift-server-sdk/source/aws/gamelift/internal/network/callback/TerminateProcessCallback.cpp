@@ -19,8 +19,8 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-GenericOutcome TerminateProcessCallback::OnTerminateProcess(const std::string &data) {
-    TerminateProcessMessage terminateProcessMessage;
+GenericOutcome TerminateProcessCallback::OnTerminateProcess(const rapidjson::Value &data) {
+    TerminateProcessMessage terminateProcessMessage(INBOUND_MESSAGE);
     Message &message = terminateProcessMessage;
     message.Deserialize(data);
 
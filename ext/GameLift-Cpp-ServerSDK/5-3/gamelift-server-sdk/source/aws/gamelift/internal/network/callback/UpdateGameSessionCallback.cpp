@@ -19,8 +19,8 @@ namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-GenericOutcome UpdateGameSessionCallback::OnUpdateGameSession(const std::string &data) {
-    UpdateGameSessionMessage updateGameSessionMessage;
+GenericOutcome UpdateGameSessionCallback::OnUpdateGameSession(const rapidjson::Value &data) {
+    UpdateGameSessionMessage updateGameSessionMessage(INBOUND_MESSAGE);
     Message &message = updateGameSessionMessage;
     message.Deserialize(data);
 
@@ -0,0 +1,95 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include <aws/gamelift/internal/retry/CircuitBreaker.h>
+#include <cstdio>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+constexpr const int CircuitBreaker::DEFAULT_FAILURE_THRESHOLD;
+constexpr const int CircuitBreaker::DEFAULT_OPEN_MILLIS;
+constexpr const int CircuitBreaker::DEFAULT_HALF_OPEN_PROBES;
+
+CircuitBreaker::CircuitBreaker(int failureThreshold, std::chrono::milliseconds openDuration, int halfOpenProbes)
+    : m_failureThreshold(failureThreshold), m_openDuration(openDuration), m_halfOpenProbes(halfOpenProbes), m_state(State::CLOSED), m_consecutiveFailures(0),
+      m_probesInFlight(0), m_timesOpened(0), m_rejectedAttempts(0) {}
+
+bool CircuitBreaker::TryAcquire(std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_state == State::OPEN && now - m_openedAt >= m_openDuration) {
+        m_state = State::HALF_OPEN;
+        m_probesInFlight = 0;
+    }
+    switch (m_state) {
+    case State::CLOSED:
+        return true;
+    case State::HALF_OPEN:
+        if (m_probesInFlight < m_halfOpenProbes) {
+            m_probesInFlight++;
+            return true;
+        }
+        break;
+    case State::OPEN:
+        break;
+    }
+    m_rejectedAttempts++;
+    return false;
+}
+
+void CircuitBreaker::RecordSuccess() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_consecutiveFailures = 0;
+    if (m_state == State::HALF_OPEN) {
+        printf("GameLift service calls are succeeding again.\n");
+        m_state = State::CLOSED;
+    }
+}
+
+void CircuitBreaker::RecordFailure(std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_consecutiveFailures++;
+    // A failed probe, or the threshold reached while closed. Attempts that were let through before the breaker
+    // opened and fail afterwards don't extend it.
+    if (m_state == State::HALF_OPEN || (m_state == State::CLOSED && m_consecutiveFailures >= m_failureThreshold)) {
+        Open(now);
+    }
+}
+
+void CircuitBreaker::Release() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_state == State::HALF_OPEN && m_probesInFlight > 0) {
+        m_probesInFlight--;
+    }
+}
+
+CircuitBreaker::CircuitBreakerStats CircuitBreaker::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    CircuitBreakerStats stats;
+    stats.state = m_state;
+    stats.timesOpened = m_timesOpened;
+    stats.rejectedAttempts = m_rejectedAttempts;
+    return stats;
+}
+
+void CircuitBreaker::Open(std::chrono::steady_clock::time_point now) {
+    if (m_state == State::CLOSED) {
+        printf("GameLift service calls are failing, holding off for %d ms.\n", static_cast<int>(m_openDuration.count()));
+    }
+    m_state = State::OPEN;
+    m_openedAt = now;
+    m_timesOpened++;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -11,24 +11,21 @@
  */
 
 #include <aws/gamelift/internal/retry/GeometricBackoffRetryStrategy.h>
-#include <thread>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-void GeometricBackoffRetryStrategy::apply(const std::function<bool(void)> &callable) {
+int GeometricBackoffRetryStrategy::getRetryDelayMillis(int retry) {
+    if (retry >= m_maxRetries) {
+        return -1;
+    }
     int retryIntervalSeconds = m_initialRetryIntervalSeconds;
-    for (int i = 0; i < m_maxRetries; ++i) {
-        bool success = callable();
-        if (success) {
-            break;
-        } else {
-            std::this_thread::sleep_for(std::chrono::seconds(retryIntervalSeconds));
-            retryIntervalSeconds *= m_retryFactor;
-            retryIntervalSeconds = retryIntervalSeconds > m_maxRetryIntervalSeconds ? m_maxRetryIntervalSeconds : retryIntervalSeconds;
-        }
+    for (int i = 1; i < retry && retryIntervalSeconds < m_maxRetryIntervalSeconds; ++i) {
+        retryIntervalSeconds *= m_retryFactor;
     }
+    retryIntervalSeconds = retryIntervalSeconds > m_maxRetryIntervalSeconds ? m_maxRetryIntervalSeconds : retryIntervalSeconds;
+    return retryIntervalSeconds * 1000;
 }
 
 } // namespace Internal
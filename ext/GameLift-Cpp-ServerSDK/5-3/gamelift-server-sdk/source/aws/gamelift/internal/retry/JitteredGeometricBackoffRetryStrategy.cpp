@@ -11,28 +11,21 @@
  */
 
 #include <aws/gamelift/internal/retry/JitteredGeometricBackoffRetryStrategy.h>
-#include <random>
-#include <thread>
 
 namespace Aws {
 namespace GameLift {
 namespace Internal {
 
-void JitteredGeometricBackoffRetryStrategy::apply(const std::function<bool(void)> &callable) {
+int JitteredGeometricBackoffRetryStrategy::getRetryDelayMillis(int retry) {
+    if (retry >= m_maxRetries) {
+        return -1;
+    }
     int retryIntervalMs = m_initialRetryIntervalMs;
-    std::random_device rd;
-    std::mt19937 randGenerator(rd());
-    for (int i = 0; i < m_maxRetries; ++i) {
-        bool success = callable();
-        if (success) {
-            break;
-        } else {
-            std::uniform_int_distribution<> intervalRange(m_minRetryDelayMs, retryIntervalMs);
-            int currentInterval = intervalRange(randGenerator);
-            std::this_thread::sleep_for(std::chrono::milliseconds(currentInterval));
-            retryIntervalMs *= m_retryFactor;
-        }
+    for (int i = 1; i < retry; ++i) {
+        retryIntervalMs *= m_retryFactor;
     }
+    std::uniform_int_distribution<> intervalRange(m_minRetryDelayMs, retryIntervalMs);
+    return intervalRange(m_randGenerator);
 }
 
 } // namespace Internal
@@ -0,0 +1,52 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+#include <aws/gamelift/internal/retry/RetryBudget.h>
+#include <algorithm>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+constexpr const int RetryBudget::DEFAULT_MAX_TOKENS;
+constexpr const int RetryBudget::DEFAULT_SUCCESSES_PER_TOKEN;
+
+RetryBudget::RetryBudget(int maxTokens, int successesPerToken)
+    : m_maxTokens(maxTokens), m_tokensPerSuccess(1.0 / successesPerToken), m_tokens(maxTokens), m_retriesAllowed(0), m_retriesDenied(0) {}
+
+void RetryBudget::RecordSuccess() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tokens = std::min(m_maxTokens, m_tokens + m_tokensPerSuccess);
+}
+
+bool RetryBudget::TryAcquireRetry() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_tokens < 1.0) {
+        m_retriesDenied++;
+        return false;
+    }
+    m_tokens -= 1.0;
+    m_retriesAllowed++;
+    return true;
+}
+
+RetryBudget::RetryBudgetStats RetryBudget::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    RetryBudgetStats stats;
+    stats.retriesAllowed = m_retriesAllowed;
+    stats.retriesDenied = m_retriesDenied;
+    stats.tokens = m_tokens;
+    return stats;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,93 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/retry/RetryStrategy.h>
+#include <thread>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+void RetryStrategy::apply(const std::function<bool(void)> &callable) {
+    for (int retry = 0;; ++retry) {
+        if (m_circuitBreaker && !m_circuitBreaker->TryAcquire()) {
+            break;
+        }
+        int retryDelayMillis = onAttemptComplete(callable() ? AttemptResult::ANSWERED : AttemptResult::FAILED_RETRIABLE, retry);
+        if (retryDelayMillis < 0) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(retryDelayMillis));
+    }
+}
+
+void RetryStrategy::applyAsync(const std::shared_ptr<RetryStrategy> &retryStrategy, TimerScheduler &timerScheduler, const AsyncCallable &callable,
+                               const std::function<void(AttemptResult)> &onComplete) {
+    attemptAsync(retryStrategy, timerScheduler, callable, onComplete, 0);
+}
+
+void RetryStrategy::attemptAsync(const std::shared_ptr<RetryStrategy> &retryStrategy, TimerScheduler &timerScheduler, const AsyncCallable &callable,
+                                 const std::function<void(AttemptResult)> &onComplete, int retry) {
+    if (retryStrategy->m_circuitBreaker && !retryStrategy->m_circuitBreaker->TryAcquire()) {
+        onComplete(AttemptResult::NOT_SENT);
+        return;
+    }
+    TimerScheduler *scheduler = &timerScheduler;
+    callable([retryStrategy, scheduler, callable, onComplete, retry](AttemptResult result) {
+        int retryDelayMillis = retryStrategy->onAttemptComplete(result, retry);
+        if (retryDelayMillis < 0) {
+            onComplete(result);
+            return;
+        }
+        scheduler->Schedule(std::chrono::milliseconds(retryDelayMillis), [retryStrategy, scheduler, callable, onComplete, retry] {
+            attemptAsync(retryStrategy, *scheduler, callable, onComplete, retry + 1);
+        });
+    });
+}
+
+int RetryStrategy::onAttemptComplete(AttemptResult result, int retry) {
+    switch (result) {
+    case AttemptResult::ANSWERED:
+        if (m_circuitBreaker) {
+            m_circuitBreaker->RecordSuccess();
+        }
+        if (m_retryBudget) {
+            m_retryBudget->RecordSuccess();
+        }
+        return -1;
+    case AttemptResult::FAILED:
+        if (m_circuitBreaker) {
+            m_circuitBreaker->RecordFailure();
+        }
+        return -1;
+    case AttemptResult::NOT_SENT:
+        // Says nothing about the service, but a probe the breaker let through is handed back for another attempt
+        if (m_circuitBreaker) {
+            m_circuitBreaker->Release();
+        }
+        return -1;
+    case AttemptResult::FAILED_RETRIABLE:
+        if (m_circuitBreaker) {
+            m_circuitBreaker->RecordFailure();
+        }
+        break;
+    }
+    int retryDelayMillis = getRetryDelayMillis(retry + 1);
+    if (retryDelayMillis >= 0 && m_retryBudget && !m_retryBudget->TryAcquireRetry()) {
+        return -1;
+    }
+    return retryDelayMillis;
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -0,0 +1,167 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <aws/gamelift/internal/util/CallbackExecutor.h>
+#include <cstdio>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+constexpr const int CallbackExecutor::DEFAULT_MAX_CONCURRENT_CALLBACKS;
+constexpr const int CallbackExecutor::DEFAULT_SLOW_CALLBACK_MILLIS;
+
+CallbackExecutor::CallbackExecutor(std::shared_ptr<TimerScheduler> timerScheduler) : m_state(std::make_shared<SharedState>()) {
+    m_state->timerScheduler = timerScheduler;
+    m_state->slowCallbackThreshold = std::chrono::milliseconds(DEFAULT_SLOW_CALLBACK_MILLIS);
+    m_state->stopping = false;
+    m_state->stats = CallbackStats{0, 0, std::chrono::microseconds(0), std::chrono::microseconds(0)};
+}
+
+CallbackExecutor::~CallbackExecutor() { Stop(); }
+
+void CallbackExecutor::Start(int maxConcurrentCallbacks, std::chrono::milliseconds slowCallbackThreshold) {
+    std::lock_guard<std::mutex> workersLock(m_workersMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        if (!m_workers.empty() || m_state->stopping) {
+            return;
+        }
+        m_state->slowCallbackThreshold = slowCallbackThreshold.count() > 0 ? slowCallbackThreshold : std::chrono::milliseconds(DEFAULT_SLOW_CALLBACK_MILLIS);
+    }
+
+    const int workerCount = maxConcurrentCallbacks > 0 ? maxConcurrentCallbacks : DEFAULT_MAX_CONCURRENT_CALLBACKS;
+    std::shared_ptr<SharedState> state = m_state;
+    for (int i = 0; i < workerCount; i++) {
+        m_workers.emplace_back([state] { RunWorker(state); });
+    }
+}
+
+void CallbackExecutor::Stop() {
+    std::deque<QueuedCallback> discardedCallbacks;
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> workersLock(m_workersMutex);
+        workers.swap(m_workers);
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->stopping = true;
+        discardedCallbacks.swap(m_state->queue);
+    }
+    m_state->callbackQueued.notify_all();
+    for (std::thread &worker : workers) {
+        if (worker.get_id() == std::this_thread::get_id()) {
+            // Stopped from one of our own callbacks, e.g. an OnProcessTerminate that calls Destroy().
+            worker.detach();
+        } else {
+            worker.join();
+        }
+    }
+    // discardedCallbacks is destroyed here, outside the lock, in case a callback's captures call back into the executor.
+}
+
+void CallbackExecutor::Submit(const char *name, std::function<void()> callback) {
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        if (m_state->stopping) {
+            return;
+        }
+        m_state->queue.push_back(QueuedCallback{name, std::move(callback)});
+    }
+    m_state->callbackQueued.notify_one();
+}
+
+std::size_t CallbackExecutor::RunQueuedCallbacks() {
+    // Hold on to the state rather than the executor, a callback may destroy it
+    std::shared_ptr<SharedState> state = m_state;
+    std::size_t callbacksRun = 0;
+    std::unique_lock<std::mutex> lock(state->mutex);
+    // Callbacks queued while these run wait for the next call, so the caller always gets control back
+    std::size_t remaining = state->queue.size();
+    while (remaining > 0 && !state->stopping && !state->queue.empty()) {
+        QueuedCallback queuedCallback = std::move(state->queue.front());
+        state->queue.pop_front();
+        remaining--;
+        lock.unlock();
+        RunCallback(*state, queuedCallback);
+        callbacksRun++;
+        lock.lock();
+    }
+    return callbacksRun;
+}
+
+CallbackExecutor::CallbackStats CallbackExecutor::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->stats;
+}
+
+std::size_t CallbackExecutor::GetQueuedCallbackCount() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->queue.size();
+}
+
+void CallbackExecutor::RunWorker(const std::shared_ptr<SharedState> &state) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (true) {
+        state->callbackQueued.wait(lock, [&state] { return state->stopping || !state->queue.empty(); });
+        if (state->stopping) {
+            return;
+        }
+        QueuedCallback queuedCallback = std::move(state->queue.front());
+        state->queue.pop_front();
+        lock.unlock();
+        RunCallback(*state, queuedCallback);
+        lock.lock();
+    }
+}
+
+void CallbackExecutor::RunCallback(SharedState &state, QueuedCallback &queuedCallback) {
+    // Report a callback that doesn't return while it is still running, it may never return at all
+    TimerScheduler::TimerId slowCallbackTimer = TimerScheduler::INVALID_TIMER_ID;
+    if (state.timerScheduler) {
+        const char *name = queuedCallback.name;
+        const long long thresholdMillis = static_cast<long long>(state.slowCallbackThreshold.count());
+        slowCallbackTimer = state.timerScheduler->Schedule(state.slowCallbackThreshold, [name, thresholdMillis] {
+            printf("Callback %s has been running for more than %lld ms.\n", name, thresholdMillis);
+        });
+    }
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    queuedCallback.callback();
+    const std::chrono::microseconds executionTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    if (state.timerScheduler) {
+        state.timerScheduler->Cancel(slowCallbackTimer);
+    }
+    // Release the callback's captures before the next one starts
+    queuedCallback.callback = nullptr;
+
+    const bool slow = executionTime > state.slowCallbackThreshold;
+    if (slow) {
+        printf("Callback %s took %lld ms.\n", queuedCallback.name, static_cast<long long>(executionTime.count() / 1000));
+    }
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.stats.completedCallbacks++;
+    if (slow) {
+        state.stats.slowCallbacks++;
+    }
+    state.stats.totalExecutionTime += executionTime;
+    if (executionTime > state.stats.maxExecutionTime) {
+        state.stats.maxExecutionTime = executionTime;
+    }
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -9,12 +9,17 @@
  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
  *
  */
+#include <aws/gamelift/internal/network/InboundFrameParser.h>
 #include <aws/gamelift/internal/util/JsonHelper.h>
 
 using namespace Aws::GameLift::Internal;
 
 std::string JsonHelper::SafelyDeserializeString(const rapidjson::Value &value, const char *key) {
-    return value.HasMember(key) && value[key].IsString() ? value[key].GetString() : "";
+    rapidjson::Value::ConstMemberIterator member = value.FindMember(key);
+    if (member == value.MemberEnd() || !member->value.IsString()) {
+        return "";
+    }
+    return std::string(member->value.GetString(), member->value.GetStringLength());
 }
 
 void JsonHelper::WriteNonEmptyString(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, const std::string &value) {
@@ -25,7 +30,8 @@ void JsonHelper::WriteNonEmptyString(rapidjson::Writer<rapidjson::StringBuffer>
 }
 
 int JsonHelper::SafelyDeserializeInt(const rapidjson::Value &value, const char *key) {
-    return value.HasMember(key) && value[key].IsInt() ? value[key].GetInt() : -1;
+    rapidjson::Value::ConstMemberIterator member = value.FindMember(key);
+    return member != value.MemberEnd() && member->value.IsInt() ? member->value.GetInt() : -1;
 }
 
 void JsonHelper::WritePositiveInt(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, int value) {
@@ -36,7 +42,8 @@ void JsonHelper::WritePositiveInt(rapidjson::Writer<rapidjson::StringBuffer> *wr
 }
 
 long JsonHelper::SafelyDeserializeLong(const rapidjson::Value &value, const char *key) {
-    return value.HasMember(key) && value[key].IsInt64() ? static_cast<long>(value[key].GetInt64()) : -1;
+    rapidjson::Value::ConstMemberIterator member = value.FindMember(key);
+    return member != value.MemberEnd() && member->value.IsInt64() ? static_cast<long>(member->value.GetInt64()) : -1;
 }
 
 void JsonHelper::WritePositiveLong(rapidjson::Writer<rapidjson::StringBuffer> *writer, const char *key, long value) {
@@ -47,11 +54,19 @@ void JsonHelper::WritePositiveLong(rapidjson::Writer<rapidjson::StringBuffer> *w
 }
 
 Aws::GameLift::Server::LogParameters JsonHelper::SafelyDeserializeLogParameters(const rapidjson::Value &value, const char *key) {
-    if (!value.HasMember(key) || !value[key].IsArray() || value[key].Size() == 0) {
+    rapidjson::Value::ConstMemberIterator member = value.FindMember(key);
+    if (member == value.MemberEnd()) {
+        return Aws::GameLift::Server::LogParameters();
+    }
+    return SafelyDeserializeLogParameters(member->value);
+}
+
+Aws::GameLift::Server::LogParameters JsonHelper::SafelyDeserializeLogParameters(const rapidjson::Value &value) {
+    if (!value.IsArray() || value.Size() == 0) {
         return Aws::GameLift::Server::LogParameters();
     }
 
-    const rapidjson::SizeType numLogPaths = value[key].Size();
+    const rapidjson::SizeType numLogPaths = value.Size();
 #ifdef GAMELIFT_USE_STD
     std::vector<std::string> logPaths = std::vector<std::string>();
 #else
@@ -59,15 +74,15 @@ Aws::GameLift::Server::LogParameters JsonHelper::SafelyDeserializeLogParameters(
 #endif
 
     for (rapidjson::SizeType i = 0; i < numLogPaths; i++) {
-        if (value[key][i].IsString()) {
+        if (value[i].IsString()) {
 #ifdef GAMELIFT_USE_STD
-            logPaths.push_back(value[key][i].GetString());
+            logPaths.push_back(value[i].GetString());
 #else
             logPaths[i] = new char[MAX_PATH_LENGTH];
 #ifdef WIN32
-            strcpy_s(logPaths[i], MAX_PATH_LENGTH, value[key][i].GetString());
+            strcpy_s(logPaths[i], MAX_PATH_LENGTH, value[i].GetString());
 #else
-            strncpy(logPaths[i], value[key][i].GetString(), MAX_PATH_LENGTH);
+            strncpy(logPaths[i], value[i].GetString(), MAX_PATH_LENGTH);
 #endif
 #endif
         }
@@ -105,3 +120,21 @@ void JsonHelper::WriteLogParameters(rapidjson::Writer<rapidjson::StringBuffer> *
 
     writer->EndArray();
 }
+
+rapidjson::StringBuffer &JsonHelper::GetThreadLocalBuffer() {
+    static thread_local rapidjson::StringBuffer buffer;
+    const bool shrink = buffer.GetSize() > MAX_RETAINED_BUFFER_SIZE;
+    buffer.Clear();
+    if (shrink) {
+        buffer.ShrinkToFit();
+    }
+    return buffer;
+}
+
+const rapidjson::Value *JsonHelper::ParseThreadLocal(const std::string &jsonString) {
+    static thread_local InboundFrameParser parser;
+    // Keeps its capacity between calls, so copying into it doesn't allocate once warmed up
+    static thread_local std::string scratch;
+    scratch.assign(jsonString);
+    return parser.Parse(scratch);
+}
@@ -0,0 +1,244 @@
+/*
+ * All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+ * its licensors.
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this
+ * distribution (the "License"). All use of this software is governed by the License,
+ * or, if provided, by the license below or the license accompanying this file. Do not
+ * remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *
+ */
+
+#include <algorithm>
+#include <aws/gamelift/internal/util/TimerScheduler.h>
+
+namespace Aws {
+namespace GameLift {
+namespace Internal {
+
+constexpr const TimerScheduler::TimerId TimerScheduler::INVALID_TIMER_ID;
+constexpr const int TimerScheduler::DEFAULT_TICK_MILLIS;
+constexpr const std::size_t TimerScheduler::DEFAULT_WHEEL_SIZE;
+constexpr const std::uint64_t TimerScheduler::NO_DEADLINE;
+
+TimerScheduler::SharedState::SharedState(std::chrono::milliseconds tick, std::size_t wheelSize)
+    : tick(tick), epoch(std::chrono::steady_clock::now()), wheel(wheelSize), slotDeadlineTicks(wheelSize, NO_DEADLINE), stopping(false), generation(0),
+      lastCollectedTick(0), nextDeadlineTick(NO_DEADLINE), nextSequence(0), pendingTimerCount(0) {}
+
+TimerScheduler::TimerScheduler(std::chrono::milliseconds tick, std::size_t wheelSize)
+    : m_state(std::make_shared<SharedState>(tick.count() > 0 ? tick : std::chrono::milliseconds(DEFAULT_TICK_MILLIS),
+                                            wheelSize > 0 && wheelSize <= (std::size_t(1) << SLOT_BITS) ? wheelSize : DEFAULT_WHEEL_SIZE)) {}
+
+TimerScheduler::~TimerScheduler() { Stop(); }
+
+void TimerScheduler::Start() {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    if (m_thread.joinable()) {
+        return;
+    }
+    m_state->stopping = false;
+    const std::uint64_t generation = ++m_state->generation;
+    std::shared_ptr<SharedState> state = m_state;
+    m_thread = std::thread([state, generation] { Run(state, generation); });
+}
+
+void TimerScheduler::Stop() {
+    std::vector<std::vector<Timer>> discardedTimers;
+    std::thread thread;
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->stopping = true;
+        thread = std::move(m_thread);
+        discardedTimers.resize(m_state->wheel.size());
+        m_state->wheel.swap(discardedTimers);
+        std::fill(m_state->slotDeadlineTicks.begin(), m_state->slotDeadlineTicks.end(), NO_DEADLINE);
+        m_state->pendingTimerCount = 0;
+        m_state->nextDeadlineTick = NO_DEADLINE;
+    }
+    m_state->wakeUp.notify_all();
+    if (thread.joinable()) {
+        if (thread.get_id() == std::this_thread::get_id()) {
+            // Stopped from one of our own tasks. The thread only holds the shared state, and exits once the task returns.
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+    // discardedTimers is destroyed here, outside the lock, in case a task's captures call back into the scheduler.
+}
+
+TimerScheduler::TimerId TimerScheduler::Schedule(std::chrono::milliseconds delay, std::function<void()> task) {
+    SharedState &state = *m_state;
+    bool wakeUp = false;
+    TimerId timerId;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        const std::chrono::nanoseconds tickNanos = state.tick;
+        const std::chrono::nanoseconds offset = std::chrono::steady_clock::now() + delay - state.epoch;
+        std::uint64_t deadlineTick = offset.count() > 0 ? (offset.count() + tickNanos.count() - 1) / tickNanos.count() : 0;
+        // A timer can't land on a tick that was already collected, or it would wait a full turn of the wheel.
+        deadlineTick = std::max(deadlineTick, state.lastCollectedTick + 1);
+
+        const std::size_t slot = deadlineTick % state.wheel.size();
+        timerId = (++state.nextSequence << SLOT_BITS) | slot;
+        state.wheel[slot].push_back(Timer{timerId, deadlineTick, std::move(task)});
+        state.slotDeadlineTicks[slot] = std::min(state.slotDeadlineTicks[slot], deadlineTick);
+        state.pendingTimerCount++;
+        if (deadlineTick < state.nextDeadlineTick) {
+            state.nextDeadlineTick = deadlineTick;
+            wakeUp = true;
+        }
+    }
+    if (wakeUp) {
+        state.wakeUp.notify_all();
+    }
+    return timerId;
+}
+
+bool TimerScheduler::Cancel(TimerId timerId) {
+    SharedState &state = *m_state;
+    std::function<void()> cancelledTask;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        const std::size_t slot = timerId & ((std::uint64_t(1) << SLOT_BITS) - 1);
+        if (timerId == INVALID_TIMER_ID || slot >= state.wheel.size()) {
+            return false;
+        }
+        std::vector<Timer> &timers = state.wheel[slot];
+        auto it = std::find_if(timers.begin(), timers.end(), [timerId](const Timer &timer) { return timer.id == timerId; });
+        if (it == timers.end()) {
+            return false;
+        }
+        cancelledTask = std::move(it->task);
+        if (it != timers.end() - 1) {
+            *it = std::move(timers.back());
+        }
+        timers.pop_back();
+        UpdateSlotDeadlineTick(state, slot);
+        state.pendingTimerCount--;
+        // nextDeadlineTick may now be early; the scheduler thread wakes, finds nothing due and moves on.
+    }
+    return true;
+}
+
+std::size_t TimerScheduler::RunDueTimers(std::chrono::steady_clock::time_point now) {
+    std::vector<Timer> dueTimers;
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        CollectDueTimers(*m_state, ToTick(*m_state, now), dueTimers);
+    }
+    for (Timer &timer : dueTimers) {
+        timer.task();
+    }
+    return dueTimers.size();
+}
+
+std::size_t TimerScheduler::GetPendingTimerCount() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->pendingTimerCount;
+}
+
+void TimerScheduler::Run(const std::shared_ptr<SharedState> &state, std::uint64_t generation) {
+    std::vector<Timer> dueTimers;
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (!state->stopping && state->generation == generation) {
+        if (state->nextDeadlineTick == NO_DEADLINE) {
+            state->wakeUp.wait(lock);
+            continue;
+        }
+        const std::chrono::steady_clock::time_point deadline =
+            state->epoch + state->tick * static_cast<std::chrono::milliseconds::rep>(state->nextDeadlineTick);
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (now < deadline) {
+            state->wakeUp.wait_until(lock, deadline);
+            continue;
+        }
+        CollectDueTimers(*state, ToTick(*state, now), dueTimers);
+        if (dueTimers.empty()) {
+            continue;
+        }
+        lock.unlock();
+        for (Timer &timer : dueTimers) {
+            timer.task();
+        }
+        dueTimers.clear();
+        lock.lock();
+    }
+}
+
+std::uint64_t TimerScheduler::ToTick(const SharedState &state, std::chrono::steady_clock::time_point time) {
+    if (time <= state.epoch) {
+        return 0;
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(time - state.epoch).count() / state.tick.count();
+}
+
+void TimerScheduler::CollectDueTimers(SharedState &state, std::uint64_t nowTick, std::vector<Timer> &dueTimers) {
+    if (state.nextDeadlineTick > nowTick) {
+        state.lastCollectedTick = std::max(state.lastCollectedTick, nowTick);
+        return;
+    }
+
+    // Nothing is due before nextDeadlineTick, so the walk starts there and covers at most one turn of the wheel.
+    const std::size_t wheelSize = state.wheel.size();
+    const std::uint64_t ticksToVisit = std::min<std::uint64_t>(nowTick - state.nextDeadlineTick + 1, wheelSize);
+    const std::size_t firstDueTimer = dueTimers.size();
+    for (std::uint64_t i = 0; i < ticksToVisit; i++) {
+        const std::size_t slot = (state.nextDeadlineTick + i) % wheelSize;
+        if (state.slotDeadlineTicks[slot] > nowTick) {
+            continue;
+        }
+        std::vector<Timer> &timers = state.wheel[slot];
+        for (std::size_t j = 0; j < timers.size();) {
+            if (timers[j].deadlineTick <= nowTick) {
+                dueTimers.push_back(std::move(timers[j]));
+                if (j != timers.size() - 1) {
+                    timers[j] = std::move(timers.back());
+                }
+                timers.pop_back();
+            } else {
+                j++;
+            }
+        }
+        UpdateSlotDeadlineTick(state, slot);
+    }
+    state.pendingTimerCount -= dueTimers.size() - firstDueTimer;
+    state.lastCollectedTick = nowTick;
+    UpdateNextDeadlineTick(state, nowTick);
+
+    // Timers sharing a deadline run in the order they were scheduled.
+    std::sort(dueTimers.begin() + firstDueTimer, dueTimers.end(), [](const Timer &a, const Timer &b) {
+        return a.deadlineTick != b.deadlineTick ? a.deadlineTick < b.deadlineTick : (a.id >> SLOT_BITS) < (b.id >> SLOT_BITS);
+    });
+}
+
+void TimerScheduler::UpdateSlotDeadlineTick(SharedState &state, std::size_t slot) {
+    std::uint64_t deadlineTick = NO_DEADLINE;
+    for (const Timer &timer : state.wheel[slot]) {
+        deadlineTick = std::min(deadlineTick, timer.deadlineTick);
+    }
+    state.slotDeadlineTicks[slot] = deadlineTick;
+}
+
+void TimerScheduler::UpdateNextDeadlineTick(SharedState &state, std::uint64_t nowTick) {
+    state.nextDeadlineTick = NO_DEADLINE;
+    if (state.pendingTimerCount == 0) {
+        return;
+    }
+    // Every pending deadline is after nowTick, so the first tick in the next turn whose slot's earliest deadline is
+    // that very tick is the next deadline. A slot can only hold a later turn's timers otherwise.
+    const std::size_t wheelSize = state.wheel.size();
+    for (std::uint64_t tick = nowTick + 1; tick <= nowTick + wheelSize; tick++) {
+        if (state.slotDeadlineTicks[tick % wheelSize] == tick) {
+            state.nextDeadlineTick = tick;
+            return;
+        }
+    }
+    // Nothing due within a turn, so the next deadline is the earliest among the slots
+    state.nextDeadlineTick = *std::min_element(state.slotDeadlineTicks.begin(), state.slotDeadlineTicks.end());
+}
+
+} // namespace Internal
+} // namespace GameLift
+} // namespace Aws
@@ -19,6 +19,150 @@ using namespace Aws::GameLift;
 
 static const std::string sdkVersion = "5.1.2";
 
+namespace {
+// Resolves the server state for an asynchronous call. If the SDK isn't initialized the failure is
+// reported through the callback and nullptr is returned.
+template <typename OutcomeT> Internal::GameLiftServerState *GetServerStateForAsyncCall(const std::function<void(const OutcomeT &)> &callback) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        callback(OutcomeT(giOutcome.GetError()));
+        return nullptr;
+    }
+
+    return static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+}
+
+void ProcessEndingAsyncInternal(const Internal::GenericOutcomeCallback &callback, int timeoutMillis) {
+    Internal::GameLiftServerState *serverState = GetServerStateForAsyncCall<GenericOutcome>(callback);
+    if (serverState != nullptr) {
+        serverState->ProcessEndingAsync(callback, timeoutMillis);
+    }
+}
+
+void ActivateGameSessionAsyncInternal(const Internal::GenericOutcomeCallback &callback, int timeoutMillis) {
+    Internal::GameLiftServerState *serverState = GetServerStateForAsyncCall<GenericOutcome>(callback);
+    if (serverState != nullptr) {
+        serverState->ActivateGameSessionAsync(callback, timeoutMillis);
+    }
+}
+
+void StartMatchBackfillAsyncInternal(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &request,
+                                     const Internal::StartMatchBackfillOutcomeCallback &callback, int timeoutMillis) {
+    Internal::GameLiftServerState *serverState = GetServerStateForAsyncCall<StartMatchBackfillOutcome>(callback);
+    if (serverState != nullptr) {
+        serverState->StartMatchBackfillAsync(request, callback, timeoutMillis);
+    }
+}
+
+void StopMatchBackfillAsyncInternal(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &request, const Internal::GenericOutcomeCallback &callback,
+                                    int timeoutMillis) {
+    Internal::GameLiftServerState *serverState = GetServerStateForAsyncCall<GenericOutcome>(callback);
+    if (serverState != nullptr) {
+        serverState->StopMatchBackfillAsync(request, callback, timeoutMillis);
+    }
+}
+
+void UpdatePlayerSessionCreationPolicyAsyncInternal(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy,
+                                                    const Internal::GenericOutcomeCallback &callback, int timeoutMillis) {
+    Internal::GameLiftServerState *serverState = GetServerStateForAsyncCall<GenericOutcome>(callback);
+    if (serverState != nullptr) {
+        serverState->UpdatePlayerSessionCreationPolicyAsync(newPlayerSessionPolicy, callback, timeoutMillis);
+    }
+}
+
+void AcceptPlayerSessionAsyncInternal(const std::string &playerSessionId, const Internal::GenericOutcomeCallback &callback, int timeoutMillis) {
+    Internal::GameLiftServerState *serverState = GetServerStateForAsyncCall<GenericOutcome>(callback);
+    if (serverState == nullptr) {
+        return;
+    }
+
+    if (!serverState->IsProcessReady()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)));
+        return;
+    }
+
+    serverState->AcceptPlayerSessionAsync(playerSessionId, callback, timeoutMillis);
+}
+
+void RemovePlayerSessionAsyncInternal(const std::string &playerSessionId, const Internal::GenericOutcomeCallback &callback, int timeoutMillis) {
+    Internal::GameLiftServerState *serverState = GetServerStateForAsyncCall<GenericOutcome>(callback);
+    if (serverState == nullptr) {
+        return;
+    }
+
+    if (!serverState->IsProcessReady()) {
+        callback(GenericOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)));
+        return;
+    }
+
+    serverState->RemovePlayerSessionAsync(playerSessionId, callback, timeoutMillis);
+}
+
+void DescribePlayerSessionsAsyncInternal(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                                         const Internal::DescribePlayerSessionsOutcomeCallback &callback, int timeoutMillis) {
+    Internal::GameLiftServerState *serverState = GetServerStateForAsyncCall<DescribePlayerSessionsOutcome>(callback);
+    if (serverState == nullptr) {
+        return;
+    }
+
+    if (!serverState->IsProcessReady()) {
+        callback(DescribePlayerSessionsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::PROCESS_NOT_READY)));
+        return;
+    }
+
+    serverState->DescribePlayerSessionsAsync(describePlayerSessionsRequest, callback, timeoutMillis);
+}
+
+void GetComputeCertificateAsyncInternal(const Internal::GetComputeCertificateOutcomeCallback &callback, int timeoutMillis) {
+    Internal::GameLiftServerState *serverState = GetServerStateForAsyncCall<GetComputeCertificateOutcome>(callback);
+    if (serverState != nullptr) {
+        serverState->GetComputeCertificateAsync(callback, timeoutMillis);
+    }
+}
+
+void GetFleetRoleCredentialsAsyncInternal(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                          const Internal::GetFleetRoleCredentialsOutcomeCallback &callback, int timeoutMillis) {
+    Internal::GameLiftServerState *serverState = GetServerStateForAsyncCall<GetFleetRoleCredentialsOutcome>(callback);
+    if (serverState != nullptr) {
+        serverState->GetFleetRoleCredentialsAsync(request, callback, timeoutMillis);
+    }
+}
+
+AwsLongOutcome PollEventsInternal(const Internal::ServerEventCallback &callback, int maxEvents) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return AwsLongOutcome(giOutcome.GetError());
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+    return serverState->PollEvents(callback, maxEvents);
+}
+
+AwsLongOutcome PollInternal(int budgetMicros) {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return AwsLongOutcome(giOutcome.GetError());
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+    return serverState->Poll(std::chrono::microseconds(budgetMicros > 0 ? budgetMicros : 0));
+}
+
+#ifndef GAMELIFT_USE_STD
+// Adapts a function pointer handler and its user state to the internal callback type
+template <typename OutcomeT, typename HandlerT> std::function<void(const OutcomeT &)> BindHandler(HandlerT handler, void *state) {
+    return [handler, state](const OutcomeT &outcome) {
+        if (handler != nullptr) {
+            handler(outcome, state);
+        }
+    };
+}
+#endif
+} // namespace
+
 #ifdef GAMELIFT_USE_STD
 Aws::GameLift::AwsStringOutcome Server::GetSdkVersion() { return AwsStringOutcome(sdkVersion); }
 
@@ -362,3 +506,118 @@ GetFleetRoleCredentialsOutcome Server::GetFleetRoleCredentials(const Aws::GameLi
 
     return GetFleetRoleCredentialsOutcome(GameLiftError(GAMELIFT_ERROR_TYPE::NOT_INITIALIZED));
 }
+
+StartupTimingsOutcome Server::GetStartupTimings() {
+    Internal::GetInstanceOutcome giOutcome = Internal::GameLiftCommonState::GetInstance(Internal::GAMELIFT_INTERNAL_STATE_TYPE::SERVER);
+
+    if (!giOutcome.IsSuccess()) {
+        return StartupTimingsOutcome(giOutcome.GetError());
+    }
+
+    Internal::GameLiftServerState *serverState = static_cast<Internal::GameLiftServerState *>(giOutcome.GetResult());
+    return serverState->GetStartupTimings();
+}
+
+#ifdef GAMELIFT_USE_STD
+void Server::ProcessEndingAsync(const GenericOutcomeHandler &handler, int timeoutMillis) { ProcessEndingAsyncInternal(handler, timeoutMillis); }
+
+void Server::ActivateGameSessionAsync(const GenericOutcomeHandler &handler, int timeoutMillis) { ActivateGameSessionAsyncInternal(handler, timeoutMillis); }
+
+void Server::StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &request, const StartMatchBackfillOutcomeHandler &handler,
+                                     int timeoutMillis) {
+    StartMatchBackfillAsyncInternal(request, handler, timeoutMillis);
+}
+
+void Server::StopMatchBackfillAsync(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &request, const GenericOutcomeHandler &handler,
+                                    int timeoutMillis) {
+    StopMatchBackfillAsyncInternal(request, handler, timeoutMillis);
+}
+
+void Server::UpdatePlayerSessionCreationPolicyAsync(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy,
+                                                    const GenericOutcomeHandler &handler, int timeoutMillis) {
+    UpdatePlayerSessionCreationPolicyAsyncInternal(newPlayerSessionPolicy, handler, timeoutMillis);
+}
+
+void Server::AcceptPlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeHandler &handler, int timeoutMillis) {
+    AcceptPlayerSessionAsyncInternal(playerSessionId, handler, timeoutMillis);
+}
+
+void Server::RemovePlayerSessionAsync(const std::string &playerSessionId, const GenericOutcomeHandler &handler, int timeoutMillis) {
+    RemovePlayerSessionAsyncInternal(playerSessionId, handler, timeoutMillis);
+}
+
+void Server::DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                                         const DescribePlayerSessionsOutcomeHandler &handler, int timeoutMillis) {
+    DescribePlayerSessionsAsyncInternal(describePlayerSessionsRequest, handler, timeoutMillis);
+}
+
+void Server::GetComputeCertificateAsync(const GetComputeCertificateOutcomeHandler &handler, int timeoutMillis) {
+    GetComputeCertificateAsyncInternal(handler, timeoutMillis);
+}
+
+void Server::GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                          const GetFleetRoleCredentialsOutcomeHandler &handler, int timeoutMillis) {
+    GetFleetRoleCredentialsAsyncInternal(request, handler, timeoutMillis);
+}
+
+AwsLongOutcome Server::PollEvents(const ServerEventHandler &handler, int maxEvents) { return PollEventsInternal(handler, maxEvents); }
+
+AwsLongOutcome Server::Poll(int budgetMicros) { return PollInternal(budgetMicros); }
+#else
+void Server::ProcessEndingAsync(GenericOutcomeHandler handler, void *state, int timeoutMillis) {
+    ProcessEndingAsyncInternal(BindHandler<GenericOutcome>(handler, state), timeoutMillis);
+}
+
+void Server::ActivateGameSessionAsync(GenericOutcomeHandler handler, void *state, int timeoutMillis) {
+    ActivateGameSessionAsyncInternal(BindHandler<GenericOutcome>(handler, state), timeoutMillis);
+}
+
+void Server::StartMatchBackfillAsync(const Aws::GameLift::Server::Model::StartMatchBackfillRequest &request, StartMatchBackfillOutcomeHandler handler,
+                                     void *state, int timeoutMillis) {
+    StartMatchBackfillAsyncInternal(request, BindHandler<StartMatchBackfillOutcome>(handler, state), timeoutMillis);
+}
+
+void Server::StopMatchBackfillAsync(const Aws::GameLift::Server::Model::StopMatchBackfillRequest &request, GenericOutcomeHandler handler, void *state,
+                                    int timeoutMillis) {
+    StopMatchBackfillAsyncInternal(request, BindHandler<GenericOutcome>(handler, state), timeoutMillis);
+}
+
+void Server::UpdatePlayerSessionCreationPolicyAsync(Aws::GameLift::Server::Model::PlayerSessionCreationPolicy newPlayerSessionPolicy,
+                                                    GenericOutcomeHandler handler, void *state, int timeoutMillis) {
+    UpdatePlayerSessionCreationPolicyAsyncInternal(newPlayerSessionPolicy, BindHandler<GenericOutcome>(handler, state), timeoutMillis);
+}
+
+void Server::AcceptPlayerSessionAsync(const char *playerSessionId, GenericOutcomeHandler handler, void *state, int timeoutMillis) {
+    AcceptPlayerSessionAsyncInternal(playerSessionId, BindHandler<GenericOutcome>(handler, state), timeoutMillis);
+}
+
+void Server::RemovePlayerSessionAsync(const char *playerSessionId, GenericOutcomeHandler handler, void *state, int timeoutMillis) {
+    RemovePlayerSessionAsyncInternal(playerSessionId, BindHandler<GenericOutcome>(handler, state), timeoutMillis);
+}
+
+void Server::DescribePlayerSessionsAsync(const Aws::GameLift::Server::Model::DescribePlayerSessionsRequest &describePlayerSessionsRequest,
+                                         DescribePlayerSessionsOutcomeHandler handler, void *state, int timeoutMillis) {
+    DescribePlayerSessionsAsyncInternal(describePlayerSessionsRequest, BindHandler<DescribePlayerSessionsOutcome>(handler, state), timeoutMillis);
+}
+
+void Server::GetComputeCertificateAsync(GetComputeCertificateOutcomeHandler handler, void *state, int timeoutMillis) {
+    GetComputeCertificateAsyncInternal(BindHandler<GetComputeCertificateOutcome>(handler, state), timeoutMillis);
+}
+
+void Server::GetFleetRoleCredentialsAsync(const Aws::GameLift::Server::Model::GetFleetRoleCredentialsRequest &request,
+                                          GetFleetRoleCredentialsOutcomeHandler handler, void *state, int timeoutMillis) {
+    GetFleetRoleCredentialsAsyncInternal(request, BindHandler<GetFleetRoleCredentialsOutcome>(handler, state), timeoutMillis);
+}
+
+AwsLongOutcome Server::PollEvents(ServerEventHandler handler, void *state, int maxEvents) {
+    return PollEventsInternal(
+        [handler, state](Aws::GameLift::Server::Model::ServerEvent &event) {
+            if (handler != nullptr) {
+                handler(event, state);
+            }
+        },
+        maxEvents);
+}
+
+AwsLongOutcome Server::Poll(int budgetMicros) { return PollInternal(budgetMicros); }
+#endif